@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 
 namespace Vortex 
@@ -106,25 +107,52 @@ namespace Vortex
 	};
 
 	// Specialization for void results
+	//
+	// Renderer entry points return this at draw-call frequency and almost
+	// always succeed, so the success path must cost nothing: the message
+	// lives behind a pointer allocated only when an error carries one,
+	// making a success Result an enum plus a null pointer instead of a
+	// std::string constructed and destroyed per call. Copies deep-copy the
+	// message so the value semantics callers rely on are unchanged.
 	template<>
 	class Result<void>
 	{
 	public:
 		Result() : m_ErrorCode(ErrorCode::Success) {}
 		Result(ErrorCode errorCode) : m_ErrorCode(errorCode) {}
-		Result(ErrorCode errorCode, const std::string& message) : m_ErrorCode(errorCode), m_ErrorMessage(message) {}
+		Result(ErrorCode errorCode, const std::string& message)
+			: m_ErrorCode(errorCode), m_ErrorMessage(std::make_unique<std::string>(message)) {}
+
+		Result(const Result& other)
+			: m_ErrorCode(other.m_ErrorCode)
+			, m_ErrorMessage(other.m_ErrorMessage ? std::make_unique<std::string>(*other.m_ErrorMessage) : nullptr) {}
+		Result& operator=(const Result& other)
+		{
+			if (this != &other)
+			{
+				m_ErrorCode = other.m_ErrorCode;
+				m_ErrorMessage = other.m_ErrorMessage ? std::make_unique<std::string>(*other.m_ErrorMessage) : nullptr;
+			}
+			return *this;
+		}
+		Result(Result&&) noexcept = default;
+		Result& operator=(Result&&) noexcept = default;
 
 		bool IsSuccess() const { return m_ErrorCode == ErrorCode::Success; }
 		bool IsError() const { return m_ErrorCode != ErrorCode::Success; }
 
 		ErrorCode GetErrorCode() const { return m_ErrorCode; }
-		const std::string& GetErrorMessage() const { return m_ErrorMessage; }
+		const std::string& GetErrorMessage() const
+		{
+			static const std::string kNoMessage;
+			return m_ErrorMessage ? *m_ErrorMessage : kNoMessage;
+		}
 
 		explicit operator bool() const { return IsSuccess(); }
 
 	private:
 		ErrorCode m_ErrorCode;
-		std::string m_ErrorMessage;
+		std::unique_ptr<std::string> m_ErrorMessage;
 	};
 
 	// Helper functions
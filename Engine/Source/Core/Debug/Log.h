@@ -106,20 +106,67 @@ namespace Vortex
 	};
 }
 
+// Compile-time log floor: macro calls below this level expand to nothing,
+// so neither the logger lookup nor the argument expressions are evaluated.
+// Levels follow spdlog: 0=trace 1=debug 2=info 3=warn 4=error 5=critical.
+// Override per-build with a VX_LOG_COMPILE_LEVEL define; by default Dist
+// builds drop trace/debug chatter and every other build keeps everything.
+#ifndef VX_LOG_COMPILE_LEVEL
+    #ifdef VX_DIST
+        #define VX_LOG_COMPILE_LEVEL 2
+    #else
+        #define VX_LOG_COMPILE_LEVEL 0
+    #endif
+#endif
+
+#define VX_LOG_NOOP           do { } while(0)
+
 // Core log macros with safe initialization check
+#if VX_LOG_COMPILE_LEVEL <= 0
 #define VX_CORE_TRACE(...)    do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->trace(__VA_ARGS__); } while(0)
+#else
+#define VX_CORE_TRACE(...)    VX_LOG_NOOP
+#endif
+#if VX_LOG_COMPILE_LEVEL <= 1
 #define VX_CORE_DEBUG(...)    do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->debug(__VA_ARGS__); } while(0)
+#else
+#define VX_CORE_DEBUG(...)    VX_LOG_NOOP
+#endif
+#if VX_LOG_COMPILE_LEVEL <= 2
 #define VX_CORE_INFO(...)     do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->info(__VA_ARGS__); } while(0)
+#else
+#define VX_CORE_INFO(...)     VX_LOG_NOOP
+#endif
+#if VX_LOG_COMPILE_LEVEL <= 3
 #define VX_CORE_WARN(...)     do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->warn(__VA_ARGS__); } while(0)
+#else
+#define VX_CORE_WARN(...)     VX_LOG_NOOP
+#endif
 #define VX_CORE_ERROR(...)    do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->error(__VA_ARGS__); } while(0)
 #define VX_CORE_CRITICAL(...) do { auto logger = ::Vortex::Log::GetCoreLogger(); if (logger) logger->critical(__VA_ARGS__); } while(0)
 
 // Client log macros with safe initialization check
+#if VX_LOG_COMPILE_LEVEL <= 0
 #define VX_TRACE(...)         do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->trace(__VA_ARGS__); } while(0)
+#else
+#define VX_TRACE(...)         VX_LOG_NOOP
+#endif
 #ifndef VX_DEBUG
+#if VX_LOG_COMPILE_LEVEL <= 1
 #define VX_DEBUG(...)         do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->debug(__VA_ARGS__); } while(0)
+#else
+#define VX_DEBUG(...)         VX_LOG_NOOP
+#endif
 #endif
+#if VX_LOG_COMPILE_LEVEL <= 2
 #define VX_INFO(...)          do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->info(__VA_ARGS__); } while(0)
+#else
+#define VX_INFO(...)          VX_LOG_NOOP
+#endif
+#if VX_LOG_COMPILE_LEVEL <= 3
 #define VX_WARN(...)          do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->warn(__VA_ARGS__); } while(0)
+#else
+#define VX_WARN(...)          VX_LOG_NOOP
+#endif
 #define VX_ERROR(...)         do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->error(__VA_ARGS__); } while(0)
 #define VX_CRITICAL(...)      do { auto logger = ::Vortex::Log::GetClientLogger(); if (logger) logger->critical(__VA_ARGS__); } while(0)
@@ -419,6 +419,11 @@ namespace Vortex
         return GetConfigValue("Renderer.PostProcessing", true);
     }
 
+    int EngineConfig::GetMax2DBatchQuads() const
+    {
+        return GetConfigValue("Renderer.Max2DBatchQuads", 10000);
+    }
+
     float EngineConfig::GetGamma() const
     {
         return GetConfigValue("Renderer.Gamma", 2.2f);
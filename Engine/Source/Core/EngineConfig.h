@@ -107,6 +107,7 @@ namespace Vortex
         bool GetPostProcessing() const;
         float GetGamma() const;
         Color GetClearColor() const;
+        int GetMax2DBatchQuads() const;
         
         void SetRendererAPI(const std::string& api, bool saveToUserPrefs = true);
         void SetVSyncMode(const std::string& mode, bool saveToUserPrefs = true);
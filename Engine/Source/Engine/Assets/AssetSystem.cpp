@@ -134,6 +134,13 @@ namespace Vortex
         m_FallbackInitialized = false;
 
         m_Initialized = true;
+
+        if (m_ShaderHotReloadEnabled)
+        {
+            m_WatcherRunning = true;
+            m_ShaderWatcherThread = std::thread([this]() { ShaderWatcherLoop(); });
+        }
+
         VX_CORE_INFO("AssetSystem initialized. AssetsRoot: {}", m_AssetsRoot.string());
         MarkInitialized();
         return Result<void>();
@@ -260,15 +267,17 @@ namespace Vortex
             }
         }
 
-        // Periodic shader hot-reload polling
+        // Drain debounced shader changes detected by the watcher thread;
+        // the stat calls themselves never run on this thread anymore
         if (m_ShaderHotReloadEnabled)
         {
-            const double now = Time::GetUnscaledTime();
-            if (now - m_LastHotReloadCheckTime >= m_HotReloadIntervalSeconds)
+            std::vector<UUID> changed;
             {
-                m_LastHotReloadCheckTime = now;
-                CheckForShaderHotReloads();
+                std::lock_guard<std::mutex> lock(m_WatcherMutex);
+                changed.swap(m_WatcherChanged);
             }
+            if (!changed.empty())
+                ScheduleShaderReloads(changed);
         }
 
         // Process delayed unloads respecting grace period and dependencies
@@ -308,12 +317,23 @@ namespace Vortex
 
     Result<void> AssetSystem::Shutdown()
     {
+        // Stop the watcher before taking the registry lock so it cannot be
+        // mid-snapshot while the maps are being torn down
+        {
+            std::lock_guard<std::mutex> lock(m_WatcherMutex);
+            m_WatcherRunning = false;
+        }
+        m_WatcherCV.notify_all();
+        if (m_ShaderWatcherThread.joinable())
+            m_ShaderWatcherThread.join();
+
         std::lock_guard<std::mutex> lock(m_Mutex);
         m_PendingTasks.clear();
         m_Assets.clear();
         m_NameToUUID.clear();
         m_Refs.clear();
         m_FallbackShader.reset();
+        m_ShaderCompiler.reset();
         m_Initialized = false;
         MarkShutdown();
         VX_CORE_INFO("AssetSystem shut down");
@@ -882,10 +902,27 @@ namespace Vortex
         return AssetHandle<TextureAsset>(this, id);
     }
 
+    ShaderCompiler& AssetSystem::AcquireShaderCompiler()
+    {
+        std::lock_guard<std::mutex> lock(m_CompilerMutex);
+        if (!m_ShaderCompiler)
+        {
+            m_ShaderCompiler = std::make_unique<ShaderCompiler>();
+#if defined(VX_DIST)
+            // In distribution builds, do not create on-disk cache directories
+            m_ShaderCompiler->SetCachingEnabled(false);
+#else
+            // Keep caching enabled so reloads update on-disk cache with fresh SPIR-V
+            m_ShaderCompiler->SetCachingEnabled(true, (m_AssetsRoot / "Cache/Shaders").string());
+#endif
+        }
+        return *m_ShaderCompiler;
+    }
+
     Result<void> AssetSystem::BuildShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath, const std::filesystem::path& outputDir)
     {
         // Basic stub: compile and write SPIR-V blobs to outputDir for packaging
-        ShaderCompiler compiler;
+        ShaderCompiler& compiler = AcquireShaderCompiler();
         ShaderCompileOptions options; // default or load from config
         // Select target profile based on active graphics API (match runtime)
         switch (GetGraphicsAPI())
@@ -1008,14 +1045,7 @@ namespace Vortex
 
         setProgress(0.05f);
 
-        ShaderCompiler compiler;
-#if defined(VX_DIST)
-        // In distribution builds, do not create on-disk cache directories
-        compiler.SetCachingEnabled(false);
-#else
-        // Keep caching enabled so reloads update on-disk cache with fresh SPIR-V
-        compiler.SetCachingEnabled(true, (m_AssetsRoot / "Cache/Shaders").string());
-#endif
+        ShaderCompiler& compiler = AcquireShaderCompiler();
 
         setProgress(0.10f);
 
@@ -1043,12 +1073,14 @@ namespace Vortex
                 {
                     ShaderReflectionData reflection = ShaderReflection::CombineReflections({ vsReflRes.GetValue(), fsReflRes.GetValue() });
 
-                    // Create GPU shader
+                    // Create GPU shader; the stage views point straight at
+                    // the decoded SPIR-V, no staging map needed
                     auto shader = GPUShader::Create(name);
-                    std::unordered_map<ShaderStage, std::vector<uint32_t>> stages;
-                    stages[ShaderStage::Vertex] = std::move(vsSpv);
-                    stages[ShaderStage::Fragment] = std::move(fsSpv);
-                    auto createRes = shader->Create(stages, reflection);
+                    const ShaderStageBinary stages[] = {
+                        { ShaderStage::Vertex,   vsSpv.data(), vsSpv.size() },
+                        { ShaderStage::Fragment, fsSpv.data(), fsSpv.size() },
+                    };
+                    auto createRes = shader->Create(stages, 2, reflection);
                     if (createRes.IsSuccess())
                     {
                         setProgress(0.95f);
@@ -1060,7 +1092,7 @@ namespace Vortex
                                 auto* shaderAsset = dynamic_cast<ShaderAsset*>(it->second.assetPtr.get());
                                 if (shaderAsset)
                                 {
-                                    shaderAsset->SetShader(std::shared_ptr<GPUShader>(std::move(shader)));
+                                    shaderAsset->SetShader(std::move(shader));
                                     shaderAsset->SetReflection(reflection);
                                     shaderAsset->SetState(AssetState::Loaded);
                                     shaderAsset->SetProgress(1.0f);
@@ -1236,13 +1268,16 @@ namespace Vortex
 
         // Create GPUShader
         auto shader = GPUShader::Create(name);
-        std::unordered_map<ShaderStage, std::vector<uint32_t>> stages;
-        stages[ShaderStage::Vertex] = vsRes.GetValue().SpirV;
-        stages[ShaderStage::Fragment] = fsRes.GetValue().SpirV;
+        // The stage views borrow the compile results' SPIR-V in place;
+        // Create does not retain them past the call
+        const ShaderStageBinary stages[] = {
+            { ShaderStage::Vertex,   vsRes.GetValue().SpirV.data(), vsRes.GetValue().SpirV.size() },
+            { ShaderStage::Fragment, fsRes.GetValue().SpirV.data(), fsRes.GetValue().SpirV.size() },
+        };
 
         ShaderReflectionData reflection = ShaderReflection::CombineReflections({ vsRes.GetValue().Reflection, fsRes.GetValue().Reflection });
 
-        auto createRes = shader->Create(stages, reflection);
+        auto createRes = shader->Create(stages, 2, reflection);
         if (!createRes.IsSuccess())
         {
             VX_CORE_ERROR("AssetSystem: Failed to create GPU shader '{}'", name);
@@ -1272,7 +1307,7 @@ namespace Vortex
                 if (shaderAsset)
                 {
                     // Swap-in the newly created program
-                    shaderAsset->SetShader(std::shared_ptr<GPUShader>(std::move(shader)));
+                    shaderAsset->SetShader(std::move(shader));
                     shaderAsset->SetReflection(reflection);
                     shaderAsset->SetState(AssetState::Loaded);
                     shaderAsset->SetProgress(1.0f);
@@ -1317,7 +1352,7 @@ namespace Vortex
             void main(){ FragColor = u_Color; }
         )";
 
-        ShaderCompiler compiler;
+        ShaderCompiler& compiler = AcquireShaderCompiler();
         ShaderCompileOptions options; options.GenerateDebugInfo = false; options.TargetProfile = "opengl";
         if (auto* renderer = GetRenderer())
         {
@@ -1333,11 +1368,11 @@ namespace Vortex
                 options.HardwareCaps.SupportsMultiDrawIndirect = info.SupportsMultiDrawIndirect;
                 options.HardwareCaps.SRGBFramebufferCapable = info.SRGBFramebufferCapable;
                 // Provide commonly useful macros
-                options.Macros["VX_SUPPORTS_GEOMETRY"] = info.SupportsGeometryShaders ? "1" : "0";
-                options.Macros["VX_SUPPORTS_COMPUTE"] = info.SupportsComputeShaders ? "1" : "0";
-                options.Macros["VX_SUPPORTS_MDI"] = info.SupportsMultiDrawIndirect ? "1" : "0";
-                options.Macros["VX_MAX_TEX_UNITS"] = std::to_string(info.MaxCombinedTextureUnits);
-                options.Macros["VX_SRGB_FB"] = info.SRGBFramebufferCapable ? "1" : "0";
+                options.Macros.Set("VX_SUPPORTS_GEOMETRY", info.SupportsGeometryShaders ? "1" : "0");
+                options.Macros.Set("VX_SUPPORTS_COMPUTE", info.SupportsComputeShaders ? "1" : "0");
+                options.Macros.Set("VX_SUPPORTS_MDI", info.SupportsMultiDrawIndirect ? "1" : "0");
+                options.Macros.Set("VX_MAX_TEX_UNITS", std::to_string(info.MaxCombinedTextureUnits));
+                options.Macros.Set("VX_SRGB_FB", info.SRGBFramebufferCapable ? "1" : "0");
             }
         }
         auto vs = compiler.CompileFromSource(kVS, ShaderStage::Vertex, options, "Fallback.vert");
@@ -1348,75 +1383,151 @@ namespace Vortex
             return;
         }
         auto shader = GPUShader::Create("FallbackShader");
-        std::unordered_map<ShaderStage, std::vector<uint32_t>> stages;
-        stages[ShaderStage::Vertex] = vs.GetValue().SpirV;
-        stages[ShaderStage::Fragment] = fs.GetValue().SpirV;
+        const ShaderStageBinary stages[] = {
+            { ShaderStage::Vertex,   vs.GetValue().SpirV.data(), vs.GetValue().SpirV.size() },
+            { ShaderStage::Fragment, fs.GetValue().SpirV.data(), fs.GetValue().SpirV.size() },
+        };
         ShaderReflectionData reflection = ShaderReflection::CombineReflections({ vs.GetValue().Reflection, fs.GetValue().Reflection });
-        if (shader->Create(stages, reflection).IsSuccess())
+        if (shader->Create(stages, 2, reflection).IsSuccess())
         {
-            m_FallbackShader = std::shared_ptr<GPUShader>(std::move(shader));
+            m_FallbackShader = std::move(shader);
             VX_CORE_INFO("AssetSystem: Fallback shader created");
         }
     }
 
-    void AssetSystem::CheckForShaderHotReloads()
+    void AssetSystem::ShaderWatcherLoop()
     {
-        // Collect candidates without holding the mutex while doing filesystem IO
-        std::vector<std::tuple<UUID, std::string, std::string, ShaderCompileOptions>> toReload;
+        using Clock = std::chrono::steady_clock;
+        constexpr auto kDebounce = std::chrono::milliseconds(300);
+
+        // Per-shader debounce state: the last mtimes we observed and when
+        // they last moved. A change is only reported once the mtimes have
+        // held still for a full debounce window, coalescing editor save
+        // bursts into a single reload.
+        struct PendingChange
+        {
+            std::filesystem::file_time_type VertexWrite{};
+            std::filesystem::file_time_type FragmentWrite{};
+            Clock::time_point LastBump{};
+        };
+        std::unordered_map<UUID, PendingChange> pending;
+
+        for (;;)
         {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            for (const auto& [id, srcInfo] : m_ShaderSources)
             {
-                if (m_ShaderReloading.find(id) != m_ShaderReloading.end())
-                    continue;
+                std::unique_lock<std::mutex> lock(m_WatcherMutex);
+                m_WatcherCV.wait_for(lock, kDebounce, [this]() { return !m_WatcherRunning; });
+                if (!m_WatcherRunning)
+                    return;
+            }
 
-                std::error_code ec1, ec2;
-                std::filesystem::path vp = srcInfo.VertexPath;
-                std::filesystem::path fp = srcInfo.FragmentPath;
+            // Snapshot the registered sources under the registry lock, then
+            // do all the filesystem stats with no lock held
+            std::vector<std::tuple<UUID, std::filesystem::path, std::filesystem::path,
+                                   std::filesystem::file_time_type, std::filesystem::file_time_type>> sources;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                sources.reserve(m_ShaderSources.size());
+                for (const auto& [id, srcInfo] : m_ShaderSources)
+                {
+                    if (m_ShaderReloading.find(id) != m_ShaderReloading.end())
+                        continue;
+
+                    // Resolve relative paths; prefer DevAssets root when available to match editing location
+                    std::filesystem::path vp = srcInfo.VertexPath;
+                    std::filesystem::path fp = srcInfo.FragmentPath;
+                    if (vp.is_relative()) vp = (m_DevAssetsAvailable ? (m_DevAssetsRoot / vp) : (m_AssetsRoot / vp));
+                    if (fp.is_relative()) fp = (m_DevAssetsAvailable ? (m_DevAssetsRoot / fp) : (m_AssetsRoot / fp));
+                    sources.emplace_back(id, std::move(vp), std::move(fp), srcInfo.VertexLastWrite, srcInfo.FragmentLastWrite);
+                }
+            }
 
-                // Resolve relative paths; prefer DevAssets root when available to match editing location
-                if (vp.is_relative()) vp = (m_DevAssetsAvailable ? (m_DevAssetsRoot / vp) : (m_AssetsRoot / vp));
-                if (fp.is_relative()) fp = (m_DevAssetsAvailable ? (m_DevAssetsRoot / fp) : (m_AssetsRoot / fp));
+            const auto now = Clock::now();
+            std::vector<UUID> ready;
+            for (const auto& [id, vp, fp, vsKnown, fsKnown] : sources)
+            {
+                std::error_code ec1, ec2;
+                std::filesystem::file_time_type vsCur = vsKnown;
+                std::filesystem::file_time_type fsCur = fsKnown;
+                bool changed = false;
 
-                bool vsChanged = false, fsChanged = false;
                 if (!vp.empty() && std::filesystem::exists(vp, ec1))
                 {
                     auto cur = std::filesystem::last_write_time(vp, ec1);
-                    if (!ec1 && (srcInfo.VertexLastWrite == std::filesystem::file_time_type{} || cur > srcInfo.VertexLastWrite))
-                        vsChanged = true;
+                    if (!ec1 && (vsKnown == std::filesystem::file_time_type{} || cur > vsKnown))
+                    {
+                        vsCur = cur;
+                        changed = true;
+                    }
                 }
                 if (!fp.empty() && std::filesystem::exists(fp, ec2))
                 {
                     auto cur = std::filesystem::last_write_time(fp, ec2);
-                    if (!ec2 && (srcInfo.FragmentLastWrite == std::filesystem::file_time_type{} || cur > srcInfo.FragmentLastWrite))
-                        fsChanged = true;
+                    if (!ec2 && (fsKnown == std::filesystem::file_time_type{} || cur > fsKnown))
+                    {
+                        fsCur = cur;
+                        changed = true;
+                    }
                 }
 
-                if (vsChanged || fsChanged)
+                if (!changed)
                 {
-                    // Lookup name for nice logging
-                    auto it = m_Assets.find(id);
-                    std::string name = (it != m_Assets.end() && it->second.assetPtr) ? it->second.assetPtr->GetName() : std::string("Shader");
-                    toReload.emplace_back(id, srcInfo.VertexPath, srcInfo.FragmentPath, srcInfo.Options);
-                    m_ShaderReloading.insert(id);
-                    VX_CORE_INFO("AssetSystem: Detected shader source change for '%s' (VS changed=%d, FS changed=%d)", name.c_str(), vsChanged ? 1 : 0, fsChanged ? 1 : 0);
+                    pending.erase(id);
+                    continue;
                 }
+
+                auto [pendingIt, inserted] = pending.try_emplace(id);
+                PendingChange& state = pendingIt->second;
+                if (inserted || state.VertexWrite != vsCur || state.FragmentWrite != fsCur)
+                {
+                    // First sighting, or the file is still being written -
+                    // (re)start the debounce window
+                    state.VertexWrite = vsCur;
+                    state.FragmentWrite = fsCur;
+                    state.LastBump = now;
+                    continue;
+                }
+                if (now - state.LastBump < kDebounce)
+                    continue;
+
+                ready.push_back(id);
+                pending.erase(pendingIt);
+            }
+
+            if (!ready.empty())
+            {
+                std::lock_guard<std::mutex> lock(m_WatcherMutex);
+                m_WatcherChanged.insert(m_WatcherChanged.end(), ready.begin(), ready.end());
             }
         }
+    }
 
-        // Schedule recompiles
-        for (auto& item : toReload)
+    void AssetSystem::ScheduleShaderReloads(const std::vector<UUID>& changed)
+    {
+        std::vector<std::tuple<UUID, std::string, std::string, ShaderCompileOptions, std::string>> toReload;
         {
-            UUID id; std::string vs, fs; ShaderCompileOptions opts;
-            std::tie(id, vs, fs, opts) = std::move(item);
-
-            std::string name;
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (const UUID& id : changed)
             {
-                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (m_ShaderReloading.find(id) != m_ShaderReloading.end())
+                    continue;
+                auto srcIt = m_ShaderSources.find(id);
+                if (srcIt == m_ShaderSources.end())
+                    continue;
+
                 auto it = m_Assets.find(id);
-                if (it != m_Assets.end() && it->second.assetPtr)
-                    name = it->second.assetPtr->GetName();
+                std::string name = (it != m_Assets.end() && it->second.assetPtr) ? it->second.assetPtr->GetName() : std::string("Shader");
+                VX_CORE_INFO("AssetSystem: Detected shader source change for '{}'", name);
+                toReload.emplace_back(id, srcIt->second.VertexPath, srcIt->second.FragmentPath, srcIt->second.Options, std::move(name));
+                m_ShaderReloading.insert(id);
             }
+        }
+
+        // Schedule recompiles
+        for (auto& item : toReload)
+        {
+            UUID id; std::string vs, fs, name; ShaderCompileOptions opts;
+            std::tie(id, vs, fs, opts, name) = std::move(item);
 
             auto task = CompileShaderTask(id, name, vs, fs, opts, {}, true);
             std::lock_guard<std::mutex> lock(m_Mutex);
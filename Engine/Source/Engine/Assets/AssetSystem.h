@@ -17,6 +17,8 @@
 #include <mutex>
 #include <filesystem>
 #include <unordered_set>
+#include <thread>
+#include <condition_variable>
 
 namespace Vortex
 {
@@ -174,8 +176,16 @@ namespace Vortex
         // Simple built-in fallback shader
         void EnsureFallbackShader();
 
-        // Periodic shader hot-reload check
-        void CheckForShaderHotReloads();
+        // Shared, lazily created compiler: a single instance keeps the
+        // in-memory compile cache warm across tasks, and nothing touches
+        // shaderc until a shader actually needs compiling
+        ShaderCompiler& AcquireShaderCompiler();
+
+        // Shader hot-reload: a dedicated watcher thread stats the source
+        // files off the update thread and debounces editor save bursts;
+        // Update() drains the change queue and schedules recompiles
+        void ShaderWatcherLoop();
+        void ScheduleShaderReloads(const std::vector<UUID>& changed);
 
         // Recursive lookup helpers (search under a root for matching files)
         std::filesystem::path FindFirstFileRecursive(const std::filesystem::path& root, const std::string& fileName) const;
@@ -192,10 +202,17 @@ namespace Vortex
         // Shader hot-reload tracking
         std::unordered_map<UUID, ShaderSourceInfo> m_ShaderSources;
         std::unordered_set<UUID> m_ShaderReloading;
-        double m_LastHotReloadCheckTime = 0.0;
-        double m_HotReloadIntervalSeconds = 0.5;
         bool m_ShaderHotReloadEnabled = true;
 
+        // Watcher thread state: the thread only reads path/mtime snapshots
+        // and pushes debounced ids into m_WatcherChanged; it never touches
+        // m_Assets directly
+        std::thread m_ShaderWatcherThread;
+        std::mutex m_WatcherMutex;
+        std::condition_variable m_WatcherCV;
+        bool m_WatcherRunning = false;
+        std::vector<UUID> m_WatcherChanged; // drained by Update()
+
         // Basic texture loader does not hot-reload yet
 
         // Delayed unload policy and state
@@ -215,6 +232,8 @@ namespace Vortex
         std::filesystem::path m_AssetPackPath;
         ShaderRef m_FallbackShader;
         bool m_FallbackInitialized = false;
+        std::unique_ptr<ShaderCompiler> m_ShaderCompiler;
+        std::mutex m_CompilerMutex;
         bool m_Initialized = false;
 
         // Asset loading helpers
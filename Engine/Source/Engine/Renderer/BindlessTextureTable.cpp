@@ -0,0 +1,116 @@
+#include "vxpch.h"
+#include "BindlessTextureTable.h"
+#include "RenderCommandQueue.h"
+#include "Core/Debug/Log.h"
+
+namespace Vortex
+{
+    BindlessTextureTable::~BindlessTextureTable()
+    {
+        Shutdown();
+    }
+
+    uint32_t BindlessTextureTable::Register(uint32_t texture, uint32_t sampler)
+    {
+        if (m_Unsupported)
+        {
+            return kInvalidIndex;
+        }
+
+        uint64_t handle = 0;
+        GetRenderCommandQueue().GetTextureHandle(texture, sampler, &handle, true);
+        if (handle == 0)
+        {
+            // Backend reported NotImplemented (no ARB_bindless_texture);
+            // remember so later registrations skip the round-trip
+            if (!m_Unsupported)
+            {
+                VX_CORE_WARN("BindlessTextureTable: bindless handles unavailable, callers should keep the slot path");
+                m_Unsupported = true;
+            }
+            return kInvalidIndex;
+        }
+
+        GetRenderCommandQueue().MakeTextureHandleResident(handle, true, true);
+
+        uint32_t index;
+        if (!m_FreeSlots.empty())
+        {
+            index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+            m_Handles[index] = handle;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_Handles.size());
+            m_Handles.push_back(handle);
+        }
+
+        m_Dirty = true;
+        return index;
+    }
+
+    void BindlessTextureTable::Unregister(uint32_t index)
+    {
+        if (index >= m_Handles.size() || m_Handles[index] == 0)
+        {
+            return;
+        }
+
+        GetRenderCommandQueue().MakeTextureHandleResident(m_Handles[index], false, true);
+        m_Handles[index] = 0;
+        m_FreeSlots.push_back(index);
+        m_Dirty = true;
+    }
+
+    void BindlessTextureTable::Upload()
+    {
+        if (!m_Dirty || m_Handles.empty())
+        {
+            return;
+        }
+
+        if (m_Buffer == 0)
+        {
+            GetRenderCommandQueue().GenBuffers(1, &m_Buffer, true);
+        }
+
+        const uint64_t sizeBytes = m_Handles.size() * sizeof(uint64_t);
+        GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer), m_Buffer);
+        GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer),
+            m_Handles.data(), sizeBytes, static_cast<uint32_t>(BufferUsage::DynamicDraw));
+        m_BufferCapacity = sizeBytes;
+        m_Dirty = false;
+    }
+
+    void BindlessTextureTable::Bind(uint32_t bindingPoint)
+    {
+        if (m_Buffer == 0)
+        {
+            return;
+        }
+        GetRenderCommandQueue().BindBufferBase(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer),
+            bindingPoint, m_Buffer);
+    }
+
+    void BindlessTextureTable::Shutdown()
+    {
+        for (uint64_t handle : m_Handles)
+        {
+            if (handle != 0)
+            {
+                GetRenderCommandQueue().MakeTextureHandleResident(handle, false, true);
+            }
+        }
+        m_Handles.clear();
+        m_FreeSlots.clear();
+
+        if (m_Buffer != 0)
+        {
+            GetRenderCommandQueue().DeleteBuffers(1, &m_Buffer, true);
+            m_Buffer = 0;
+        }
+        m_BufferCapacity = 0;
+        m_Dirty = false;
+    }
+}
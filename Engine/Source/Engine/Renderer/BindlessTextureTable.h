@@ -0,0 +1,81 @@
+#pragma once
+
+#include "RenderTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Vortex
+{
+    /**
+     * @brief Shared table of resident bindless texture handles
+     *
+     * Per-draw BindTexture calls are a driver round-trip each; with
+     * ARB_bindless_texture a texture registers once, its 64-bit handle is
+     * made resident, and shaders fetch it from a buffer instead of a
+     * texture unit. This table owns that buffer: Register stores the
+     * handle at a stable index, Upload pushes the table to an SSBO as a
+     * uvec2 array, and Bind exposes it at a binding point so a shader can
+     * do `sampler2D(handles[materialIndex])` (or index with gl_DrawID in
+     * multi-draw batches) with no binds in the draw loop.
+     *
+     * Register returns kInvalidIndex when the driver lacks
+     * ARB_bindless_texture; callers keep their slot-based path as the
+     * fallback. All methods must be called from the render thread, like
+     * the rest of the renderer's resource lifetime code.
+     */
+    class BindlessTextureTable
+    {
+    public:
+        static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+        BindlessTextureTable() = default;
+        ~BindlessTextureTable();
+
+        BindlessTextureTable(const BindlessTextureTable&) = delete;
+        BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+
+        /**
+         * @brief Register a texture and make its handle resident
+         * @param texture Texture object name
+         * @param sampler Sampler object name (0 for the texture's own state)
+         * @return Stable table index, or kInvalidIndex if bindless is unsupported
+         */
+        uint32_t Register(uint32_t texture, uint32_t sampler = 0);
+
+        /**
+         * @brief Drop a registered handle and recycle its index
+         *
+         * Makes the handle non-resident. The caller must ensure no
+         * in-flight draw still reads the slot.
+         */
+        void Unregister(uint32_t index);
+
+        /**
+         * @brief Upload the table to its SSBO if it changed since the last call
+         */
+        void Upload();
+
+        /**
+         * @brief Bind the handle SSBO to an indexed binding point
+         * @param bindingPoint SSBO binding the shaders declare the table at
+         */
+        void Bind(uint32_t bindingPoint);
+
+        /**
+         * @brief Make every handle non-resident and delete the SSBO
+         */
+        void Shutdown();
+
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_Handles.size()); }
+
+    private:
+        // Handles as the shader sees them: uvec2-compatible 64-bit values,
+        // contiguous so the whole table uploads in one BufferData
+        std::vector<uint64_t> m_Handles;
+        std::vector<uint32_t> m_FreeSlots;
+        uint32_t m_Buffer = 0;
+        uint64_t m_BufferCapacity = 0;
+        bool m_Dirty = false;
+        bool m_Unsupported = false;
+    };
+}
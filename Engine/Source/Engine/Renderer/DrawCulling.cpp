@@ -0,0 +1,93 @@
+#include "vxpch.h"
+#include "DrawCulling.h"
+#include "RenderCommandQueue.h"
+
+namespace Vortex
+{
+    Frustum Frustum::FromViewProjection(const glm::mat4& viewProjection)
+    {
+        // Gribb/Hartmann extraction: each plane is a sum/difference of the
+        // fourth row with one of the others (glm is column-major, so rows
+        // are gathered element-wise)
+        const glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+        const glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+        const glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+        const glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+        Frustum frustum;
+        frustum.Planes[Left]   = row3 + row0;
+        frustum.Planes[Right]  = row3 - row0;
+        frustum.Planes[Bottom] = row3 + row1;
+        frustum.Planes[Top]    = row3 - row1;
+        frustum.Planes[Near]   = row3 + row2;
+        frustum.Planes[Far]    = row3 - row2;
+
+        for (glm::vec4& plane : frustum.Planes)
+        {
+            const float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f)
+                plane /= length;
+        }
+        return frustum;
+    }
+
+    bool Frustum::Intersects(const AABB& bounds) const
+    {
+        // p-vertex test: against each plane, check only the box corner
+        // furthest along the plane normal; if that corner is behind the
+        // plane the whole box is
+        for (const glm::vec4& plane : Planes)
+        {
+            const glm::vec3 positive(
+                plane.x >= 0.0f ? bounds.Max.x : bounds.Min.x,
+                plane.y >= 0.0f ? bounds.Max.y : bounds.Min.y,
+                plane.z >= 0.0f ? bounds.Max.z : bounds.Min.z);
+
+            if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    size_t DrawListSubmitter::Submit(const DrawItem* items, size_t count, const Frustum& frustum)
+    {
+        if (!items || count == 0)
+            return 0;
+
+        m_Visible.clear();
+        m_Visible.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (frustum.Intersects(items[i].Bounds))
+                m_Visible.push_back(&items[i]);
+        }
+
+        if (m_Visible.empty())
+            return 0;
+
+        // Sorting by the caller's state key turns the bind stream into long
+        // same-state runs, so the filters below (and the bind cache behind
+        // the queue) drop most of the binds
+        std::sort(m_Visible.begin(), m_Visible.end(),
+            [](const DrawItem* a, const DrawItem* b) { return a->SortKey < b->SortKey; });
+
+        auto& queue = GetRenderCommandQueue();
+        uint32_t boundShader = 0;
+        uint32_t boundVAO = 0;
+        for (const DrawItem* item : m_Visible)
+        {
+            if (item->ShaderProgram != boundShader)
+            {
+                queue.BindShader(item->ShaderProgram);
+                boundShader = item->ShaderProgram;
+            }
+            if (item->VertexArray != boundVAO)
+            {
+                queue.BindVertexArray(item->VertexArray);
+                boundVAO = item->VertexArray;
+            }
+            queue.DrawIndexed(item->IndexCount, item->InstanceCount, item->FirstIndex, item->BaseVertex);
+        }
+        return m_Visible.size();
+    }
+}
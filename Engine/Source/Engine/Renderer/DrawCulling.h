@@ -0,0 +1,103 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Vortex
+{
+    /**
+     * @brief Axis-aligned bounding box in world space
+     */
+    struct AABB
+    {
+        glm::vec3 Min{ 0.0f };
+        glm::vec3 Max{ 0.0f };
+    };
+
+    /**
+     * @brief View frustum as six inward-facing planes
+     *
+     * Planes are stored as (a, b, c, d) with the normal pointing into the
+     * frustum, so a point is inside when dot(normal, p) + d >= 0 for all six.
+     */
+    struct Frustum
+    {
+        enum PlaneIndex : uint32_t
+        {
+            Left = 0, Right, Bottom, Top, Near, Far,
+            PlaneCount
+        };
+
+        glm::vec4 Planes[PlaneCount];
+
+        /**
+         * @brief Extract and normalize the six planes from a view-projection matrix
+         * @param viewProjection Combined view * projection matrix
+         * @return Frustum ready for intersection tests
+         */
+        static Frustum FromViewProjection(const glm::mat4& viewProjection);
+
+        /**
+         * @brief Test an AABB against the frustum
+         * @param bounds Box to test
+         * @return False only when the box is fully outside some plane
+         */
+        bool Intersects(const AABB& bounds) const;
+    };
+
+    /**
+     * @brief One culling-aware draw: bounds, state sort key, and draw params
+     *
+     * SortKey is caller-defined; packing the pipeline state keys (see
+     * PackDepthState and friends in RendererAPI.h) into the high bits groups
+     * draws so the bind filters below see long same-state runs.
+     */
+    struct DrawItem
+    {
+        AABB Bounds;
+        uint64_t SortKey = 0;
+
+        uint32_t ShaderProgram = 0;
+        uint32_t VertexArray = 0;
+        uint32_t IndexCount = 0;
+        uint32_t InstanceCount = 1;
+        uint32_t FirstIndex = 0;
+        int32_t BaseVertex = 0;
+    };
+
+    /**
+     * @brief Frustum-culls a draw list and submits the survivors in sorted order
+     *
+     * The per-draw path (queue, vtable, driver) is where submission cost
+     * lives, so work that cannot be seen should never reach it. Submit
+     * tests every item's AABB against the frustum, sorts the visible set by
+     * SortKey, skips redundant shader/VAO binds between consecutive draws,
+     * and records the rest into the global render command queue.
+     *
+     * Holds its scratch buffers across calls; use one instance per
+     * recording thread, like the other render-thread helpers.
+     */
+    class DrawListSubmitter
+    {
+    public:
+        DrawListSubmitter() = default;
+
+        DrawListSubmitter(const DrawListSubmitter&) = delete;
+        DrawListSubmitter& operator=(const DrawListSubmitter&) = delete;
+
+        /**
+         * @brief Cull, sort, and submit a draw list
+         * @param items Draw items to consider
+         * @param count Number of items
+         * @param frustum Frustum to cull against
+         * @return Number of draws that survived culling and were submitted
+         */
+        size_t Submit(const DrawItem* items, size_t count, const Frustum& frustum);
+
+    private:
+        // Survivors of the cull pass, sorted by SortKey before submission
+        std::vector<const DrawItem*> m_Visible;
+    };
+}
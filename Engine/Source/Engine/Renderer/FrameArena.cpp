@@ -0,0 +1,46 @@
+#include "vxpch.h"
+#include "FrameArena.h"
+
+#include <cstring>
+
+namespace Vortex
+{
+    FrameArena::FrameArena(size_t capacity)
+        : m_Buffer(std::make_unique<std::byte[]>(capacity))
+        , m_Capacity(capacity)
+    {
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment) noexcept
+    {
+        if (size == 0 || size > m_Capacity)
+            return nullptr;
+
+        // Over-reserve by the alignment slack, then align within the slice;
+        // the base buffer is max_align_t-aligned so smaller alignments only
+        // ever shift forward
+        const size_t worst = size + alignment - 1;
+        const size_t offset = m_Head.fetch_add(worst, std::memory_order_relaxed);
+        if (offset + worst > m_Capacity)
+        {
+            // Leave m_Head past the end; further allocations keep failing
+            // until Reset, and GetUsed clamps for reporting
+            return nullptr;
+        }
+
+        const uintptr_t raw = reinterpret_cast<uintptr_t>(m_Buffer.get()) + offset;
+        const uintptr_t aligned = (raw + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    const char* FrameArena::AllocateString(std::string_view text) noexcept
+    {
+        char* copy = static_cast<char*>(Allocate(text.size() + 1, alignof(char)));
+        if (!copy)
+            return nullptr;
+
+        std::memcpy(copy, text.data(), text.size());
+        copy[text.size()] = '\0';
+        return copy;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace Vortex
+{
+    /**
+     * @brief Per-frame linear allocator for transient render-thread data
+     *
+     * Debug-group names and similar short-lived strings otherwise hit the
+     * general allocator once per use. The arena hands out memory with a
+     * single atomic pointer bump (safe for the multi-threaded recording
+     * paths) and reclaims everything in one Reset at the frame boundary -
+     * no destructors, no frees. Allocations are only valid until the next
+     * Reset; anything that must outlive the frame belongs on the heap.
+     *
+     * Allocate returns nullptr when the arena is exhausted so callers can
+     * fall back to owned storage instead of failing.
+     */
+    class FrameArena
+    {
+    public:
+        static constexpr size_t kDefaultCapacity = 256 * 1024;
+
+        explicit FrameArena(size_t capacity = kDefaultCapacity);
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief Bump-allocate a block
+         * @param size Bytes to allocate
+         * @param alignment Required alignment (power of two)
+         * @return Pointer into the arena, or nullptr when exhausted
+         */
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept;
+
+        /**
+         * @brief Copy a string into the arena (NUL-terminated)
+         * @param text String to copy
+         * @return Arena-resident copy, or nullptr when exhausted
+         */
+        const char* AllocateString(std::string_view text) noexcept;
+
+        /**
+         * @brief Reclaim the whole arena; invalidates every prior allocation
+         */
+        void Reset() noexcept { m_Head.store(0, std::memory_order_relaxed); }
+
+        size_t GetUsed() const noexcept
+        {
+            const size_t head = m_Head.load(std::memory_order_relaxed);
+            return head < m_Capacity ? head : m_Capacity;
+        }
+        size_t GetCapacity() const noexcept { return m_Capacity; }
+
+    private:
+        std::unique_ptr<std::byte[]> m_Buffer;
+        size_t m_Capacity = 0;
+        std::atomic<size_t> m_Head{ 0 };
+    };
+}
@@ -12,33 +12,18 @@
 
 namespace Vortex
 {
-    namespace
-    {
-        // Global graphics API selection (defaults to OpenGL on desktop if available)
-        static GraphicsAPI s_CurrentGraphicsAPI =
-        #if defined(VX_OPENGL_SUPPORT)
-            GraphicsAPI::OpenGL;
-        #else
-            GraphicsAPI::None;
-        #endif
-    }
-
     // -----------------------------------------------------------------------------
     // Global API selection helpers
     // -----------------------------------------------------------------------------
-
-    GraphicsAPI GetGraphicsAPI()
-    {
-        return s_CurrentGraphicsAPI;
-    }
+    // The getter is inline in the header; only the logging setter lives here
 
     void SetGraphicsAPI(GraphicsAPI api)
     {
-        if (s_CurrentGraphicsAPI == api)
+        if (detail::g_CurrentGraphicsAPI == api)
             return;
 
         VX_CORE_INFO("Graphics API set to {}", GraphicsAPIToString(api));
-        s_CurrentGraphicsAPI = api;
+        detail::g_CurrentGraphicsAPI = api;
     }
 
     const char* GraphicsAPIToString(GraphicsAPI api)
@@ -68,6 +53,44 @@ namespace Vortex
         }
     }
 
+    const char* SwapchainPolicyToString(SwapchainPolicy policy)
+    {
+        switch (policy)
+        {
+            case SwapchainPolicy::AlwaysDouble: return "AlwaysDouble";
+            case SwapchainPolicy::AlwaysTriple: return "AlwaysTriple";
+            case SwapchainPolicy::Dynamic:      return "Dynamic";
+            default:                            return "Unknown";
+        }
+    }
+
+    VSyncMode GraphicsContext::PickTripleBufferedMode() const
+    {
+        // Preference order mirrors how close each mode gets to a real
+        // three-image swapchain: Mailbox is the genuine article where the
+        // platform offers it, Fast/Adaptive at least stop the swap from
+        // blocking a late frame
+        const auto supported = GetSupportedVSyncModes();
+        for (VSyncMode candidate : { VSyncMode::Mailbox, VSyncMode::Fast, VSyncMode::Adaptive })
+        {
+            if (std::find(supported.begin(), supported.end(), candidate) != supported.end())
+                return candidate;
+        }
+        return VSyncMode::Enabled;
+    }
+
+    Result<void> GraphicsContext::SetSwapchainBufferPolicy(SwapchainPolicy policy)
+    {
+        m_SwapchainPolicy = policy;
+
+        // Dynamic starts in the healthy (double-buffered) state; the
+        // presentation manager toggles it per-frame from Present timing
+        const VSyncMode mode = (policy == SwapchainPolicy::AlwaysTriple)
+            ? PickTripleBufferedMode()
+            : VSyncMode::Enabled;
+        return SetVSyncMode(mode);
+    }
+
     VSyncMode StringToVSyncMode(const std::string& modeStr)
     {
         std::string lowerStr = modeStr;
@@ -100,13 +123,13 @@ namespace Vortex
         // For OpenGL (current supported backend), the OpenGLGraphicsContext requires an SDL_Window*.
         // Preferred flow is: create window -> construct API-specific context with the window -> Initialize(props).
 #ifdef VX_OPENGL_SUPPORT
-        if (s_CurrentGraphicsAPI == GraphicsAPI::OpenGL)
+        if (GetGraphicsAPI() == GraphicsAPI::OpenGL)
         {
             VX_CORE_WARN("GraphicsContext::Create() called without a window handle. Returning nullptr.");
             return nullptr;
         }
 #endif
-        VX_CORE_ERROR("GraphicsContext::Create() not implemented for API: {}", GraphicsAPIToString(s_CurrentGraphicsAPI));
+        VX_CORE_ERROR("GraphicsContext::Create() not implemented for API: {}", GraphicsAPIToString(GetGraphicsAPI()));
         return nullptr;
     }
 }
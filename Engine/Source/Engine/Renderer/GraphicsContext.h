@@ -29,6 +29,24 @@ namespace Vortex
         Mailbox          ///< Mailbox mode - triple buffering (Vulkan-specific, maps to Enabled for others)
     };
 
+    /**
+     * @brief Presentation buffering policy
+     *
+     * Double buffering gives the lowest latency when frames finish on time;
+     * triple buffering keeps the pipeline fed when they don't. Dynamic asks
+     * the presentation manager to measure frame time against the refresh
+     * interval and pick per-frame. On OpenGL there is no real image-count
+     * control, so the policy maps onto VSync modes: double = blocking swap,
+     * triple = a non-blocking mode (Mailbox/Fast/Adaptive, whichever the
+     * driver supports).
+     */
+    enum class SwapchainPolicy : uint8_t
+    {
+        AlwaysDouble = 0,   ///< Blocking swap - lowest latency, stalls on late frames
+        AlwaysTriple,       ///< Non-blocking swap - extra frame of latency, no stalls
+        Dynamic             ///< Toggle between the two based on last frame's timing
+    };
+
     /**
      * @brief Graphics context properties for initialization
      */
@@ -158,6 +176,30 @@ namespace Vortex
          */
         virtual std::vector<VSyncMode> GetSupportedVSyncModes() const = 0;
 
+        /**
+         * @brief Set the presentation buffering policy
+         * @param policy Buffering policy to apply
+         * @return Success/failure result
+         *
+         * The default implementation maps the policy onto VSync modes
+         * (see SwapchainPolicy). Backends with real swapchain image-count
+         * control can override. Callers running with VSync disabled should
+         * not apply a policy - there is nothing to pace against.
+         */
+        virtual Result<void> SetSwapchainBufferPolicy(SwapchainPolicy policy);
+
+        /**
+         * @brief Get the current presentation buffering policy
+         * @return Active swapchain policy
+         */
+        SwapchainPolicy GetSwapchainBufferPolicy() const { return m_SwapchainPolicy; }
+
+        /**
+         * @brief Pick the VSync mode this context uses for triple-buffered presents
+         * @return First supported of Mailbox/Fast/Adaptive, or Enabled as fallback
+         */
+        VSyncMode PickTripleBufferedMode() const;
+
         /**
          * @brief Get information about the graphics context capabilities
          * @return Context information structure
@@ -196,14 +238,29 @@ namespace Vortex
     protected:
         GraphicsContextProps m_Props;
         GraphicsContextInfo m_Info;
+        SwapchainPolicy m_SwapchainPolicy = SwapchainPolicy::AlwaysDouble;
     };
 
 
+    namespace detail
+    {
+        // Storage for the process-wide API selection. Read through
+        // GetGraphicsAPI(); written only by SetGraphicsAPI(), which logs
+        // the change. Lives in the header so the getter inlines to a plain
+        // load in hot creation paths (shader/texture factories).
+        inline GraphicsAPI g_CurrentGraphicsAPI =
+        #if defined(VX_OPENGL_SUPPORT)
+            GraphicsAPI::OpenGL;
+        #else
+            GraphicsAPI::None;
+        #endif
+    }
+
     /**
      * @brief Get the currently selected graphics API
      * @return The active graphics API
      */
-    GraphicsAPI GetGraphicsAPI();
+    inline GraphicsAPI GetGraphicsAPI() { return detail::g_CurrentGraphicsAPI; }
 
     /**
      * @brief Set the graphics API to use (must be called before context creation)
@@ -225,6 +282,13 @@ namespace Vortex
      */
     const char* VSyncModeToString(VSyncMode mode);
 
+    /**
+     * @brief Convert SwapchainPolicy enum to string for debugging
+     * @param policy The swapchain policy enum value
+     * @return String representation of the policy
+     */
+    const char* SwapchainPolicyToString(SwapchainPolicy policy);
+
     /**
      * @brief Convert string to VSyncMode enum
      * @param modeStr String representation of VSync mode
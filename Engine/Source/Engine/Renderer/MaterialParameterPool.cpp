@@ -0,0 +1,137 @@
+#include "vxpch.h"
+#include "MaterialParameterPool.h"
+#include "RenderCommandQueue.h"
+#include "Core/Debug/Log.h"
+
+namespace Vortex
+{
+    namespace
+    {
+        // std430 rounds struct members up to vec4 boundaries, so ranges are
+        // handed out in 16-byte steps; that also keeps recycled ranges
+        // interchangeable between materials of similar size
+        constexpr uint32_t kRangeAlignment = 16;
+
+        constexpr uint32_t AlignUp(uint32_t value)
+        {
+            return (value + (kRangeAlignment - 1)) & ~(kRangeAlignment - 1);
+        }
+    }
+
+    MaterialParameterPool::~MaterialParameterPool()
+    {
+        Shutdown();
+    }
+
+    uint32_t MaterialParameterPool::Allocate(uint32_t sizeBytes)
+    {
+        if (sizeBytes == 0)
+        {
+            return kInvalidOffset;
+        }
+        const uint32_t size = AlignUp(sizeBytes);
+
+        // First-fit over recycled ranges; material blocks cluster around a
+        // few sizes, so an exact or near fit shows up early
+        for (size_t i = 0; i < m_FreeRanges.size(); ++i)
+        {
+            FreeRange& range = m_FreeRanges[i];
+            if (range.Size < size)
+            {
+                continue;
+            }
+            const uint32_t offset = range.Offset;
+            range.Offset += size;
+            range.Size -= size;
+            if (range.Size == 0)
+            {
+                m_FreeRanges[i] = m_FreeRanges.back();
+                m_FreeRanges.pop_back();
+            }
+            return offset;
+        }
+
+        const uint32_t offset = static_cast<uint32_t>(m_Shadow.size());
+        m_Shadow.resize(m_Shadow.size() + size, 0);
+        return offset;
+    }
+
+    void MaterialParameterPool::Free(uint32_t offset, uint32_t sizeBytes)
+    {
+        if (sizeBytes == 0 || offset + AlignUp(sizeBytes) > m_Shadow.size())
+        {
+            return;
+        }
+        m_FreeRanges.push_back({ offset, AlignUp(sizeBytes) });
+    }
+
+    void MaterialParameterPool::Write(uint32_t offset, const void* data, uint32_t sizeBytes)
+    {
+        if (data == nullptr || sizeBytes == 0 || offset + sizeBytes > m_Shadow.size()) [[unlikely]]
+        {
+            VX_CORE_WARN("MaterialParameterPool: rejected out-of-range write ({} bytes at offset {})", sizeBytes, offset);
+            return;
+        }
+
+        std::memcpy(m_Shadow.data() + offset, data, sizeBytes);
+        m_DirtyMin = std::min(m_DirtyMin, offset);
+        m_DirtyMax = std::max(m_DirtyMax, offset + sizeBytes);
+    }
+
+    void MaterialParameterPool::Upload()
+    {
+        if (m_DirtyMax <= m_DirtyMin || m_Shadow.empty())
+        {
+            return;
+        }
+
+        if (m_Buffer == 0)
+        {
+            GetRenderCommandQueue().GenBuffers(1, &m_Buffer, true);
+        }
+
+        GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer), m_Buffer);
+        if (m_Shadow.size() > m_BufferCapacity)
+        {
+            // Pool grew: re-specify the whole buffer, which also covers the
+            // dirty span
+            GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer),
+                m_Shadow.data(), m_Shadow.size(), static_cast<uint32_t>(BufferUsage::DynamicDraw));
+            m_BufferCapacity = m_Shadow.size();
+        }
+        else
+        {
+            GetRenderCommandQueue().BufferSubData(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer),
+                m_DirtyMin, m_Shadow.data() + m_DirtyMin, m_DirtyMax - m_DirtyMin);
+        }
+
+        m_DirtyMin = 0xFFFFFFFFu;
+        m_DirtyMax = 0;
+    }
+
+    void MaterialParameterPool::Bind(uint32_t bindingPoint)
+    {
+        if (m_Buffer == 0)
+        {
+            return;
+        }
+        GetRenderCommandQueue().BindBufferBase(static_cast<uint32_t>(BufferTarget::ShaderStorageBuffer),
+            bindingPoint, m_Buffer);
+    }
+
+    void MaterialParameterPool::Shutdown()
+    {
+        m_Shadow.clear();
+        m_Shadow.shrink_to_fit();
+        m_FreeRanges.clear();
+
+        if (m_Buffer != 0)
+        {
+            GetRenderCommandQueue().DeleteBuffers(1, &m_Buffer, true);
+            m_Buffer = 0;
+        }
+        m_BufferCapacity = 0;
+        m_DirtyMin = 0xFFFFFFFFu;
+        m_DirtyMax = 0;
+    }
+}
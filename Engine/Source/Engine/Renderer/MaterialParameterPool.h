@@ -0,0 +1,94 @@
+#pragma once
+
+#include "RenderTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Vortex
+{
+    /**
+     * @brief Shared SSBO pool for per-material shader parameters
+     *
+     * Driving material data through per-draw SetUniform calls costs a
+     * driver round-trip per parameter per draw. This pool keeps every
+     * material's parameter block in one buffer instead: Allocate hands out
+     * a stable byte range, Write copies new values into a CPU shadow while
+     * widening a dirty range, Upload pushes the coalesced dirty span in a
+     * single buffer update, and Bind exposes the whole pool at one SSBO
+     * binding. Shaders then index it with a 4-byte material offset (a
+     * plain uniform, or gl_DrawID in multi-draw batches), so the draw loop
+     * issues one bind per frame regardless of material count.
+     *
+     * Offsets are 16-byte aligned to match std430 vec4 packing. All
+     * methods must be called from the render thread, like the rest of the
+     * renderer's resource lifetime code.
+     */
+    class MaterialParameterPool
+    {
+    public:
+        static constexpr uint32_t kInvalidOffset = 0xFFFFFFFFu;
+
+        MaterialParameterPool() = default;
+        ~MaterialParameterPool();
+
+        MaterialParameterPool(const MaterialParameterPool&) = delete;
+        MaterialParameterPool& operator=(const MaterialParameterPool&) = delete;
+
+        /**
+         * @brief Reserve a byte range for one material's parameters
+         * @param sizeBytes Size of the material's parameter block
+         * @return Stable byte offset into the pool, or kInvalidOffset
+         */
+        uint32_t Allocate(uint32_t sizeBytes);
+
+        /**
+         * @brief Return a range to the pool for reuse
+         *
+         * The caller must ensure no in-flight draw still reads the range.
+         */
+        void Free(uint32_t offset, uint32_t sizeBytes);
+
+        /**
+         * @brief Copy new parameter bytes into a material's range
+         * @param offset Range offset returned by Allocate
+         * @param data Source bytes
+         * @param sizeBytes Byte count; offset + sizeBytes must stay inside
+         *                  the allocated range
+         */
+        void Write(uint32_t offset, const void* data, uint32_t sizeBytes);
+
+        /**
+         * @brief Upload the coalesced dirty span if anything changed
+         */
+        void Upload();
+
+        /**
+         * @brief Bind the pool SSBO to an indexed binding point
+         * @param bindingPoint SSBO binding the shaders declare the pool at
+         */
+        void Bind(uint32_t bindingPoint);
+
+        /**
+         * @brief Release the CPU shadow and delete the SSBO
+         */
+        void Shutdown();
+
+        uint32_t GetSize() const { return static_cast<uint32_t>(m_Shadow.size()); }
+
+    private:
+        struct FreeRange
+        {
+            uint32_t Offset;
+            uint32_t Size;
+        };
+
+        // CPU shadow of the whole pool; Upload diffs against the GPU copy
+        // only through the dirty span, so untouched materials cost nothing
+        std::vector<uint8_t> m_Shadow;
+        std::vector<FreeRange> m_FreeRanges;
+        uint32_t m_Buffer = 0;
+        uint64_t m_BufferCapacity = 0;
+        uint32_t m_DirtyMin = 0xFFFFFFFFu;
+        uint32_t m_DirtyMax = 0;
+    };
+}
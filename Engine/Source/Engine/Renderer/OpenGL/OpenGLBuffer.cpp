@@ -53,8 +53,10 @@ namespace Vortex
     void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
     {
         GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), m_RendererID);
+        // SetData callers rewrite the whole buffer each frame, so hint the
+        // backend to stage the bytes through its persistent upload ring
         GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::ArrayBuffer), data, size,
-            static_cast<uint32_t>(BufferUsage::DynamicDraw));
+            static_cast<uint32_t>(BufferUsage::TransientPerFrame));
     }
 
     // ------------------------- OpenGLIndexBuffer -------------------------
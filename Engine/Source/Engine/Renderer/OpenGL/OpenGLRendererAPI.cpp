@@ -11,6 +11,8 @@
 #include <glad/gl.h>
 #include <glm/glm.hpp>
 
+#include <cstring>
+
 namespace Vortex
 {
     // ============================================================================
@@ -69,6 +71,7 @@ namespace Vortex
     // ============================================================================
 
     OpenGLRendererAPI::OpenGLRendererAPI()
+        : RendererAPI(GraphicsAPI::OpenGL, "OpenGL")
     {
         VX_CORE_INFO("OpenGL RendererAPI created");
     }
@@ -104,7 +107,8 @@ namespace Vortex
 
         #ifdef VX_USE_SDL
             // Validate that the provided GraphicsContext is actually an OpenGLGraphicsContext
-            oglCtx = dynamic_cast<SDL_OpenGLGraphicsContext*>(context);
+            m_SDLContext = dynamic_cast<SDL_OpenGLGraphicsContext*>(context);
+            oglCtx = m_SDLContext;
 
             if (!oglCtx)
             {
@@ -145,6 +149,10 @@ namespace Vortex
         glCullFace(GL_BACK);
         glFrontFace(GL_CCW);
 
+        // The base class state-delta cache may hold values from a previous
+        // context; force the next Set*State calls through to GL
+        InvalidateStateCache();
+
         m_Initialized = true;
         VX_CORE_INFO("OpenGL RendererAPI initialized successfully");
 
@@ -161,9 +169,34 @@ namespace Vortex
 
         VX_CORE_INFO("Shutting down OpenGL RendererAPI");
 
+        DestroyTransientRing();
+
+        // Delete baked vertex layouts and drop the base class dedup cache
+        if (!m_LayoutVAOs.empty())
+        {
+            glDeleteVertexArrays(static_cast<GLsizei>(m_LayoutVAOs.size()), reinterpret_cast<const GLuint*>(m_LayoutVAOs.data()));
+            m_LayoutVAOs.clear();
+        }
+        ClearVertexLayoutCache();
+
+        // Return unhanded pooled names to the driver
+        if (!m_BufferNamePool.empty())
+        {
+            glDeleteBuffers(static_cast<GLsizei>(m_BufferNamePool.size()), reinterpret_cast<const GLuint*>(m_BufferNamePool.data()));
+            m_BufferNamePool.clear();
+        }
+        if (!m_TextureNamePool.empty())
+        {
+            glDeleteTextures(static_cast<GLsizei>(m_TextureNamePool.size()), reinterpret_cast<const GLuint*>(m_TextureNamePool.data()));
+            m_TextureNamePool.clear();
+        }
+
         // Reset state
         m_CurrentState = {};
         m_GraphicsContext = nullptr;
+        #ifdef VX_USE_SDL
+            m_SDLContext = nullptr;
+        #endif
         m_Initialized = false;
 
         VX_CORE_INFO("OpenGL RendererAPI shutdown complete");
@@ -174,7 +207,7 @@ namespace Vortex
     // Basic Rendering Operations
     // ============================================================================
 
-    Result<void> OpenGLRendererAPI::Clear(uint32_t flags, const glm::vec4& color, float depth, int32_t stencil)
+    Result<void> OpenGLRendererAPI::Clear(uint32_t flags, glm::vec4 color, float depth, int32_t stencil)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -389,9 +422,9 @@ namespace Vortex
             return validateResult;
         }
 
-        // For modern OpenGL, we'd use glVertexArrayVertexBuffer
-        // For now, use legacy binding
-        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        // Bind to the VAO binding point (GL 4.3 separated format/binding);
+        // attribute formats set via VertexAttribFormat stay untouched
+        glBindVertexBuffer(binding, buffer, static_cast<GLintptr>(offset), static_cast<GLsizei>(stride));
 
         if (!CheckGLError("BindVertexBuffer"))
         {
@@ -401,6 +434,50 @@ namespace Vortex
         return Result<void>();
     }
 
+    Result<void> OpenGLRendererAPI::BindVertexBuffers(uint32_t first, uint32_t count, const uint32_t* buffers,
+                                                      const uint64_t* offsets, const uint64_t* strides)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (GLAD_GL_VERSION_4_4)
+        {
+            // glBindVertexBuffers wants GLintptr/GLsizei arrays; convert on the
+            // stack (binding points are capped well below this in practice)
+            constexpr uint32_t kMaxBindings = 16;
+            GLintptr glOffsets[kMaxBindings];
+            GLsizei  glStrides[kMaxBindings];
+            while (count > 0)
+            {
+                const uint32_t n = count < kMaxBindings ? count : kMaxBindings;
+                for (uint32_t i = 0; i < n; ++i)
+                {
+                    glOffsets[i] = static_cast<GLintptr>(offsets[i]);
+                    glStrides[i] = static_cast<GLsizei>(strides[i]);
+                }
+                glBindVertexBuffers(first, static_cast<GLsizei>(n), buffers, glOffsets, glStrides);
+                first += n; buffers += n; offsets += n; strides += n; count -= n;
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                glBindVertexBuffer(first + i, buffers[i], static_cast<GLintptr>(offsets[i]),
+                                   static_cast<GLsizei>(strides[i]));
+            }
+        }
+
+        if (!CheckGLError("BindVertexBuffers"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to bind vertex buffers");
+        }
+        return Result<void>();
+    }
+
     Result<void> OpenGLRendererAPI::BindIndexBuffer(uint32_t buffer, uint32_t indexType, uint64_t offset)
     {
         auto validateResult = ValidateContext();
@@ -449,6 +526,12 @@ namespace Vortex
             return validateResult;
         }
 
+        if (static_cast<BufferUsage>(usage) == BufferUsage::TransientPerFrame &&
+            TryTransientUpload(ConvertBufferTarget(target), data, size))
+        {
+            return Result<void>();
+        }
+
         glBufferData(ConvertBufferTarget(target), static_cast<GLsizeiptr>(size), data, ConvertBufferUsage(usage));
 
         if (!CheckGLError("BufferData"))
@@ -459,6 +542,137 @@ namespace Vortex
         return Result<void>();
     }
 
+    bool OpenGLRendererAPI::EnsureTransientRing()
+    {
+        if (m_TransientRing != 0)
+        {
+            return true;
+        }
+        if (m_TransientRingUnavailable)
+        {
+            return false;
+        }
+        if (!(GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage))
+        {
+            m_TransientRingUnavailable = true;
+            return false;
+        }
+
+        GLuint ring = 0;
+        glGenBuffers(1, &ring);
+        glBindBuffer(GL_COPY_READ_BUFFER, ring);
+        glBufferStorage(GL_COPY_READ_BUFFER, static_cast<GLsizeiptr>(kTransientRingSize), nullptr,
+                        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT);
+        // Explicit flushes instead of coherent mapping, matching the
+        // Renderer2D instance ring: one range flush per upload beats
+        // write-combined coherent traffic for multi-KB copies
+        void* mapped = glMapBufferRange(GL_COPY_READ_BUFFER, 0, static_cast<GLsizeiptr>(kTransientRingSize),
+                                        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        if (!CheckGLError("EnsureTransientRing") || mapped == nullptr)
+        {
+            glDeleteBuffers(1, &ring);
+            m_TransientRingUnavailable = true;
+            VX_CORE_WARN("OpenGLRendererAPI: Transient upload ring unavailable, falling back to glBufferData");
+            return false;
+        }
+
+        m_TransientRing = ring;
+        m_TransientRingPtr = static_cast<uint8_t*>(mapped);
+        m_TransientHead = 0;
+        m_TransientSection = 0;
+        return true;
+    }
+
+    bool OpenGLRendererAPI::TryTransientUpload(uint32_t target, const void* data, uint64_t size)
+    {
+        constexpr uint64_t kSectionSize = kTransientRingSize / kTransientRingSections;
+
+        // The ring itself lives on GL_COPY_READ_BUFFER during the copy, so
+        // uploads targeting that binding take the plain path
+        if (data == nullptr || size == 0 || size > kSectionSize || target == GL_COPY_READ_BUFFER)
+        {
+            return false;
+        }
+        if (!EnsureTransientRing())
+        {
+            return false;
+        }
+
+        uint64_t head = (m_TransientHead + (kTransientAlignment - 1)) & ~(kTransientAlignment - 1);
+        const uint64_t sectionEnd = (static_cast<uint64_t>(m_TransientSection) + 1) * kSectionSize;
+        if (head + size > sectionEnd)
+        {
+            // Leaving the current section: fence it so the wrap below knows
+            // when the GPU is done reading it, then move to the next one
+            if (m_TransientFences[m_TransientSection] != 0)
+            {
+                glDeleteSync(reinterpret_cast<GLsync>(m_TransientFences[m_TransientSection]));
+            }
+            m_TransientFences[m_TransientSection] =
+                reinterpret_cast<uint64_t>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+            m_TransientSection = (m_TransientSection + 1) % kTransientRingSections;
+            head = static_cast<uint64_t>(m_TransientSection) * kSectionSize;
+
+            // With three sections this wait almost never fires: the GPU is
+            // two frames behind at most before we reuse a section
+            if (m_TransientFences[m_TransientSection] != 0)
+            {
+                GLsync fence = reinterpret_cast<GLsync>(m_TransientFences[m_TransientSection]);
+                glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~uint64_t(0));
+                glDeleteSync(fence);
+                m_TransientFences[m_TransientSection] = 0;
+            }
+        }
+
+        std::memcpy(m_TransientRingPtr + head, data, size);
+
+        glBindBuffer(GL_COPY_READ_BUFFER, m_TransientRing);
+        glFlushMappedBufferRange(GL_COPY_READ_BUFFER, static_cast<GLintptr>(head), static_cast<GLsizeiptr>(size));
+
+        // Orphan the destination store like glBufferData would, then fill it
+        // GPU-side; the CPU never waits on the destination buffer
+        glBufferData(target, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, target, static_cast<GLintptr>(head), 0,
+                            static_cast<GLsizeiptr>(size));
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        if (!CheckGLError("TryTransientUpload"))
+        {
+            return false;
+        }
+
+        m_TransientHead = head + size;
+        return true;
+    }
+
+    void OpenGLRendererAPI::DestroyTransientRing()
+    {
+        for (uint64_t& fence : m_TransientFences)
+        {
+            if (fence != 0)
+            {
+                glDeleteSync(reinterpret_cast<GLsync>(fence));
+                fence = 0;
+            }
+        }
+
+        if (m_TransientRing != 0)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, m_TransientRing);
+            glUnmapBuffer(GL_COPY_READ_BUFFER);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glDeleteBuffers(1, &m_TransientRing);
+            m_TransientRing = 0;
+        }
+        m_TransientRingPtr = nullptr;
+        m_TransientHead = 0;
+        m_TransientSection = 0;
+        m_TransientRingUnavailable = false;
+    }
+
     Result<void> OpenGLRendererAPI::BufferStorage(uint32_t target, uint64_t size, uint32_t flags)
     {
         auto validateResult = ValidateContext();
@@ -523,6 +737,21 @@ namespace Vortex
         return Result<void>();
     }
 
+    Result<void> OpenGLRendererAPI::FlushMappedBufferRange(uint32_t target, uint64_t offset, uint64_t length)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+        glFlushMappedBufferRange(ConvertBufferTarget(target), static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(length));
+        if (!CheckGLError("FlushMappedBufferRange"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to flush mapped buffer range");
+        }
+        return Result<void>();
+    }
+
     Result<void> OpenGLRendererAPI::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
     {
         auto validateResult = ValidateContext();
@@ -541,6 +770,270 @@ namespace Vortex
         return Result<void>();
     }
 
+    Result<void> OpenGLRendererAPI::BindBuffersBase(uint32_t target, uint32_t first, uint32_t count,
+                                                    const uint32_t* buffers)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (GLAD_GL_VERSION_4_4)
+        {
+            glBindBuffersBase(ConvertBufferTarget(target), first, static_cast<GLsizei>(count), buffers);
+        }
+        else
+        {
+            const GLenum glTarget = ConvertBufferTarget(target);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                glBindBufferBase(glTarget, first + i, buffers[i]);
+            }
+        }
+
+        if (!CheckGLError("BindBuffersBase"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to bind buffer bases");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer,
+                                                    uint64_t offset, uint64_t size)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        glBindBufferRange(ConvertBufferTarget(target), index, buffer,
+                          static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+
+        if (!CheckGLError("BindBufferRange"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to bind buffer range");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, uint64_t readOffset, uint64_t writeOffset, uint64_t size)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        glCopyBufferSubData(ConvertBufferTarget(readTarget), ConvertBufferTarget(writeTarget),
+                            static_cast<GLintptr>(readOffset), static_cast<GLintptr>(writeOffset),
+                            static_cast<GLsizeiptr>(size));
+
+        if (!CheckGLError("CopyBufferSubData"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to copy buffer sub data");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::DrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_0 || GLAD_GL_ARB_draw_indirect))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Indirect draw requires GL 4.0 / ARB_draw_indirect");
+        }
+
+        glDrawArraysIndirect(ConvertPrimitiveTopology(primitiveTopology),
+                             reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)));
+
+        if (!CheckGLError("DrawArraysIndirect"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to draw arrays indirect");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::DrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_0 || GLAD_GL_ARB_draw_indirect))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Indirect draw requires GL 4.0 / ARB_draw_indirect");
+        }
+
+        // Index type follows the currently bound index buffer, same as DrawIndexed
+        const GLenum glIndexType = (m_CurrentState.CurrentIndexType == INDEX_TYPE_UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        glDrawElementsIndirect(ConvertPrimitiveTopology(primitiveTopology),
+                               glIndexType,
+                               reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)));
+
+        if (!CheckGLError("DrawElementsIndirect"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to draw elements indirect");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::MultiDrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Multi-draw indirect requires GL 4.3 / ARB_multi_draw_indirect");
+        }
+
+        glMultiDrawArraysIndirect(ConvertPrimitiveTopology(primitiveTopology),
+                                  reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)),
+                                  static_cast<GLsizei>(drawCount),
+                                  static_cast<GLsizei>(stride));
+
+        if (!CheckGLError("MultiDrawArraysIndirect"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to multi-draw arrays indirect");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::MultiDrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Multi-draw indirect requires GL 4.3 / ARB_multi_draw_indirect");
+        }
+
+        // Index type follows the currently bound index buffer, same as DrawIndexed
+        const GLenum glIndexType = (m_CurrentState.CurrentIndexType == INDEX_TYPE_UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        glMultiDrawElementsIndirect(ConvertPrimitiveTopology(primitiveTopology),
+                                    glIndexType,
+                                    reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)),
+                                    static_cast<GLsizei>(drawCount),
+                                    static_cast<GLsizei>(stride));
+
+        if (!CheckGLError("MultiDrawElementsIndirect"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to multi-draw elements indirect");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::MultiDrawElementsIndirectCount(uint32_t primitiveTopology, uint64_t offset, uint64_t drawCountOffset, uint32_t maxDrawCount, uint32_t stride)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        // Index type follows the currently bound index buffer, same as DrawIndexed
+        const GLenum glIndexType = (m_CurrentState.CurrentIndexType == INDEX_TYPE_UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        // The draw count is read from the buffer bound to GL_PARAMETER_BUFFER;
+        // the ARB entry point carries a suffix, the 4.6 core one does not
+        if (GLAD_GL_VERSION_4_6)
+        {
+            glMultiDrawElementsIndirectCount(ConvertPrimitiveTopology(primitiveTopology),
+                                             glIndexType,
+                                             reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)),
+                                             static_cast<GLintptr>(drawCountOffset),
+                                             static_cast<GLsizei>(maxDrawCount),
+                                             static_cast<GLsizei>(stride));
+        }
+        else if (GLAD_GL_ARB_indirect_parameters)
+        {
+            glMultiDrawElementsIndirectCountARB(ConvertPrimitiveTopology(primitiveTopology),
+                                                glIndexType,
+                                                reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)),
+                                                static_cast<GLintptr>(drawCountOffset),
+                                                static_cast<GLsizei>(maxDrawCount),
+                                                static_cast<GLsizei>(stride));
+        }
+        else
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Count-from-buffer multi-draw requires GL 4.6 / ARB_indirect_parameters");
+        }
+
+        if (!CheckGLError("MultiDrawElementsIndirectCount"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to multi-draw elements indirect count");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_compute_shader))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Compute dispatch requires GL 4.3 / ARB_compute_shader");
+        }
+
+        glDispatchCompute(static_cast<GLuint>(groupsX), static_cast<GLuint>(groupsY), static_cast<GLuint>(groupsZ));
+
+        if (!CheckGLError("DispatchCompute"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to dispatch compute");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::MemoryBarrier(uint32_t barrierBits)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        // MemoryBarrierFlags values match the GL bit definitions directly
+        glMemoryBarrier(static_cast<GLbitfield>(barrierBits));
+
+        if (!CheckGLError("MemoryBarrier"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to insert memory barrier");
+        }
+
+        return Result<void>();
+    }
+
     Result<void> OpenGLRendererAPI::GenBuffers(uint32_t count, uint32_t* outBuffers)
     {
         auto validateResult = ValidateContext();
@@ -549,6 +1042,25 @@ namespace Vortex
             return validateResult;
         }
 
+        // Single-name requests come from the pool; bulk requests go straight
+        // to the driver since they are already batched
+        if (count == 1)
+        {
+            if (m_BufferNamePool.empty())
+            {
+                m_BufferNamePool.resize(kNameChunkSize);
+                glGenBuffers(static_cast<GLsizei>(kNameChunkSize), reinterpret_cast<GLuint*>(m_BufferNamePool.data()));
+                if (!CheckGLError("GenBuffers"))
+                {
+                    m_BufferNamePool.clear();
+                    return Result<void>(ErrorCode::RendererInitFailed, "Failed to generate buffers");
+                }
+            }
+            *outBuffers = m_BufferNamePool.back();
+            m_BufferNamePool.pop_back();
+            return Result<void>();
+        }
+
         glGenBuffers(static_cast<GLsizei>(count), reinterpret_cast<GLuint*>(outBuffers));
 
         if (!CheckGLError("GenBuffers"))
@@ -685,7 +1197,124 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
-    Result<void> OpenGLRendererAPI::BindShader(uint32_t program)
+    Result<void> OpenGLRendererAPI::VertexAttribFormat(uint32_t index, int32_t size, uint32_t type,
+                                                       bool normalized, uint32_t relativeOffset)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+        glVertexAttribFormat(index, size, ConvertDataType(type), normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+        if (!CheckGLError("VertexAttribFormat"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to set vertex attrib format");
+        }
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::VertexAttribIFormat(uint32_t index, int32_t size, uint32_t type,
+                                                        uint32_t relativeOffset)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+        glVertexAttribIFormat(index, size, ConvertDataType(type), relativeOffset);
+        if (!CheckGLError("VertexAttribIFormat"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to set integer vertex attrib format");
+        }
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::VertexAttribBinding(uint32_t attribIndex, uint32_t bindingIndex)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+        glVertexAttribBinding(attribIndex, bindingIndex);
+        if (!CheckGLError("VertexAttribBinding"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to set vertex attrib binding");
+        }
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::VertexBindingDivisor(uint32_t bindingIndex, uint32_t divisor)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+        glVertexBindingDivisor(bindingIndex, divisor);
+        if (!CheckGLError("VertexBindingDivisor"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to set vertex binding divisor");
+        }
+        return Result<void>();
+    }
+
+    Result<uint32_t> OpenGLRendererAPI::CreateVertexLayout(const VertexAttrib* attribs, uint32_t count)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return Result<uint32_t>(validateResult.GetErrorCode(), validateResult.GetErrorMessage());
+        }
+        if (!attribs || count == 0)
+        {
+            return Result<uint32_t>(ErrorCode::InvalidParameter, "Empty vertex layout description");
+        }
+
+        GLuint vao = 0;
+        glGenVertexArrays(1, &vao);
+        if (!CheckGLError("CreateVertexLayout/GenVertexArrays") || vao == 0)
+        {
+            return Result<uint32_t>(ErrorCode::RendererInitFailed, "Failed to generate layout VAO");
+        }
+
+        // Record the format through the base class bind front-end so the
+        // bind cache stays coherent with the driver; the separate-format
+        // calls below attach to the currently bound VAO
+        BindVertexArray(vao);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const VertexAttrib& attrib = attribs[i];
+            glEnableVertexAttribArray(attrib.Index);
+            const GLenum type = ConvertDataType(static_cast<uint32_t>(attrib.Type));
+            if (attrib.Integer)
+            {
+                glVertexAttribIFormat(attrib.Index, attrib.ComponentCount, type, attrib.RelativeOffset);
+            }
+            else
+            {
+                glVertexAttribFormat(attrib.Index, attrib.ComponentCount, type,
+                                     attrib.Normalized ? GL_TRUE : GL_FALSE, attrib.RelativeOffset);
+            }
+            glVertexAttribBinding(attrib.Index, attrib.Binding);
+            if (attrib.Divisor != 0)
+            {
+                glVertexBindingDivisor(attrib.Binding, attrib.Divisor);
+            }
+        }
+        BindVertexArray(0);
+
+        if (!CheckGLError("CreateVertexLayout"))
+        {
+            glDeleteVertexArrays(1, &vao);
+            return Result<uint32_t>(ErrorCode::RendererInitFailed, "Failed to bake vertex layout");
+        }
+
+        m_LayoutVAOs.push_back(vao);
+        return Result<uint32_t>(uint32_t(vao));
+    }
+
+    Result<void> OpenGLRendererAPI::BindShaderImpl(uint32_t program)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -707,7 +1336,7 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
-    Result<void> OpenGLRendererAPI::BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler)
+    Result<void> OpenGLRendererAPI::BindTextureImpl(uint32_t slot, uint32_t texture, uint32_t sampler)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -736,7 +1365,126 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
-    Result<void> OpenGLRendererAPI::BindVertexArray(uint32_t vao)
+    Result<void> OpenGLRendererAPI::BindTexturesImpl(uint32_t firstSlot, uint32_t count, const uint32_t* textures)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (GLAD_GL_VERSION_4_4)
+        {
+            glBindTextures(firstSlot, static_cast<GLsizei>(count), textures);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                glActiveTexture(GL_TEXTURE0 + firstSlot + i);
+                glBindTexture(GL_TEXTURE_2D, textures[i]);
+            }
+        }
+
+        // Keep the single-bind redundancy cache coherent either way
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_CurrentState.BoundTextures[firstSlot + i] = textures[i];
+        }
+
+        if (!CheckGLError("BindTextures"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to bind textures");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::BindSamplersImpl(uint32_t firstSlot, uint32_t count, const uint32_t* samplers)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (GLAD_GL_VERSION_4_4)
+        {
+            glBindSamplers(firstSlot, static_cast<GLsizei>(count), samplers);
+        }
+        else
+        {
+            // Single binds predate multi-bind (GL 3.3), so the fallback is a loop
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                glBindSampler(firstSlot + i, samplers[i]);
+            }
+        }
+
+        if (!CheckGLError("BindSamplers"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to bind samplers");
+        }
+
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::GetTextureHandle(uint32_t texture, uint32_t sampler, uint64_t* outHandle)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!GLAD_GL_ARB_bindless_texture)
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Bindless textures require ARB_bindless_texture");
+        }
+
+        const GLuint64 handle = (sampler != 0)
+            ? glGetTextureSamplerHandleARB(texture, sampler)
+            : glGetTextureHandleARB(texture);
+
+        if (!CheckGLError("GetTextureHandle") || handle == 0)
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to get bindless texture handle");
+        }
+
+        if (outHandle) *outHandle = handle;
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::MakeTextureHandleResident(uint64_t handle, bool resident)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!GLAD_GL_ARB_bindless_texture)
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Bindless textures require ARB_bindless_texture");
+        }
+
+        if (resident)
+        {
+            glMakeTextureHandleResidentARB(handle);
+        }
+        else
+        {
+            glMakeTextureHandleNonResidentARB(handle);
+        }
+
+        if (!CheckGLError("MakeTextureHandleResident"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to change bindless handle residency");
+        }
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::BindVertexArrayImpl(uint32_t vao)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -765,6 +1513,25 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         {
             return validateResult;
         }
+        // Same pooling as GenBuffers: amortize count==1 calls into one
+        // bulk reservation per chunk
+        if (count == 1)
+        {
+            if (m_TextureNamePool.empty())
+            {
+                m_TextureNamePool.resize(kNameChunkSize);
+                glGenTextures(static_cast<GLsizei>(kNameChunkSize), reinterpret_cast<GLuint*>(m_TextureNamePool.data()));
+                if (!CheckGLError("GenTextures"))
+                {
+                    m_TextureNamePool.clear();
+                    return Result<void>(ErrorCode::RendererInitFailed, "Failed to generate textures");
+                }
+            }
+            *outTextures = m_TextureNamePool.back();
+            m_TextureNamePool.pop_back();
+            return Result<void>();
+        }
+
         glGenTextures(static_cast<GLsizei>(count), reinterpret_cast<GLuint*>(outTextures));
         if (!CheckGLError("GenTextures"))
         {
@@ -821,6 +1588,46 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
+    Result<void> OpenGLRendererAPI::TexSubImage2DAsync(uint32_t texture, int32_t level, uint32_t x, uint32_t y,
+                                                       uint32_t width, uint32_t height, uint32_t format, uint32_t type,
+                                                       uint32_t stagingBuffer, uint64_t stagingOffset, uint64_t* outFence)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Async texture upload requires GL 4.5 / ARB_direct_state_access");
+        }
+
+        // With a pixel-unpack buffer bound the data pointer is an offset into
+        // the buffer, so the transfer is a GPU-side DMA rather than a CPU copy
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer);
+        glTextureSubImage2D(texture, level, static_cast<GLint>(x), static_cast<GLint>(y),
+                            static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                            format, type, reinterpret_cast<const void*>(static_cast<uintptr_t>(stagingOffset)));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (!CheckGLError("TexSubImage2DAsync"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to upload texture region from staging buffer");
+        }
+
+        if (outFence)
+        {
+            GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            if (!sync || !CheckGLError("TexSubImage2DAsync fence"))
+            {
+                return Result<void>(ErrorCode::RendererInitFailed, "Failed to fence texture upload");
+            }
+            *outFence = reinterpret_cast<uint64_t>(sync);
+        }
+        return Result<void>();
+    }
+
     Result<void> OpenGLRendererAPI::TexParameteri(uint32_t target, uint32_t pname, int32_t param)
     {
         auto validateResult = ValidateContext();
@@ -1010,11 +1817,71 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
+    Result<void> OpenGLRendererAPI::ClearNamedFramebuffer(uint32_t fbo, uint32_t colorCount, const ClearAttachmentDesc* colors,
+                                                          bool clearDepthStencil, float depth, int32_t stencil)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        if (!(GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+        {
+            return Result<void>(ErrorCode::NotImplemented, "Named framebuffer clear requires GL 4.5 / ARB_direct_state_access");
+        }
+
+        for (uint32_t i = 0; i < colorCount; ++i)
+        {
+            glClearNamedFramebufferfv(fbo, GL_COLOR, static_cast<GLint>(colors[i].AttachmentIndex), colors[i].Color);
+        }
+        if (clearDepthStencil)
+        {
+            glClearNamedFramebufferfi(fbo, GL_DEPTH_STENCIL, 0, depth, static_cast<GLint>(stencil));
+        }
+
+        if (!CheckGLError("ClearNamedFramebuffer"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to clear named framebuffer");
+        }
+        return Result<void>();
+    }
+
+    Result<void> OpenGLRendererAPI::InvalidateFramebuffer(uint32_t target, uint32_t count, const uint32_t* attachments)
+    {
+        auto validateResult = ValidateContext();
+        if (!validateResult.IsSuccess())
+        {
+            return validateResult;
+        }
+
+        // Optimization hint only: succeed silently where invalidation is
+        // unavailable rather than failing a per-frame pass-end call
+        if (!(GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_invalidate_subdata))
+        {
+            return Result<void>();
+        }
+
+        std::vector<GLenum> glAttachments;
+        glAttachments.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            glAttachments.push_back(ConvertFramebufferAttachment(attachments[i]));
+        }
+        glInvalidateFramebuffer(ConvertFramebufferTarget(target), static_cast<GLsizei>(glAttachments.size()), glAttachments.data());
+
+        if (!CheckGLError("InvalidateFramebuffer"))
+        {
+            return Result<void>(ErrorCode::RendererInitFailed, "Failed to invalidate framebuffer");
+        }
+        return Result<void>();
+    }
+
     // ============================================================================
     // Render State
     // ============================================================================
 
-    Result<void> OpenGLRendererAPI::SetDepthState(bool testEnabled, bool writeEnabled, uint32_t compareFunc)
+    Result<void> OpenGLRendererAPI::SetDepthStateImpl(bool testEnabled, bool writeEnabled, uint32_t compareFunc)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -1056,7 +1923,7 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
-    Result<void> OpenGLRendererAPI::SetBlendState(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp)
+    Result<void> OpenGLRendererAPI::SetBlendStateImpl(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -1105,7 +1972,7 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         return Result<void>();
     }
 
-    Result<void> OpenGLRendererAPI::SetCullState(uint32_t cullMode, uint32_t frontFace)
+    Result<void> OpenGLRendererAPI::SetCullStateImpl(uint32_t cullMode, uint32_t frontFace)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -1156,7 +2023,7 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
     // Debug and Profiling
     // ============================================================================
 
-    Result<void> OpenGLRendererAPI::PushDebugGroup(const std::string& name)
+    Result<void> OpenGLRendererAPI::PushDebugGroup(std::string_view name)
     {
         auto validateResult = ValidateContext();
         if (!validateResult.IsSuccess())
@@ -1166,7 +2033,8 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
 
         if (GLAD_GL_KHR_debug)
         {
-            glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, static_cast<GLsizei>(name.length()), name.c_str());
+            // KHR_debug takes an explicit length, so the view needs no NUL terminator
+            glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, static_cast<GLsizei>(name.size()), name.data());
         }
 
         return Result<void>();
@@ -1225,8 +2093,10 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
         }
 
         #ifdef VX_USE_SDL
-            const SDL_OpenGLGraphicsContext* oglCtx = dynamic_cast<const SDL_OpenGLGraphicsContext*>(GetGraphicsContext());
-            if (!oglCtx || !oglCtx->IsValid())
+            // The concrete context type was checked once in Initialize; this
+            // runs before every bind/draw, so only the validity flag is
+            // re-tested here — no per-call dynamic_cast
+            if (!m_SDLContext || !m_SDLContext->IsValid())
             {
                 return Result<void>(ErrorCode::InvalidState, "OpenGL context is not valid");
             }
@@ -1340,6 +2210,11 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
             case BufferTarget::ElementArrayBuffer:   return GL_ELEMENT_ARRAY_BUFFER;
             case BufferTarget::UniformBuffer:        return GL_UNIFORM_BUFFER;
             case BufferTarget::ShaderStorageBuffer:  return GL_SHADER_STORAGE_BUFFER;
+            case BufferTarget::CopyReadBuffer:       return GL_COPY_READ_BUFFER;
+            case BufferTarget::CopyWriteBuffer:      return GL_COPY_WRITE_BUFFER;
+            case BufferTarget::DrawIndirectBuffer:   return GL_DRAW_INDIRECT_BUFFER;
+            case BufferTarget::PixelUnpackBuffer:    return GL_PIXEL_UNPACK_BUFFER;
+            case BufferTarget::ParameterBuffer:      return GL_PARAMETER_BUFFER;
             default:                                  return GL_ARRAY_BUFFER;
         }
     }
@@ -1351,6 +2226,9 @@ glVertexAttribIPointer(index, size, ConvertDataType(type), static_cast<GLsizei>(
             case BufferUsage::StaticDraw:  return GL_STATIC_DRAW;
             case BufferUsage::DynamicDraw: return GL_DYNAMIC_DRAW;
             case BufferUsage::StreamDraw:  return GL_STREAM_DRAW;
+            // Transient uploads normally go through the upload ring; this is
+            // the fallback usage when the ring can't take them
+            case BufferUsage::TransientPerFrame: return GL_STREAM_DRAW;
             default:                       return GL_STATIC_DRAW;
         }
     }
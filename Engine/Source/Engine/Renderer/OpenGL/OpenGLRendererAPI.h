@@ -3,10 +3,14 @@
 #include "Engine/Renderer/RendererAPI.h"
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace Vortex
 {
 	class OpenGLGraphicsContext;
+#ifdef VX_USE_SDL
+	class SDL_OpenGLGraphicsContext;
+#endif
 
 	/**
 	 * @brief OpenGL implementation of RendererAPI
@@ -21,15 +25,11 @@ namespace Vortex
 		// RendererAPI Interface Implementation
 		// ============================================================================
 
-		GraphicsAPI GetAPI() const override { return GraphicsAPI::OpenGL; }
-		const char* GetName() const override { return "OpenGL"; }
-
 		Result<void> Initialize(GraphicsContext* context) override;
 		Result<void> Shutdown() override;
-		bool IsInitialized() const override { return m_Initialized; }
 
 		// Basic rendering operations
-		Result<void> Clear(uint32_t flags, const glm::vec4& color, float depth, int32_t stencil) override;
+		Result<void> Clear(uint32_t flags, glm::vec4 color, float depth, int32_t stencil) override;
 		Result<void> SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 		Result<void> SetScissor(bool enabled, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
@@ -41,12 +41,18 @@ namespace Vortex
 							  uint32_t firstVertex, uint32_t baseInstance,
 							  uint32_t primitiveTopology) override;
 
-		// Resource binding
+		// Resource binding (the frequent binds sit behind the base class
+		// bind cache, hence the Impl suffix)
 		Result<void> BindVertexBuffer(uint32_t binding, uint32_t buffer, uint64_t offset, uint64_t stride) override;
+		Result<void> BindVertexBuffers(uint32_t first, uint32_t count, const uint32_t* buffers, const uint64_t* offsets, const uint64_t* strides) override;
 		Result<void> BindIndexBuffer(uint32_t buffer, uint32_t indexType, uint64_t offset) override;
-		Result<void> BindShader(uint32_t program) override;
-		Result<void> BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler) override;
-		Result<void> BindVertexArray(uint32_t vao) override;
+		Result<void> BindShaderImpl(uint32_t program) override;
+		Result<void> BindTextureImpl(uint32_t slot, uint32_t texture, uint32_t sampler) override;
+		Result<void> BindTexturesImpl(uint32_t firstSlot, uint32_t count, const uint32_t* textures) override;
+		Result<void> BindSamplersImpl(uint32_t firstSlot, uint32_t count, const uint32_t* samplers) override;
+		Result<void> GetTextureHandle(uint32_t texture, uint32_t sampler, uint64_t* outHandle) override;
+		Result<void> MakeTextureHandleResident(uint64_t handle, bool resident) override;
+		Result<void> BindVertexArrayImpl(uint32_t vao) override;
 
 		// Textures
 		Result<void> GenTextures(uint32_t count, uint32_t* outTextures) override;
@@ -55,6 +61,9 @@ namespace Vortex
 		Result<void> TexImage2D(uint32_t target, int32_t level, uint32_t internalFormat,
 								uint32_t width, uint32_t height, uint32_t format, uint32_t type,
 								const void* data) override;
+		Result<void> TexSubImage2DAsync(uint32_t texture, int32_t level, uint32_t x, uint32_t y,
+		                                uint32_t width, uint32_t height, uint32_t format, uint32_t type,
+		                                uint32_t stagingBuffer, uint64_t stagingOffset, uint64_t* outFence) override;
 		Result<void> TexParameteri(uint32_t target, uint32_t pname, int32_t param) override;
 		Result<void> GenerateMipmap(uint32_t target) override;
 
@@ -65,13 +74,29 @@ namespace Vortex
         Result<void> BufferSubData(uint32_t target, uint64_t offset, uint64_t size, const void* data) override;
         Result<void> MapBufferRange(uint32_t target, uint64_t offset, uint64_t length, uint32_t access, void** outPtr) override;
         Result<void> UnmapBuffer(uint32_t target) override;
+        Result<void> FlushMappedBufferRange(uint32_t target, uint64_t offset, uint64_t length) override;
         Result<void> BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) override;
+        Result<void> BindBuffersBase(uint32_t target, uint32_t first, uint32_t count, const uint32_t* buffers) override;
+        Result<void> BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, uint64_t offset, uint64_t size) override;
+        Result<void> CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, uint64_t readOffset, uint64_t writeOffset, uint64_t size) override;
+        Result<void> DrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset) override;
+        Result<void> DrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset) override;
+        Result<void> MultiDrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+        Result<void> MultiDrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+        Result<void> MultiDrawElementsIndirectCount(uint32_t primitiveTopology, uint64_t offset, uint64_t drawCountOffset, uint32_t maxDrawCount, uint32_t stride) override;
+        Result<void> DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override;
+        Result<void> MemoryBarrier(uint32_t barrierBits) override;
         Result<void> VertexAttribPointer(uint32_t index, int32_t size, uint32_t type,
                                          bool normalized, uint64_t stride, uint64_t pointer) override;
         Result<void> VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type,
                                           uint64_t stride, uint64_t pointer) override;
         Result<void> VertexAttribDivisor(uint32_t index, uint32_t divisor) override;
         Result<void> EnableVertexAttribArray(uint32_t index, bool enabled) override;
+        Result<void> VertexAttribFormat(uint32_t index, int32_t size, uint32_t type, bool normalized, uint32_t relativeOffset) override;
+        Result<void> VertexAttribIFormat(uint32_t index, int32_t size, uint32_t type, uint32_t relativeOffset) override;
+        Result<void> VertexAttribBinding(uint32_t attribIndex, uint32_t bindingIndex) override;
+        Result<void> VertexBindingDivisor(uint32_t bindingIndex, uint32_t divisor) override;
+        Result<uint32_t> CreateVertexLayout(const VertexAttrib* attribs, uint32_t count) override;
 
 		// Object lifetime
 		Result<void> GenBuffers(uint32_t count, uint32_t* outBuffers) override;
@@ -79,10 +104,10 @@ namespace Vortex
 		Result<void> GenVertexArrays(uint32_t count, uint32_t* outArrays) override;
 		Result<void> DeleteVertexArrays(uint32_t count, const uint32_t* arrays) override;
 
-		// Render state
-		Result<void> SetDepthState(bool testEnabled, bool writeEnabled, uint32_t compareFunc) override;
-		Result<void> SetBlendState(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp) override;
-		Result<void> SetCullState(uint32_t cullMode, uint32_t frontFace) override;
+		// Render state (behind the base class state-delta cache)
+		Result<void> SetDepthStateImpl(bool testEnabled, bool writeEnabled, uint32_t compareFunc) override;
+		Result<void> SetBlendStateImpl(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp) override;
+		Result<void> SetCullStateImpl(uint32_t cullMode, uint32_t frontFace) override;
 
         // Sync objects
         Result<void> FenceSync(uint64_t* outHandle) override;
@@ -90,7 +115,7 @@ namespace Vortex
         Result<void> DeleteSync(uint64_t handle) override;
 
         // Debug and profiling
-        Result<void> PushDebugGroup(const std::string& name) override;
+        Result<void> PushDebugGroup(std::string_view name) override;
         Result<void> PopDebugGroup() override;
         std::string GetDebugInfo() const override;
 
@@ -101,10 +126,17 @@ namespace Vortex
 		Result<void> FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textarget, uint32_t texture, int32_t level) override;
 		Result<void> CheckFramebufferStatus(uint32_t target, uint32_t* outStatus) override;
 		Result<void> SetDrawBuffers(uint32_t count, const uint32_t* attachments) override;
+		Result<void> ClearNamedFramebuffer(uint32_t fbo, uint32_t colorCount, const ClearAttachmentDesc* colors,
+		                                   bool clearDepthStencil, float depth, int32_t stencil) override;
+		Result<void> InvalidateFramebuffer(uint32_t target, uint32_t count, const uint32_t* attachments) override;
 
 	private:
-		bool m_Initialized = false;
-		
+#ifdef VX_USE_SDL
+		// Concrete context, downcast-checked once in Initialize so the
+		// per-call ValidateContext doesn't pay for RTTI on every bind/draw
+		SDL_OpenGLGraphicsContext* m_SDLContext = nullptr;
+#endif
+
 		// Current state tracking
 		struct RenderState
 		{
@@ -129,6 +161,53 @@ namespace Vortex
 			uint64_t IndexBufferOffset = 0;
 		} m_CurrentState;
 
+		// Name pools refilled in bulk so count==1 generation — the common
+		// case in loops at scene load — costs one driver call per chunk
+		// instead of one per object. Names are cheap: glGen* only reserves
+		// them, the object is created on first bind.
+		static constexpr uint32_t kNameChunkSize = 256;
+		std::vector<uint32_t> m_BufferNamePool;
+		std::vector<uint32_t> m_TextureNamePool;
+
+		// VAOs baked by CreateVertexLayout, deleted in Shutdown
+		std::vector<uint32_t> m_LayoutVAOs;
+
+		// Transient upload ring: BufferData calls with the TransientPerFrame
+		// usage hint memcpy into a persistently-mapped ring and fill the
+		// destination through a GPU-side copy, so per-frame uploads never
+		// wait on the driver's internal staging. The ring is split into
+		// fenced sections reused round-robin; uploads that outgrow a section
+		// (or run without ARB_buffer_storage) fall back to plain glBufferData.
+		static constexpr uint64_t kTransientRingSize = 4 * 1024 * 1024;
+		static constexpr uint32_t kTransientRingSections = 3;
+		static constexpr uint64_t kTransientAlignment = 64;
+		uint32_t m_TransientRing = 0;
+		uint8_t* m_TransientRingPtr = nullptr;
+		uint64_t m_TransientHead = 0;
+		uint32_t m_TransientSection = 0;
+		uint64_t m_TransientFences[kTransientRingSections] = {};
+		bool m_TransientRingUnavailable = false;
+
+		/**
+		 * @brief Upload through the transient ring if it applies
+		 * @param target GL destination target (already converted)
+		 * @param data Source bytes
+		 * @param size Upload size in bytes
+		 * @return True if the upload was taken; false to fall back to glBufferData
+		 */
+		bool TryTransientUpload(uint32_t target, const void* data, uint64_t size);
+
+		/**
+		 * @brief Create and persistently map the transient ring on first use
+		 * @return True if the ring is ready
+		 */
+		bool EnsureTransientRing();
+
+		/**
+		 * @brief Unmap and release the transient ring and its fences
+		 */
+		void DestroyTransientRing();
+
 		/**
 		 * @brief Validate that OpenGL context is current and ready
 		 * @return Success/failure result
@@ -7,6 +7,9 @@
 #include <glad/gl.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <cstring>
+#include <mutex>
+
 // For SPIRV-Cross (stub for now - can be implemented when SPIRV-Cross is available)
 #ifdef VX_SPIRV_CROSS_AVAILABLE
 #include <spirv_cross.hpp>
@@ -50,6 +53,84 @@ namespace {
 
 namespace Vortex
 {
+    // ------------------------- Shader slab pool --------------------------
+    //
+    // Backing store for OpenGLShader::operator new/delete, following the
+    // RenderCommand pool: fixed-size slots on a free list, slabs appended
+    // and never returned. Shaders are created in bulk during asset loads
+    // (possibly from loader threads, hence the mutex) and recycled on hot
+    // reload, so the pool turns that churn into pointer pops.
+    namespace
+    {
+        constexpr size_t kShaderSlotSize = (sizeof(OpenGLShader) + 15) & ~size_t(15);
+        constexpr size_t kShadersPerSlab = 32;
+
+        struct ShaderSlot
+        {
+            ShaderSlot* Next;
+        };
+
+        struct ShaderPool
+        {
+            std::mutex Mutex;
+            ShaderSlot* FreeList = nullptr;
+        };
+
+        // Deliberately leaked so shaders held by statics can still be
+        // destroyed during shutdown
+        ShaderPool& GetShaderPool()
+        {
+            static ShaderPool* pool = new ShaderPool();
+            return *pool;
+        }
+    }
+
+    void* OpenGLShader::operator new(size_t size)
+    {
+        // OpenGLShader has no subclasses, but keep the oversized fallback so
+        // the allocation paths stay matched if that ever changes
+        if (size > kShaderSlotSize)
+        {
+            return ::operator new(size);
+        }
+
+        ShaderPool& pool = GetShaderPool();
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        if (!pool.FreeList)
+        {
+            auto* slab = static_cast<unsigned char*>(::operator new(kShaderSlotSize * kShadersPerSlab));
+            for (size_t i = 0; i < kShadersPerSlab; ++i)
+            {
+                auto* slot = reinterpret_cast<ShaderSlot*>(slab + i * kShaderSlotSize);
+                slot->Next = pool.FreeList;
+                pool.FreeList = slot;
+            }
+        }
+
+        ShaderSlot* slot = pool.FreeList;
+        pool.FreeList = slot->Next;
+        return slot;
+    }
+
+    void OpenGLShader::operator delete(void* ptr, size_t size) noexcept
+    {
+        if (!ptr)
+        {
+            return;
+        }
+        if (size > kShaderSlotSize)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        ShaderPool& pool = GetShaderPool();
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        auto* slot = static_cast<ShaderSlot*>(ptr);
+        slot->Next = pool.FreeList;
+        pool.FreeList = slot;
+    }
+
     OpenGLShader::OpenGLShader(const std::string& name)
         : m_ProgramId(0), m_IsLinked(false)
     {
@@ -70,7 +151,7 @@ namespace Vortex
     // SHADER LIFECYCLE
     // ============================================================================
 
-    Result<void> OpenGLShader::Create(const std::unordered_map<ShaderStage, std::vector<uint32_t>>& shaders, const ShaderReflectionData& reflection)
+    Result<void> OpenGLShader::Create(const ShaderStageBinary* stages, size_t count, const ShaderReflectionData& reflection)
     {
         // Destroy existing shader if any
         Destroy();
@@ -85,12 +166,14 @@ namespace Vortex
 
         // Convert SPIR-V to GLSL and compile each stage
         std::vector<GLuint> compiledShaders;
-        compiledShaders.reserve(shaders.size());
+        compiledShaders.reserve(count);
 
-        for (const auto& [stage, spirv] : shaders)
+        for (size_t i = 0; i < count; ++i)
         {
+            const ShaderStage stage = stages[i].Stage;
+
             // Convert SPIR-V to GLSL
-            auto glslResult = ConvertSpirVToGLSL(spirv, stage);
+            auto glslResult = ConvertSpirVToGLSL(stages[i].Words, stages[i].WordCount, stage);
             if (!glslResult.IsSuccess())
             {
                 // Cleanup compiled shaders
@@ -145,11 +228,14 @@ namespace Vortex
         // Also cache any additional uniforms found at runtime
         CacheUniformLocations();
 
+        // Create staging UBOs for the reflected uniform blocks
+        BuildUniformBlockStaging(reflection);
+
         // Update shader metadata
         ShaderStageFlags stageFlags = 0;
-        for (const auto& [stage, _] : shaders)
+        for (size_t i = 0; i < count; ++i)
         {
-            stageFlags |= static_cast<uint32_t>(stage);
+            stageFlags |= static_cast<uint32_t>(stages[i].Stage);
         }
         SetMetadata(GetName(), reflection, stageFlags);
         
@@ -170,7 +256,19 @@ namespace Vortex
             m_ProgramId = 0;
         }
         m_IsLinked = false;
-        m_UniformLocationCache.clear();
+        m_UniformNames.Clear();
+        m_HandleLocations.clear();
+
+        for (auto& block : m_BlockStaging)
+        {
+            if (block.Buffer != 0)
+            {
+                glDeleteBuffers(1, &block.Buffer);
+            }
+        }
+        m_BlockStaging.clear();
+        m_HandleMembers.clear();
+        m_BlockRecording = false;
     }
 
     bool OpenGLShader::IsValid() const
@@ -192,6 +290,13 @@ namespace Vortex
 
 		// Bind immediately so subsequent uniform/texture calls in this frame target this program
 		GetRenderCommandQueue().BindShader(m_ProgramId, true);
+
+        // Indexed UBO bindings are global context state, so reclaim this
+        // shader's block binding points from whoever bound them last
+        for (const auto& block : m_BlockStaging)
+        {
+            glBindBufferBase(GL_UNIFORM_BUFFER, block.Binding, block.Buffer);
+        }
     }
 
     void OpenGLShader::Unbind()
@@ -205,6 +310,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const void* data, uint32_t size)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, data, size))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -220,6 +334,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, int value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, &value, sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -233,6 +356,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, float value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, &value, sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -246,6 +378,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const glm::vec2& value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, glm::value_ptr(value), sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -259,6 +400,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const glm::vec3& value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, glm::value_ptr(value), sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -272,6 +422,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const glm::vec4& value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, glm::value_ptr(value), sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -285,6 +444,16 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const glm::mat3& value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && m_HandleMembers[index].BlockIndex != BlockMemberRef::kNoBlock)
+            {
+                // Delegate so the handle overload applies std140 column padding
+                return SetUniform(UniformHandle{ index }, value);
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -298,6 +467,15 @@ namespace Vortex
 
     Result<void> OpenGLShader::SetUniform(const std::string& name, const glm::mat4& value)
     {
+        if (m_BlockRecording)
+        {
+            const uint32_t index = m_UniformNames.Find(name);
+            if (index != ShaderUniformLookup::kNotFound && StageUniform({ index }, glm::value_ptr(value), sizeof(value)))
+            {
+                return Success();
+            }
+        }
+
         GLint location = GetUniformLocation(name);
         if (location == -1)
         {
@@ -309,6 +487,283 @@ namespace Vortex
         return Success();
     }
 
+    UniformHandle OpenGLShader::GetUniformHandle(const std::string& name) const
+    {
+        const uint32_t index = m_UniformNames.Find(name);
+        if (index != ShaderUniformLookup::kNotFound)
+        {
+            return { index };
+        }
+
+        // Not seen during reflection caching; resolve against the program
+        // once so handles also work for uniforms reflection missed
+        GLint location = glGetUniformLocation(m_ProgramId, name.c_str());
+        if (location == -1)
+        {
+            VX_CORE_WARN("OpenGLShader: Uniform '{}' not found in shader '{}'", name, GetName());
+            return {};
+        }
+
+        return { RegisterUniformHandle(name, location) };
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, int value)
+    {
+        if (m_BlockRecording && StageUniform(handle, &value, sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniform1i(location, value);
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, float value)
+    {
+        if (m_BlockRecording && StageUniform(handle, &value, sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniform1f(location, value);
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, const glm::vec2& value)
+    {
+        if (m_BlockRecording && StageUniform(handle, glm::value_ptr(value), sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniform2fv(location, 1, glm::value_ptr(value));
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, const glm::vec3& value)
+    {
+        if (m_BlockRecording && StageUniform(handle, glm::value_ptr(value), sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniform3fv(location, 1, glm::value_ptr(value));
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, const glm::vec4& value)
+    {
+        if (m_BlockRecording && StageUniform(handle, glm::value_ptr(value), sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniform4fv(location, 1, glm::value_ptr(value));
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, const glm::mat3& value)
+    {
+        if (m_BlockRecording)
+        {
+            // std140 mat3 columns are vec4-aligned; expand before staging
+            float padded[12] = {};
+            for (int column = 0; column < 3; ++column)
+            {
+                std::memcpy(&padded[column * 4], glm::value_ptr(value) + column * 3, sizeof(float) * 3);
+            }
+            if (StageUniform(handle, padded, sizeof(padded)))
+            {
+                return Success();
+            }
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        return Success();
+    }
+
+    Result<void> OpenGLShader::SetUniform(UniformHandle handle, const glm::mat4& value)
+    {
+        if (m_BlockRecording && StageUniform(handle, glm::value_ptr(value), sizeof(value)))
+        {
+            return Success();
+        }
+
+        GLint location = LocationFromHandle(handle);
+        if (location == -1)
+        {
+            return ErrorCode::ResourceNotFound;
+        }
+
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        return Success();
+    }
+
+    Result<void> OpenGLShader::BeginUniformBlock()
+    {
+        if (m_BlockRecording)
+        {
+            VX_CORE_WARN("OpenGLShader: BeginUniformBlock called twice without EndUniformBlock in shader '{}'", GetName());
+        }
+
+        m_BlockRecording = true;
+        return Success();
+    }
+
+    Result<void> OpenGLShader::EndUniformBlock()
+    {
+        if (!m_BlockRecording)
+        {
+            VX_CORE_WARN("OpenGLShader: EndUniformBlock called without BeginUniformBlock in shader '{}'", GetName());
+            return ErrorCode::InvalidState;
+        }
+
+        m_BlockRecording = false;
+        FlushUniformBlocks();
+        return Success();
+    }
+
+    bool OpenGLShader::StageUniform(UniformHandle handle, const void* data, uint32_t size)
+    {
+        if (handle.Index >= m_HandleMembers.size())
+        {
+            return false;
+        }
+
+        const BlockMemberRef& ref = m_HandleMembers[handle.Index];
+        if (ref.BlockIndex == BlockMemberRef::kNoBlock)
+        {
+            return false;
+        }
+
+        auto& block = m_BlockStaging[ref.BlockIndex];
+        const uint32_t bytes = size < ref.Size ? size : ref.Size;
+        std::memcpy(block.Data.data() + ref.Offset, data, bytes);
+        block.DirtyBegin = ref.Offset < block.DirtyBegin ? ref.Offset : block.DirtyBegin;
+        block.DirtyEnd = ref.Offset + bytes > block.DirtyEnd ? ref.Offset + bytes : block.DirtyEnd;
+        return true;
+    }
+
+    void OpenGLShader::FlushUniformBlocks()
+    {
+        bool uploaded = false;
+        for (auto& block : m_BlockStaging)
+        {
+            if (block.DirtyBegin >= block.DirtyEnd)
+            {
+                continue;
+            }
+
+            // One upload covering the coalesced dirty range of the block
+            glBindBuffer(GL_UNIFORM_BUFFER, block.Buffer);
+            glBufferSubData(GL_UNIFORM_BUFFER,
+                            static_cast<GLintptr>(block.DirtyBegin),
+                            static_cast<GLsizeiptr>(block.DirtyEnd - block.DirtyBegin),
+                            block.Data.data() + block.DirtyBegin);
+            block.DirtyBegin = UINT32_MAX;
+            block.DirtyEnd = 0;
+            uploaded = true;
+        }
+
+        if (uploaded)
+        {
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        }
+    }
+
+    void OpenGLShader::BuildUniformBlockStaging(const ShaderReflectionData& reflection)
+    {
+        for (const auto& [binding, members] : reflection.UniformBuffers)
+        {
+            uint32_t blockSize = 0;
+            for (const auto& member : members)
+            {
+                const uint32_t memberEnd = member.Offset + member.Size;
+                blockSize = memberEnd > blockSize ? memberEnd : blockSize;
+            }
+            if (blockSize == 0)
+            {
+                continue;
+            }
+
+            UniformBlockStaging block;
+            block.Binding = binding;
+            block.Data.resize(blockSize, 0);
+            glGenBuffers(1, &block.Buffer);
+            glBindBuffer(GL_UNIFORM_BUFFER, block.Buffer);
+            glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(blockSize), nullptr, GL_DYNAMIC_DRAW);
+            glBindBufferBase(GL_UNIFORM_BUFFER, binding, block.Buffer);
+
+            const uint16_t blockIndex = static_cast<uint16_t>(m_BlockStaging.size());
+            for (const auto& member : members)
+            {
+                // Block members have no glUniform location; the handle routes
+                // them into the staging buffer instead
+                const uint32_t handleIndex = RegisterUniformHandle(member.Name, -1);
+                m_HandleMembers[handleIndex] = { blockIndex, member.Offset, member.Size };
+            }
+            m_BlockStaging.push_back(std::move(block));
+
+            VX_CORE_TRACE("OpenGLShader: Staged uniform block at binding {} ({} bytes, {} members)",
+                          binding, blockSize, members.size());
+        }
+
+        if (!m_BlockStaging.empty())
+        {
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        }
+    }
+
+    uint32_t OpenGLShader::RegisterUniformHandle(const std::string& name, GLint location) const
+    {
+        const uint32_t index = m_UniformNames.Add(name);
+        if (index < m_HandleLocations.size())
+        {
+            m_HandleLocations[index] = location;
+            return index;
+        }
+
+        m_HandleLocations.push_back(location);
+        m_HandleMembers.emplace_back();
+        return index;
+    }
+
     Result<void> OpenGLShader::SetTexture(const std::string& name, uint32_t textureId, uint32_t slot)
     {
         GLint location = GetUniformLocation(name);
@@ -350,14 +805,16 @@ namespace Vortex
 
     GLint OpenGLShader::GetUniformLocation(const std::string& name) const
     {
-        auto it = m_UniformLocationCache.find(name);
-        if (it != m_UniformLocationCache.end())
+        const uint32_t index = m_UniformNames.Find(name);
+        if (index != ShaderUniformLookup::kNotFound)
         {
-            return it->second;
+            return m_HandleLocations[index];
         }
 
+        // Unknown name: ask the driver once and intern the answer (including
+        // -1, so repeated lookups of a missing name stay off the driver)
         GLint location = glGetUniformLocation(m_ProgramId, name.c_str());
-        m_UniformLocationCache[name] = location;
+        RegisterUniformHandle(name, location);
         return location;
     }
 
@@ -371,7 +828,7 @@ namespace Vortex
         info += "  Program ID: " + std::to_string(m_ProgramId) + "\n";
         info += "  Linked: " + std::string(m_IsLinked ? "Yes" : "No") + "\n";
         info += "  Valid: " + std::string(IsValid() ? "Yes" : "No") + "\n";
-        info += "  Cached Uniforms: " + std::to_string(m_UniformLocationCache.size()) + "\n";
+        info += "  Cached Uniforms: " + std::to_string(m_UniformNames.GetCount()) + "\n";
         
         if (IsValid())
         {
@@ -396,14 +853,14 @@ namespace Vortex
     // PRIVATE METHODS
     // ============================================================================
 
-    Result<std::string> OpenGLShader::ConvertSpirVToGLSL(const std::vector<uint32_t>& spirv, 
+    Result<std::string> OpenGLShader::ConvertSpirVToGLSL(const uint32_t* words, size_t wordCount,
                                                          ShaderStage stage)
     {
 #ifdef VX_SPIRV_CROSS_AVAILABLE
         try
         {
-            // Create SPIRV-Cross compiler
-            spirv_cross::CompilerGLSL glsl(spirv);
+            // Create SPIRV-Cross compiler (reads the words in place)
+            spirv_cross::CompilerGLSL glsl(words, wordCount);
             
             // Set options for OpenGL, targeting the active context's supported GLSL
             spirv_cross::CompilerGLSL::Options options;
@@ -590,11 +1047,11 @@ void main()
             
             if (location != -1)
             {
-                m_UniformLocationCache[name] = location;
+                RegisterUniformHandle(name, location);
             }
         }
 
-        VX_CORE_TRACE("OpenGLShader: Cached {} uniform locations", m_UniformLocationCache.size());
+        VX_CORE_TRACE("OpenGLShader: Cached {} uniform locations", m_UniformNames.GetCount());
     }
 
     GLenum OpenGLShader::ShaderStageToGLType(ShaderStage stage)
@@ -637,7 +1094,7 @@ void main()
             GLint location = glGetUniformLocation(m_ProgramId, uniform.Name.c_str());
             if (location != -1)
             {
-                m_UniformLocationCache[uniform.Name] = location;
+                RegisterUniformHandle(uniform.Name, location);
                 VX_CORE_TRACE("OpenGLShader: Cached uniform '{}' at location {}", uniform.Name, location);
             }
             else
@@ -655,13 +1112,13 @@ void main()
                 GLint location = glGetUniformLocation(m_ProgramId, resource.Name.c_str());
                 if (location != -1)
                 {
-                    m_UniformLocationCache[resource.Name] = location;
+                    RegisterUniformHandle(resource.Name, location);
                     VX_CORE_TRACE("OpenGLShader: Cached texture uniform '{}' at location {}", resource.Name, location);
                 }
             }
         }
         
-        VX_CORE_INFO("OpenGLShader: Cached {} uniforms from reflection", m_UniformLocationCache.size());
+        VX_CORE_INFO("OpenGLShader: Cached {} uniforms from reflection", m_UniformNames.GetCount());
     }
     
     void OpenGLShader::LogReflectionInfo(const ShaderReflectionData& reflection)
@@ -5,6 +5,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace Vortex
 {
@@ -17,25 +18,34 @@ class OpenGLShader : public GPUShader
         explicit OpenGLShader(const std::string& name = "");
         ~OpenGLShader() override;
 
-        // ============================================================================
-        // SHADER LIFECYCLE
-        // ============================================================================
+        // Instances come from a dedicated slab pool (see OpenGLShader.cpp):
+        // bulk asset loads create shaders by the hundred, and recycling
+        // fixed-size slots keeps that churn off the general heap
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size) noexcept;
 
-        Result<void> Create(const std::unordered_map<ShaderStage, std::vector<uint32_t>>& shaders,
-                           const ShaderReflectionData& reflection) override;
-
-        void Destroy() override;
-        bool IsValid() const override;
+        // Overrides grouped hot-first to mirror the base class vtable layout
 
         // ============================================================================
-        // SHADER BINDING
+        // SHADER BINDING (hot)
         // ============================================================================
 
         void Bind() override;
         void Unbind() override;
 
+        Result<void> SetUniform(UniformHandle handle, int value) override;
+        Result<void> SetUniform(UniformHandle handle, float value) override;
+        Result<void> SetUniform(UniformHandle handle, const glm::vec2& value) override;
+        Result<void> SetUniform(UniformHandle handle, const glm::vec3& value) override;
+        Result<void> SetUniform(UniformHandle handle, const glm::vec4& value) override;
+        Result<void> SetUniform(UniformHandle handle, const glm::mat3& value) override;
+        Result<void> SetUniform(UniformHandle handle, const glm::mat4& value) override;
+
+        Result<void> BeginUniformBlock() override;
+        Result<void> EndUniformBlock() override;
+
         // ============================================================================
-        // UNIFORM MANAGEMENT
+        // UNIFORM MANAGEMENT (string-keyed)
         // ============================================================================
 
         Result<void> SetUniform(const std::string& name, const void* data, uint32_t size) override;
@@ -48,9 +58,21 @@ class OpenGLShader : public GPUShader
         Result<void> SetUniform(const std::string& name, const glm::mat3& value) override;
         Result<void> SetUniform(const std::string& name, const glm::mat4& value) override;
 
+        UniformHandle GetUniformHandle(const std::string& name) const override;
+
         Result<void> SetTexture(const std::string& name, uint32_t textureId, uint32_t slot = 0) override;
         Result<void> SetUniformBuffer(const std::string& name, uint32_t bufferId, uint32_t offset, uint32_t size) override;
 
+        // ============================================================================
+        // SHADER LIFECYCLE (cold)
+        // ============================================================================
+
+        Result<void> Create(const ShaderStageBinary* stages, size_t count,
+                           const ShaderReflectionData& reflection) override;
+
+        void Destroy() override;
+        bool IsValid() const override;
+
         // ============================================================================
         // OPENGL SPECIFIC
         // ============================================================================
@@ -85,8 +107,8 @@ class OpenGLShader : public GPUShader
          * @param stage Shader stage
          * @return OpenGL shader source code or error
          */
-        Result<std::string> ConvertSpirVToGLSL(const std::vector<uint32_t>& spirv, 
-                                              ShaderStage stage);
+        Result<std::string> ConvertSpirVToGLSL(const uint32_t* words, size_t wordCount,
+                                               ShaderStage stage);
 
         /**
          * @brief Compile OpenGL shader from GLSL source
@@ -108,6 +130,44 @@ class OpenGLShader : public GPUShader
          * @param reflection Shader reflection data containing uniforms
          */
         void CacheUniformLocationsFromReflection(const ShaderReflectionData& reflection);
+
+        /**
+         * @brief Create staging UBOs for the shader's reflected uniform blocks
+         * @param reflection Shader reflection data containing the block layouts
+         */
+        void BuildUniformBlockStaging(const ShaderReflectionData& reflection);
+
+        /**
+         * @brief Copy a uniform value into its block's staging buffer
+         * @param handle Handle identifying the uniform
+         * @param data Value bytes (already in std140 layout)
+         * @param size Value size in bytes
+         * @return True if the uniform belongs to a staged block, false to fall through
+         */
+        bool StageUniform(UniformHandle handle, const void* data, uint32_t size);
+
+        /**
+         * @brief Upload each block's coalesced dirty range in one call
+         */
+        void FlushUniformBlocks();
+
+        /**
+         * @brief Register a resolved location in the handle table
+         * @param name Uniform name
+         * @param location GL uniform location
+         * @return Index of the handle table slot
+         */
+        uint32_t RegisterUniformHandle(const std::string& name, GLint location) const;
+
+        /**
+         * @brief Translate a handle to its GL location
+         * @param handle Handle from GetUniformHandle
+         * @return GL location, -1 for invalid/out-of-range handles
+         */
+        GLint LocationFromHandle(UniformHandle handle) const
+        {
+            return handle.Index < m_HandleLocations.size() ? m_HandleLocations[handle.Index] : -1;
+        }
         
         /**
          * @brief Extract additional uniform locations from compiled program
@@ -139,8 +199,39 @@ class OpenGLShader : public GPUShader
         // ============================================================================
 
         GLuint m_ProgramId = 0;
-        mutable std::unordered_map<std::string, GLint> m_UniformLocationCache;
         bool m_IsLinked = false;
+
+        // Uniform name resolution: every known name is interned once in the
+        // SoA lookup table and owns a dense index into the parallel
+        // per-uniform arrays below (locations, block members). Both the
+        // handle path and the string setters resolve through this table
+        mutable ShaderUniformLookup m_UniformNames;
+        mutable std::vector<GLint> m_HandleLocations;
+
+        // Uniform block staging: one shader-owned UBO per reflected block,
+        // shadowed by a CPU buffer that SetUniform writes into while
+        // recording; EndUniformBlock uploads the dirty range in one call
+        struct UniformBlockStaging
+        {
+            GLuint Buffer = 0;
+            uint32_t Binding = 0;
+            std::vector<uint8_t> Data;
+            uint32_t DirtyBegin = UINT32_MAX;
+            uint32_t DirtyEnd = 0;
+        };
+
+        // Maps a handle to its block member; parallel to m_HandleLocations
+        struct BlockMemberRef
+        {
+            static constexpr uint16_t kNoBlock = 0xFFFF;
+            uint16_t BlockIndex = kNoBlock;
+            uint32_t Offset = 0;
+            uint32_t Size = 0;
+        };
+
+        std::vector<UniformBlockStaging> m_BlockStaging;
+        mutable std::vector<BlockMemberRef> m_HandleMembers;
+        bool m_BlockRecording = false;
     };
 
 } // namespace Vortex
@@ -12,19 +12,61 @@ namespace Vortex
         GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::UniformBuffer), m_RendererID);
         if (size > 0)
         {
-            GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::UniformBuffer), initialData, size,
-                static_cast<uint32_t>(BufferUsage::DynamicDraw));
+            // Preferred path: immutable storage holding a small ring of
+            // sections, persistently mapped once. Per-frame updates become a
+            // memcpy + BindBufferRange instead of glBufferData orphaning,
+            // which re-allocates in the driver and can stall when the buffer
+            // is still in flight.
+            m_AlignedSize = (size + kOffsetAlignment - 1) & ~(kOffsetAlignment - 1);
+            const uint64_t ringBytes = static_cast<uint64_t>(m_AlignedSize) * kRingSections;
+            const uint32_t persistentFlags = ToFlags(BufferStorageFlags::MapWriteBit |
+                BufferStorageFlags::MapPersistentBit | BufferStorageFlags::MapCoherentBit);
+            GetRenderCommandQueue().BufferStorage(static_cast<uint32_t>(BufferTarget::UniformBuffer), ringBytes, persistentFlags);
+            void* mappedPtr = nullptr;
+            GetRenderCommandQueue().MapBufferRange(static_cast<uint32_t>(BufferTarget::UniformBuffer), 0, ringBytes,
+                ToFlags(MapBufferAccess::MapWriteBit | MapBufferAccess::MapPersistentBit | MapBufferAccess::MapCoherentBit),
+                &mappedPtr);
+            m_MappedPtr = static_cast<uint8_t*>(mappedPtr);
+
+            if (m_MappedPtr)
+            {
+                if (initialData)
+                {
+                    std::memcpy(m_MappedPtr, initialData, size);
+                }
+            }
+            else
+            {
+                // No immutable storage / persistent mapping (pre-GL 4.4):
+                // fall back to the mutable orphaning path
+                GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::UniformBuffer), initialData, size,
+                    static_cast<uint32_t>(BufferUsage::DynamicDraw));
+            }
         }
         if (bindingIndex != UINT32_MAX)
         {
-            GetRenderCommandQueue().BindBufferBase(BufferTarget::UniformBuffer, bindingIndex, m_RendererID);
+            BindBase(bindingIndex);
         }
     }
 
     OpenGLUniformBuffer::~OpenGLUniformBuffer()
     {
+        for (uint64_t& fence : m_SectionFences)
+        {
+            if (fence != 0ull)
+            {
+                GetRenderCommandQueue().DeleteSync(fence);
+                fence = 0ull;
+            }
+        }
         if (m_RendererID)
         {
+            if (m_MappedPtr)
+            {
+                GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::UniformBuffer), m_RendererID, true);
+                GetRenderCommandQueue().UnmapBuffer(static_cast<uint32_t>(BufferTarget::UniformBuffer), true);
+                m_MappedPtr = nullptr;
+            }
             GetRenderCommandQueue().DeleteBuffers(1, &m_RendererID, true);
             m_RendererID = 0;
         }
@@ -32,6 +74,47 @@ namespace Vortex
 
     void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
     {
+        if (m_MappedPtr && offset == 0 && size == m_Size)
+        {
+            // Fence the draws that consume the section written last frame,
+            // then rotate to the next one and make sure the GPU is done with
+            // it (only blocks if the CPU runs more than kRingSections frames
+            // ahead)
+            if (m_SectionFences[m_CurrentSection] != 0ull)
+            {
+                GetRenderCommandQueue().DeleteSync(m_SectionFences[m_CurrentSection]);
+            }
+            uint64_t fenceHandle = 0ull;
+            GetRenderCommandQueue().FenceSync(&fenceHandle);
+            m_SectionFences[m_CurrentSection] = fenceHandle;
+
+            m_CurrentSection = (m_CurrentSection + 1) % kRingSections;
+            if (m_SectionFences[m_CurrentSection] != 0ull)
+            {
+                uint32_t status = 0;
+                GetRenderCommandQueue().ClientWaitSync(m_SectionFences[m_CurrentSection],
+                    ToFlags(SyncWaitFlags::FlushCommandsBit), ~0ull, &status);
+                GetRenderCommandQueue().DeleteSync(m_SectionFences[m_CurrentSection]);
+                m_SectionFences[m_CurrentSection] = 0ull;
+            }
+
+            std::memcpy(m_MappedPtr + static_cast<size_t>(m_CurrentSection) * m_AlignedSize, data, size);
+            if (m_BindingIndex != UINT32_MAX)
+            {
+                GetRenderCommandQueue().BindBufferRange(static_cast<uint32_t>(BufferTarget::UniformBuffer), m_BindingIndex,
+                    m_RendererID, static_cast<uint64_t>(m_CurrentSection) * m_AlignedSize, m_Size);
+            }
+            return;
+        }
+
+        if (m_MappedPtr)
+        {
+            // Partial update patches the section in place; like BufferSubData
+            // this assumes the caller knows the range is not still in flight
+            std::memcpy(m_MappedPtr + static_cast<size_t>(m_CurrentSection) * m_AlignedSize + offset, data, size);
+            return;
+        }
+
         GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::UniformBuffer), m_RendererID);
         if (offset == 0 && size == m_Size)
         {
@@ -46,8 +129,12 @@ namespace Vortex
 
     void OpenGLUniformBuffer::BindBase(uint32_t bindingIndex) const
     {
+        if (m_MappedPtr)
+        {
+            GetRenderCommandQueue().BindBufferRange(static_cast<uint32_t>(BufferTarget::UniformBuffer), bindingIndex,
+                m_RendererID, static_cast<uint64_t>(m_CurrentSection) * m_AlignedSize, m_Size);
+            return;
+        }
         GetRenderCommandQueue().BindBufferBase(BufferTarget::UniformBuffer, bindingIndex, m_RendererID);
     }
 }
-
-
@@ -15,10 +15,23 @@ namespace Vortex
         uint32_t GetRendererID() const override { return m_RendererID; }
 
     private:
+        // Sections in the persistent-mapped ring; matches the renderer's
+        // triple-buffered frames-in-flight so a section is never rewritten
+        // while the GPU may still read it
+        static constexpr uint32_t kRingSections = 3;
+        // Conservative upper bound for GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT;
+        // section offsets must be multiples of the implementation's value
+        static constexpr uint32_t kOffsetAlignment = 256;
+
         uint32_t m_RendererID = 0;
         uint32_t m_BindingIndex = 0;
         uint32_t m_Size = 0;
+
+        // Persistent-mapped ring state; m_MappedPtr stays null when persistent
+        // mapping is unavailable and updates fall back to orphaning
+        uint8_t* m_MappedPtr = nullptr;
+        uint32_t m_AlignedSize = 0;
+        uint32_t m_CurrentSection = 0;
+        uint64_t m_SectionFences[kRingSections] = {};
     };
 }
-
-
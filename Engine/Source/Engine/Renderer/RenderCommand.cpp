@@ -4,9 +4,95 @@
 #include "GraphicsContext.h"
 #include "Core/Debug/Log.h"
 
-namespace Vortex 
+#include <mutex>
+
+namespace Vortex
 {
 
+    // ------------------------ Command slab pool --------------------------
+    //
+    // Backing store for RenderCommand::operator new/delete. Slots are a
+    // fixed size covering every command type in RenderCommand.h; freed
+    // slots go on a free list and slabs are only ever appended, so a
+    // command allocation after warm-up is a mutex-guarded pointer pop.
+    // The mutex is held for a few instructions; contention is limited to
+    // worker threads recording batches concurrently, which previously
+    // contended inside malloc instead.
+    namespace
+    {
+        constexpr size_t kCommandSlotSize = 192;
+        constexpr size_t kSlotsPerSlab = 256;
+
+        struct CommandSlot
+        {
+            CommandSlot* Next;
+        };
+
+        struct CommandPool
+        {
+            std::mutex Mutex;
+            CommandSlot* FreeList = nullptr;
+        };
+
+        // Deliberately leaked: commands can still be freed during static
+        // destruction (e.g. the global queue draining at exit), so the pool
+        // must outlive every static that might hold a command
+        CommandPool& GetCommandPool()
+        {
+            static CommandPool* pool = new CommandPool();
+            return *pool;
+        }
+    }
+
+    void* RenderCommand::operator new(size_t size)
+    {
+        // Commands that outgrow the slot (or future ones with big inline
+        // payloads) silently use the global allocator; the sized delete
+        // below makes the same decision, so the paths always match
+        if (size > kCommandSlotSize)
+        {
+            return ::operator new(size);
+        }
+
+        CommandPool& pool = GetCommandPool();
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        if (!pool.FreeList)
+        {
+            // Slabs are never returned to the OS; the pool's high-water mark
+            // matches the deepest queue the app ever records
+            auto* slab = static_cast<unsigned char*>(::operator new(kCommandSlotSize * kSlotsPerSlab));
+            for (size_t i = 0; i < kSlotsPerSlab; ++i)
+            {
+                auto* slot = reinterpret_cast<CommandSlot*>(slab + i * kCommandSlotSize);
+                slot->Next = pool.FreeList;
+                pool.FreeList = slot;
+            }
+        }
+
+        CommandSlot* slot = pool.FreeList;
+        pool.FreeList = slot->Next;
+        return slot;
+    }
+
+    void RenderCommand::operator delete(void* ptr, size_t size) noexcept
+    {
+        if (!ptr)
+        {
+            return;
+        }
+        if (size > kCommandSlotSize)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        CommandPool& pool = GetCommandPool();
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        auto* slot = static_cast<CommandSlot*>(ptr);
+        slot->Next = pool.FreeList;
+        pool.FreeList = slot;
+    }
+
     // --------------------------- ClearCommand ---------------------------
     Result<void> ClearCommand::Execute(GraphicsContext* /*context*/) {
         auto* renderer = GetRenderer();
@@ -82,6 +168,34 @@ namespace Vortex
         return renderer->BufferSubData(m_Target, m_Offset, m_Size, dataPtr);
     }
 
+    Result<void> CopyBufferSubDataCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->CopyBufferSubData(m_ReadTarget, m_WriteTarget, m_ReadOffset, m_WriteOffset, m_Size);
+    }
+
+    Result<void> DrawArraysIndirectCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->DrawArraysIndirect(m_PrimitiveTopology, m_Offset);
+    }
+
+    Result<void> DispatchComputeCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->DispatchCompute(m_GroupsX, m_GroupsY, m_GroupsZ);
+    }
+
+    Result<void> MemoryBarrierCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->MemoryBarrier(m_BarrierBits);
+    }
+
     Result<void> BufferStorageCommand::Execute(GraphicsContext* /*context*/)
     {
         auto* renderer = GetRenderer();
@@ -103,6 +217,13 @@ namespace Vortex
         return renderer->UnmapBuffer(m_Target);
     }
 
+    Result<void> FlushMappedBufferRangeCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->FlushMappedBufferRange(m_Target, m_Offset, m_Length);
+    }
+
     // --------------------- VertexAttribPointerCommand --------------------
     Result<void> VertexAttribPointerCommand::Execute(GraphicsContext* /*context*/)
     {
@@ -133,6 +254,26 @@ namespace Vortex
         return renderer->EnableVertexAttribArray(m_Index, m_Enabled);
     }
 
+    // -------------------- BindVertexAttribTableCommand -------------------
+    Result<void> BindVertexAttribTableCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        for (uint32_t i = 0; i < m_Count; ++i)
+        {
+            const AttribDesc& d = m_Descs[i];
+            auto res = renderer->EnableVertexAttribArray(d.Index, true);
+            if (!res.IsSuccess()) return res;
+            res = d.Integer
+                ? renderer->VertexAttribIPointer(d.Index, d.Size, d.Type, m_Stride, m_BaseOffset + d.Offset)
+                : renderer->VertexAttribPointer(d.Index, d.Size, d.Type, d.Normalized, m_Stride, m_BaseOffset + d.Offset);
+            if (!res.IsSuccess()) return res;
+            res = renderer->VertexAttribDivisor(d.Index, d.Divisor);
+            if (!res.IsSuccess()) return res;
+        }
+        return Result<void>();
+    }
+
     // ----------------------- BindVertexArrayCommand ----------------------
     Result<void> BindVertexArrayCommand::Execute(GraphicsContext* /*context*/) {
         auto* renderer = GetRenderer();
@@ -161,6 +302,13 @@ namespace Vortex
         return renderer->BindBufferBase(m_Target, m_Index, m_Buffer);
     }
 
+    Result<void> BindBufferRangeCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->BindBufferRange(m_Target, m_Index, m_Buffer, m_Offset, m_Size);
+    }
+
     Result<void> FenceSyncCommand::Execute(GraphicsContext* /*context*/)
     {
         auto* renderer = GetRenderer();
@@ -282,6 +430,20 @@ namespace Vortex
         return renderer->DeleteTextures(m_Count, m_Textures);
     }
 
+    Result<void> GetTextureHandleCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->GetTextureHandle(m_Texture, m_Sampler, m_OutHandle);
+    }
+
+    Result<void> MakeTextureHandleResidentCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->MakeTextureHandleResident(m_Handle, m_Resident);
+    }
+
     Result<void> BindTextureTargetCommand::Execute(GraphicsContext* /*context*/)
     {
         auto* renderer = GetRenderer();
@@ -297,6 +459,14 @@ namespace Vortex
         return renderer->TexImage2D(m_Target, m_Level, m_InternalFormat, m_Width, m_Height, m_Format, m_Type, dataPtr);
     }
 
+    Result<void> TexSubImage2DAsyncCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->TexSubImage2DAsync(m_Texture, m_Level, m_X, m_Y, m_Width, m_Height,
+                                            m_Format, m_Type, m_StagingBuffer, m_StagingOffset, m_OutFence);
+    }
+
     Result<void> TexParameteriCommand::Execute(GraphicsContext* /*context*/)
     {
         auto* renderer = GetRenderer();
@@ -354,4 +524,18 @@ namespace Vortex
         return renderer->SetDrawBuffers(m_Count, m_Attachments);
     }
 
+    Result<void> InvalidateFramebufferCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->InvalidateFramebuffer(m_Target, m_Count, m_Attachments);
+    }
+
+    Result<void> ClearNamedFramebufferCommand::Execute(GraphicsContext* /*context*/)
+    {
+        auto* renderer = GetRenderer();
+        if (!renderer) return Result<void>(ErrorCode::InvalidState, "Renderer not initialized");
+        return renderer->ClearNamedFramebuffer(m_Fbo, m_ColorCount, m_Colors, m_ClearDepthStencil, m_Depth, m_Stencil);
+    }
+
 } // namespace Vortex
\ No newline at end of file
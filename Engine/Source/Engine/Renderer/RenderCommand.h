@@ -6,6 +6,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 
 namespace Vortex
 {
@@ -42,6 +43,15 @@ namespace Vortex
          * @return Estimated relative cost (1.0 = baseline draw call)
          */
         virtual float GetEstimatedCost() const { return 1.0f; }
+
+        // Commands are allocated and freed at recording frequency, so they
+        // come from a slab pool instead of the general heap: constant-time
+        // alloc/free, and commands recorded together sit in the same slabs
+        // for better cache behaviour when the queue drains. Oversized
+        // commands fall back to the global allocator transparently, so
+        // make_unique call sites need no changes.
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size) noexcept;
     };
 
     // ============================================================================
@@ -62,9 +72,9 @@ namespace Vortex
             All = Color | Depth | Stencil
         };
 
-        ClearCommand(uint32_t flags = ClearFlags::All, 
-                    const glm::vec4& color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
-                    float depth = 1.0f, 
+        ClearCommand(uint32_t flags = ClearFlags::All,
+                    glm::vec4 color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
+                    float depth = 1.0f,
                     int32_t stencil = 0)
             : m_Flags(flags), m_ClearColor(color), m_DepthValue(depth), m_StencilValue(stencil) {}
 
@@ -280,6 +290,80 @@ namespace Vortex
         uint64_t m_Size;
     };
 
+    /**
+     * @brief Command to copy a byte range between two bound buffer targets (GPU-side)
+     */
+    class CopyBufferSubDataCommand : public RenderCommand
+    {
+    public:
+        CopyBufferSubDataCommand(uint32_t readTarget, uint32_t writeTarget, uint64_t readOffset, uint64_t writeOffset, uint64_t size)
+            : m_ReadTarget(readTarget), m_WriteTarget(writeTarget), m_ReadOffset(readOffset), m_WriteOffset(writeOffset), m_Size(size) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "CopyBufferSubData"; }
+        float GetEstimatedCost() const override { return static_cast<float>(m_Size) * 1e-9f; }
+
+    private:
+        uint32_t m_ReadTarget;
+        uint32_t m_WriteTarget;
+        uint64_t m_ReadOffset;
+        uint64_t m_WriteOffset;
+        uint64_t m_Size;
+    };
+
+    /**
+     * @brief Command to issue an instanced draw whose parameters live in the bound indirect buffer
+     */
+    class DrawArraysIndirectCommand : public RenderCommand
+    {
+    public:
+        DrawArraysIndirectCommand(uint32_t primitiveTopology, uint64_t offset)
+            : m_PrimitiveTopology(primitiveTopology), m_Offset(offset) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "DrawArraysIndirect"; }
+        float GetEstimatedCost() const override { return 1.0f; }
+
+    private:
+        uint32_t m_PrimitiveTopology;
+        uint64_t m_Offset;
+    };
+
+    /**
+     * @brief Command to dispatch a compute workload with the currently bound program
+     */
+    class DispatchComputeCommand : public RenderCommand
+    {
+    public:
+        DispatchComputeCommand(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+            : m_GroupsX(groupsX), m_GroupsY(groupsY), m_GroupsZ(groupsZ) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "DispatchCompute"; }
+        float GetEstimatedCost() const override { return 0.5f; }
+
+    private:
+        uint32_t m_GroupsX;
+        uint32_t m_GroupsY;
+        uint32_t m_GroupsZ;
+    };
+
+    /**
+     * @brief Command to insert a memory barrier between shader writes and subsequent reads
+     */
+    class MemoryBarrierCommand : public RenderCommand
+    {
+    public:
+        explicit MemoryBarrierCommand(uint32_t barrierBits) : m_BarrierBits(barrierBits) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "MemoryBarrier"; }
+        float GetEstimatedCost() const override { return 0.05f; }
+
+    private:
+        uint32_t m_BarrierBits;
+    };
+
     class BufferStorageCommand : public RenderCommand
     {
     public:
@@ -323,6 +407,23 @@ namespace Vortex
         uint32_t m_Target;
     };
 
+    /**
+     * @brief Command to flush a written range of an explicitly flushed mapping
+     */
+    class FlushMappedBufferRangeCommand : public RenderCommand
+    {
+    public:
+        FlushMappedBufferRangeCommand(uint32_t target, uint64_t offset, uint64_t length)
+            : m_Target(target), m_Offset(offset), m_Length(length) {}
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "FlushMappedBufferRange"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+    private:
+        uint32_t m_Target;
+        uint64_t m_Offset;
+        uint64_t m_Length;
+    };
+
     /**
      * @brief Command to set vertex attribute pointer
      */
@@ -401,6 +502,47 @@ namespace Vortex
         bool m_Enabled;
     };
 
+    /**
+     * @brief Command to configure a whole table of vertex attributes in one submission
+     *
+     * Collapses N separate Enable/Pointer/Divisor submissions into a single queue
+     * entry (one lock acquisition instead of 3*N). The descriptor table is copied
+     * by value, so callers may hand in a static/constexpr layout.
+     */
+    class BindVertexAttribTableCommand : public RenderCommand
+    {
+    public:
+        static constexpr uint32_t MaxAttribs = 8;
+
+        struct AttribDesc
+        {
+            uint32_t Index;
+            int32_t  Size;
+            uint32_t Type;
+            bool     Normalized;  // ignored for integer attributes
+            bool     Integer;     // route through VertexAttribIPointer
+            uint32_t Divisor;
+            uint64_t Offset;      // relative to the table's base offset
+        };
+
+        BindVertexAttribTableCommand(const AttribDesc* descs, uint32_t count, uint64_t stride, uint64_t baseOffset)
+            : m_Count(count < MaxAttribs ? count : MaxAttribs), m_Stride(stride), m_BaseOffset(baseOffset)
+        {
+            for (uint32_t i = 0; i < m_Count; ++i)
+                m_Descs[i] = descs[i];
+        }
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "BindVertexAttribTable"; }
+        float GetEstimatedCost() const override { return 0.01f * m_Count; }
+
+    private:
+        AttribDesc m_Descs[MaxAttribs] = {};
+        uint32_t m_Count;
+        uint64_t m_Stride;
+        uint64_t m_BaseOffset;
+    };
+
     /**
      * @brief Command to bind a vertex array object (VAO)
      */
@@ -535,6 +677,24 @@ namespace Vortex
         uint32_t m_Buffer;
     };
 
+    class BindBufferRangeCommand : public RenderCommand
+    {
+    public:
+        BindBufferRangeCommand(uint32_t target, uint32_t index, uint32_t buffer, uint64_t offset, uint64_t size)
+            : m_Target(target), m_Index(index), m_Buffer(buffer), m_Offset(offset), m_Size(size) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "BindBufferRange"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+
+    private:
+        uint32_t m_Target;
+        uint32_t m_Index;
+        uint32_t m_Buffer;
+        uint64_t m_Offset;
+        uint64_t m_Size;
+    };
+
     // Sync commands
     class FenceSyncCommand : public RenderCommand
     {
@@ -695,14 +855,26 @@ namespace Vortex
     class PushDebugGroupCommand : public RenderCommand
     {
     public:
-        PushDebugGroupCommand(const std::string& name) : m_Name(name) {}
+        /** Copies the name into owned storage */
+        PushDebugGroupCommand(std::string_view name) : m_Owned(name), m_Name(m_Owned) {}
+
+        /**
+         * @brief Adopt a name whose storage outlives the command
+         * @param name View into stable memory (the renderer frame arena)
+         *
+         * Skips the owned copy; the queue wrapper uses this after parking
+         * the name in the frame arena, which is reset only after commands
+         * have been processed.
+         */
+        PushDebugGroupCommand(std::string_view name, bool /*stableStorage*/) : m_Name(name) {}
 
         Result<void> Execute(GraphicsContext* context) override;
         std::string GetDebugName() const override { return "PushDebugGroup"; }
         float GetEstimatedCost() const override { return 0.001f; }
 
     private:
-        std::string m_Name;
+        std::string m_Owned;
+        std::string_view m_Name;
     };
 
     /**
@@ -758,6 +930,43 @@ namespace Vortex
         const uint32_t* m_Textures;
     };
 
+    /**
+     * @brief Query a bindless handle for a texture (writes to caller pointer)
+     */
+    class GetTextureHandleCommand : public RenderCommand
+    {
+    public:
+        GetTextureHandleCommand(uint32_t texture, uint32_t sampler, uint64_t* outHandle)
+            : m_Texture(texture), m_Sampler(sampler), m_OutHandle(outHandle) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "GetTextureHandle"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+
+    private:
+        uint32_t m_Texture;
+        uint32_t m_Sampler;
+        uint64_t* m_OutHandle;
+    };
+
+    /**
+     * @brief Change residency of a bindless texture handle
+     */
+    class MakeTextureHandleResidentCommand : public RenderCommand
+    {
+    public:
+        MakeTextureHandleResidentCommand(uint64_t handle, bool resident)
+            : m_Handle(handle), m_Resident(resident) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "MakeTextureHandleResident"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+
+    private:
+        uint64_t m_Handle;
+        bool m_Resident;
+    };
+
     /**
      * @brief Bind a texture to a target (e.g., GL_TEXTURE_2D)
      */
@@ -811,6 +1020,40 @@ namespace Vortex
         std::shared_ptr<ByteVector> m_Payload;
     };
 
+    /**
+     * @brief Async texture region upload from a staging buffer
+     *
+     * No pixel payload travels with the command: the data already lives in
+     * the staging buffer, so this stays cheap to queue for streaming.
+     */
+    class TexSubImage2DAsyncCommand : public RenderCommand
+    {
+    public:
+        TexSubImage2DAsyncCommand(uint32_t texture, int32_t level, uint32_t x, uint32_t y,
+                                  uint32_t width, uint32_t height, uint32_t format, uint32_t type,
+                                  uint32_t stagingBuffer, uint64_t stagingOffset, uint64_t* outFence)
+            : m_Texture(texture), m_Level(level), m_X(x), m_Y(y),
+              m_Width(width), m_Height(height), m_Format(format), m_Type(type),
+              m_StagingBuffer(stagingBuffer), m_StagingOffset(stagingOffset), m_OutFence(outFence) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "TexSubImage2DAsync"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+
+    private:
+        uint32_t m_Texture;
+        int32_t m_Level;
+        uint32_t m_X;
+        uint32_t m_Y;
+        uint32_t m_Width;
+        uint32_t m_Height;
+        uint32_t m_Format;
+        uint32_t m_Type;
+        uint32_t m_StagingBuffer;
+        uint64_t m_StagingOffset;
+        uint64_t* m_OutFence;
+    };
+
     /**
      * @brief Set integer texture parameter
      */
@@ -943,4 +1186,49 @@ namespace Vortex
         uint32_t m_Count;
         const uint32_t* m_Attachments;
     };
+
+    class InvalidateFramebufferCommand : public RenderCommand
+    {
+    public:
+        // Copies the attachment list: pass-end callers build it on the stack,
+        // so a queued command cannot hold a pointer into the caller's frame
+        static constexpr uint32_t kMaxAttachments = 8;
+
+        InvalidateFramebufferCommand(uint32_t target, uint32_t count, const uint32_t* attachments)
+            : m_Target(target), m_Count(count < kMaxAttachments ? count : kMaxAttachments)
+        {
+            for (uint32_t i = 0; i < m_Count; ++i)
+                m_Attachments[i] = attachments[i];
+        }
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "InvalidateFramebuffer"; }
+        float GetEstimatedCost() const override { return 0.01f; }
+
+    private:
+        uint32_t m_Target;
+        uint32_t m_Count;
+        uint32_t m_Attachments[kMaxAttachments] = {};
+    };
+
+    class ClearNamedFramebufferCommand : public RenderCommand
+    {
+    public:
+        ClearNamedFramebufferCommand(uint32_t fbo, uint32_t colorCount, const ClearAttachmentDesc* colors,
+                                     bool clearDepthStencil, float depth, int32_t stencil)
+            : m_Fbo(fbo), m_ColorCount(colorCount), m_Colors(colors),
+              m_ClearDepthStencil(clearDepthStencil), m_Depth(depth), m_Stencil(stencil) {}
+
+        Result<void> Execute(GraphicsContext* context) override;
+        std::string GetDebugName() const override { return "ClearNamedFramebuffer"; }
+        float GetEstimatedCost() const override { return 0.05f * m_ColorCount; }
+
+    private:
+        uint32_t m_Fbo;
+        uint32_t m_ColorCount;
+        const ClearAttachmentDesc* m_Colors;
+        bool m_ClearDepthStencil;
+        float m_Depth;
+        int32_t m_Stencil;
+    };
 }
@@ -0,0 +1,16 @@
+#include "vxpch.h"
+#include "RenderCommandList.h"
+#include "RenderCommandQueue.h"
+
+namespace Vortex
+{
+    size_t RenderCommandList::Submit()
+    {
+        if (m_Commands.empty())
+            return 0;
+
+        // Moving the vector out keeps its heap allocation with the batch;
+        // m_Commands is left empty-but-alive for the next recording pass
+        return GetRenderCommandQueue().SubmitBatch(std::move(m_Commands));
+    }
+}
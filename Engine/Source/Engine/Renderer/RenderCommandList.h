@@ -0,0 +1,134 @@
+#pragma once
+
+#include "RenderCommand.h"
+
+#include <memory>
+#include <vector>
+
+namespace Vortex
+{
+    /**
+     * @brief Per-thread command recorder for parallel encoding
+     *
+     * The global RenderCommandQueue serializes every Submit behind its
+     * mutex, so threads recording directly into it contend once per
+     * command. A RenderCommandList is owned by one recording thread and
+     * appends lock-free into a local vector; Submit hands the whole list
+     * to the queue through SubmitBatch under a single lock. Commands
+     * within one list keep their recording order, ordering between lists
+     * is whichever handoff wins the lock — same contract SubmitBatch
+     * already documents.
+     *
+     * Command allocation is thread-safe (commands come from the slab pool
+     * behind RenderCommand::operator new), so worker threads can record
+     * concurrently without touching the queue until the handoff.
+     */
+    class RenderCommandList
+    {
+    public:
+        RenderCommandList() = default;
+
+        // One recording thread per list; moves are for handing a finished
+        // list to the submitter, not for concurrent use
+        RenderCommandList(const RenderCommandList&) = delete;
+        RenderCommandList& operator=(const RenderCommandList&) = delete;
+        RenderCommandList(RenderCommandList&&) = default;
+        RenderCommandList& operator=(RenderCommandList&&) = default;
+
+        /**
+         * @brief Append an already-built command
+         */
+        void Record(std::unique_ptr<RenderCommand> command)
+        {
+            m_Commands.push_back(std::move(command));
+        }
+
+        // Typed recording helpers mirroring the queue's convenience API
+
+        void Clear(uint32_t flags = ClearCommand::All,
+            glm::vec4 color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
+            float depth = 1.0f,
+            int32_t stencil = 0)
+        {
+            Record(std::make_unique<ClearCommand>(flags, color, depth, stencil));
+        }
+
+        void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+        {
+            Record(std::make_unique<SetViewportCommand>(x, y, width, height));
+        }
+
+        void DrawIndexed(uint32_t indexCount,
+            uint32_t instanceCount = 1,
+            uint32_t firstIndex = 0,
+            int32_t baseVertex = 0,
+            uint32_t baseInstance = 0,
+            uint32_t primitiveTopology = static_cast<uint32_t>(PrimitiveTopology::Triangles))
+        {
+            Record(std::make_unique<DrawIndexedCommand>(indexCount, instanceCount, firstIndex, baseVertex, baseInstance, primitiveTopology));
+        }
+
+        void DrawArrays(uint32_t vertexCount,
+            uint32_t instanceCount = 1,
+            uint32_t firstVertex = 0,
+            uint32_t baseInstance = 0,
+            uint32_t primitiveTopology = static_cast<uint32_t>(PrimitiveTopology::Triangles))
+        {
+            Record(std::make_unique<DrawArraysCommand>(vertexCount, instanceCount, firstVertex, baseInstance, primitiveTopology));
+        }
+
+        void BindShader(uint32_t program)
+        {
+            Record(std::make_unique<BindShaderCommand>(program));
+        }
+
+        void BindVertexArray(uint32_t vao)
+        {
+            Record(std::make_unique<BindVertexArrayCommand>(vao));
+        }
+
+        void BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler = 0)
+        {
+            Record(std::make_unique<BindTextureCommand>(slot, texture, sampler));
+        }
+
+        void SetDepthState(bool testEnabled, bool writeEnabled,
+            SetDepthStateCommand::CompareFunction func = SetDepthStateCommand::Less)
+        {
+            Record(std::make_unique<SetDepthStateCommand>(testEnabled, writeEnabled, func));
+        }
+
+        void SetBlendState(bool enabled,
+            SetBlendStateCommand::BlendFactor srcFactor = SetBlendStateCommand::SrcAlpha,
+            SetBlendStateCommand::BlendFactor dstFactor = SetBlendStateCommand::OneMinusSrcAlpha,
+            SetBlendStateCommand::BlendOperation op = SetBlendStateCommand::Add)
+        {
+            Record(std::make_unique<SetBlendStateCommand>(enabled, srcFactor, dstFactor, op));
+        }
+
+        void SetCullState(SetCullStateCommand::CullMode mode,
+            SetCullStateCommand::FrontFace face = SetCullStateCommand::CounterClockwise)
+        {
+            Record(std::make_unique<SetCullStateCommand>(mode, face));
+        }
+
+        /**
+         * @brief Hand the recorded commands to the global queue in one batch
+         * @return Number of commands the queue accepted
+         *
+         * The list is empty afterwards and can be reused for the next frame.
+         */
+        size_t Submit();
+
+        size_t GetCommandCount() const { return m_Commands.size(); }
+        bool IsEmpty() const { return m_Commands.empty(); }
+
+        /**
+         * @brief Drop recorded commands without submitting them
+         */
+        void Reset() { m_Commands.clear(); }
+
+    private:
+        std::vector<std::unique_ptr<RenderCommand>> m_Commands;
+    };
+}
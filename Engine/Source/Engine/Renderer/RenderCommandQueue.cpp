@@ -47,6 +47,16 @@ namespace Vortex
 
         if (executeImmediate || IsOnRenderThread()) {
             std::lock_guard<std::mutex> lock(m_ExecutionMutex);
+            // Fast path: with profiling off, the only per-command work besides
+            // Execute itself is one counter bump. The clock reads, debug-name
+            // string and per-command stats maps are profiling features, and on
+            // hot frames (thousands of immediate commands) they dominate the
+            // dispatch cost many times over.
+            if (!m_Config.EnableProfiling) {
+                auto res = ExecuteCommand(std::move(command));
+                m_Stats.ProcessedCommands++;
+                return res.IsSuccess();
+            }
             auto start = std::chrono::high_resolution_clock::now();
             // Capture command info before moving
             const std::string cmdName = command->GetDebugName();
@@ -75,9 +85,40 @@ namespace Vortex
     }
 
     size_t RenderCommandQueue::SubmitBatch(std::vector<std::unique_ptr<RenderCommand>> commands, bool executeImmediate) {
+        // On the render thread (or when asked to), preserve the one-by-one
+        // immediate semantics of Submit
+        if (executeImmediate || IsOnRenderThread()) {
+            size_t submitted = 0;
+            for (auto& cmd : commands) {
+                if (Submit(std::move(cmd), executeImmediate)) submitted++;
+            }
+            return submitted;
+        }
+
+        // Cross-thread handoff path: worker threads record commands into their
+        // own vector without any synchronization, then enqueue the whole batch
+        // under a single lock here. This is the parallel-recording model —
+        // the per-thread vector plays the role of a command encoder and this
+        // call is its submit — and it deliberately skips Submit's
+        // render-thread assert, which exists to catch accidental one-off
+        // queued submissions, not batch handoffs.
         size_t submitted = 0;
-        for (auto& cmd : commands) {
-            if (Submit(std::move(cmd), executeImmediate)) submitted++;
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            for (auto& cmd : commands) {
+                if (!cmd) continue;
+                if (m_CommandQueue.size() >= m_Config.MaxQueuedCommands) {
+                    if (m_Config.WarnOnDrop) {
+                        VX_CORE_WARN("RenderCommandQueue full ({}). Dropping command.", m_Config.MaxQueuedCommands);
+                    }
+                    m_Stats.DroppedCommands++;
+                    continue;
+                }
+                m_CommandQueue.push(std::move(cmd));
+                m_Stats.QueuedCommands++;
+                m_Stats.TotalCommandsThisFrame++;
+                submitted++;
+            }
         }
         return submitted;
     }
@@ -100,6 +141,17 @@ namespace Vortex
                 m_CommandQueue.pop();
             }
 
+            // Same profiling gate as the immediate path in Submit
+            if (!m_Config.EnableProfiling) {
+                auto res = ExecuteCommand(std::move(cmd));
+                if (!res.IsSuccess()) {
+                    VX_CORE_ERROR("Render command failed: {}", res.GetErrorMessage());
+                }
+                processed++;
+                m_Stats.ProcessedCommands++;
+                continue;
+            }
+
             auto start = std::chrono::high_resolution_clock::now();
             // Capture command info before moving
             const std::string cmdName = cmd->GetDebugName();
@@ -17,6 +17,21 @@ namespace Vortex
     // Forward declarations
     class GraphicsContext;
 
+    /**
+     * @brief Copy a transient string into the renderer's frame arena
+     * @param text String to copy
+     * @return Arena-resident copy valid until the frame reset, or nullptr
+     *         when no renderer is active or the arena is full
+     */
+    inline const char* CopyToFrameArena(std::string_view text)
+    {
+        if (RendererAPI* renderer = GetRenderer())
+        {
+            return renderer->GetFrameArena().AllocateString(text);
+        }
+        return nullptr;
+    }
+
     /**
      * @brief Thread-safe queue for render commands with automatic dispatching
      *
@@ -100,6 +115,11 @@ namespace Vortex
          * @param commands Vector of commands to submit
          * @param executeImmediate If true, execute immediately on calling thread
          * @return Number of commands successfully queued/executed
+         *
+         * Unlike Submit, queued batches may come from any thread: record into
+         * a per-thread vector lock-free, then hand the whole thing over here
+         * under one lock. Commands from one batch stay in recording order;
+         * ordering between batches is whichever handoff wins the lock.
          */
         size_t SubmitBatch(std::vector<std::unique_ptr<RenderCommand>> commands, bool executeImmediate = false);
 
@@ -171,7 +191,7 @@ namespace Vortex
          * @return True if successfully submitted
          */
         bool Clear(uint32_t flags = ClearCommand::All,
-            const glm::vec4& color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
+            glm::vec4 color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
             float depth = 1.0f,
             int32_t stencil = 0,
             bool executeImmediate = false)
@@ -276,6 +296,26 @@ namespace Vortex
             return Submit(std::make_unique<BufferSubDataCommand>(target, offset, std::move(payload)), executeImmediate);
         }
 
+        bool CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, uint64_t readOffset, uint64_t writeOffset, uint64_t size, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<CopyBufferSubDataCommand>(readTarget, writeTarget, readOffset, writeOffset, size), executeImmediate);
+        }
+
+        bool DrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<DrawArraysIndirectCommand>(primitiveTopology, offset), executeImmediate);
+        }
+
+        bool DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<DispatchComputeCommand>(groupsX, groupsY, groupsZ), executeImmediate);
+        }
+
+        bool MemoryBarrier(uint32_t barrierBits, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<MemoryBarrierCommand>(barrierBits), executeImmediate);
+        }
+
         bool BufferStorage(uint32_t target, uint64_t size, uint32_t flags, bool executeImmediate = true)
         {
             return Submit(std::make_unique<BufferStorageCommand>(target, size, flags), executeImmediate);
@@ -291,6 +331,11 @@ namespace Vortex
             return Submit(std::make_unique<UnmapBufferCommand>(target), executeImmediate);
         }
 
+        bool FlushMappedBufferRange(uint32_t target, uint64_t offset, uint64_t length, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<FlushMappedBufferRangeCommand>(target, offset, length), executeImmediate);
+        }
+
         bool BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler = 0, bool executeImmediate = false)
         {
             return Submit(std::make_unique<BindTextureCommand>(slot, texture, sampler), executeImmediate);
@@ -318,6 +363,19 @@ namespace Vortex
             return Submit(std::make_unique<EnableVertexAttribArrayCommand>(index, enabled), executeImmediate);
         }
 
+        /**
+         * @brief Configure several vertex attributes with a single queued command
+         * @param descs Attribute descriptor table (copied; at most BindVertexAttribTableCommand::MaxAttribs entries)
+         * @param count Number of descriptors
+         * @param stride Byte stride shared by all attributes
+         * @param baseOffset Byte offset added to each descriptor's Offset
+         */
+        bool BindVertexAttribTable(const BindVertexAttribTableCommand::AttribDesc* descs, uint32_t count,
+                                   uint64_t stride, uint64_t baseOffset, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<BindVertexAttribTableCommand>(descs, count, stride, baseOffset), executeImmediate);
+        }
+
         // Object lifetime helpers
         bool GenBuffers(uint32_t count, uint32_t* outBuffers, bool executeImmediate = true)
         {
@@ -350,6 +408,18 @@ namespace Vortex
             return Submit(std::make_unique<DeleteTexturesCommand>(count, textures), executeImmediate);
         }
 
+        // Handle query is immediate by default so the caller can read the
+        // result; residency changes can queue like other binds
+        bool GetTextureHandle(uint32_t texture, uint32_t sampler, uint64_t* outHandle, bool executeImmediate = true)
+        {
+            return Submit(std::make_unique<GetTextureHandleCommand>(texture, sampler, outHandle), executeImmediate);
+        }
+
+        bool MakeTextureHandleResident(uint64_t handle, bool resident, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<MakeTextureHandleResidentCommand>(handle, resident), executeImmediate);
+        }
+
         bool BindTextureTarget(uint32_t target, uint32_t texture, bool executeImmediate = false)
         {
             return Submit(std::make_unique<BindTextureTargetCommand>(target, texture), executeImmediate);
@@ -373,6 +443,16 @@ namespace Vortex
             return Submit(std::make_unique<TexParameteriCommand>(target, pname, param), executeImmediate);
         }
 
+        // Pass executeImmediate=true when outFence must be readable on return
+        bool TexSubImage2DAsync(uint32_t texture, int32_t level, uint32_t x, uint32_t y,
+                                uint32_t width, uint32_t height, uint32_t format, uint32_t type,
+                                uint32_t stagingBuffer, uint64_t stagingOffset, uint64_t* outFence,
+                                bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<TexSubImage2DAsyncCommand>(texture, level, x, y, width, height,
+                format, type, stagingBuffer, stagingOffset, outFence), executeImmediate);
+        }
+
         bool GenerateMipmap(uint32_t target, bool executeImmediate = false)
         {
             return Submit(std::make_unique<GenerateMipmapCommand>(target), executeImmediate);
@@ -455,6 +535,18 @@ namespace Vortex
             return Submit(std::make_unique<SetDrawBuffersCommand>(count, attachments), executeImmediate);
         }
 
+        bool InvalidateFramebuffer(uint32_t target, uint32_t count, const uint32_t* attachments, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<InvalidateFramebufferCommand>(target, count, attachments), executeImmediate);
+        }
+
+        bool ClearNamedFramebuffer(uint32_t fbo, uint32_t colorCount, const ClearAttachmentDesc* colors,
+                                   bool clearDepthStencil = true, float depth = 1.0f, int32_t stencil = 0,
+                                   bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<ClearNamedFramebufferCommand>(fbo, colorCount, colors, clearDepthStencil, depth, stencil), executeImmediate);
+        }
+
         // UBO/SSBO binding helper
         bool BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer, bool executeImmediate = false)
         {
@@ -466,6 +558,11 @@ namespace Vortex
             return Submit(std::make_unique<BindBufferBaseCommand>(static_cast<uint32_t>(target), index, buffer), executeImmediate);
         }
 
+        bool BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, uint64_t offset, uint64_t size, bool executeImmediate = false)
+        {
+            return Submit(std::make_unique<BindBufferRangeCommand>(target, index, buffer, offset, size), executeImmediate);
+        }
+
         // Sync helpers
         bool FenceSync(uint64_t* outHandle, bool executeImmediate = true)
         {
@@ -488,8 +585,17 @@ namespace Vortex
          * @param executeImmediate Whether to execute immediately
          * @return True if successfully submitted
          */
-        bool PushDebugGroup(const std::string& name, bool executeImmediate = false)
-        {
+        bool PushDebugGroup(std::string_view name, bool executeImmediate = false)
+        {
+            // Park the name in the renderer's frame arena when possible so
+            // the deferred command holds a view instead of an owned string;
+            // the arena outlives the command (reset happens after command
+            // processing). Falls back to an owned copy when the arena is
+            // unavailable or full.
+            if (const char* arenaCopy = CopyToFrameArena(name))
+            {
+                return Submit(std::make_unique<PushDebugGroupCommand>(std::string_view(arenaCopy, name.size()), true), executeImmediate);
+            }
             return Submit(std::make_unique<PushDebugGroupCommand>(name), executeImmediate);
         }
 
@@ -583,6 +689,34 @@ namespace Vortex
      */
     Result<void> ShutdownGlobalRenderQueue();
 
+    // ============================================================================
+    // GPU DEBUG SCOPES
+    // ============================================================================
+
+    /**
+     * @brief RAII GPU debug group - pushes on construction, pops on destruction
+     *
+     * Use through VX_GPU_SCOPE so marker sites compile to nothing when GPU
+     * markers are disabled. The name is taken as a string_view and travels
+     * to the backend without constructing a std::string at the call site.
+     */
+    class GpuScope
+    {
+    public:
+        explicit GpuScope(std::string_view name)
+        {
+            GetRenderCommandQueue().PushDebugGroup(name);
+        }
+
+        ~GpuScope()
+        {
+            GetRenderCommandQueue().PopDebugGroup();
+        }
+
+        GpuScope(const GpuScope&) = delete;
+        GpuScope& operator=(const GpuScope&) = delete;
+    };
+
     // ============================================================================
     // CONVENIENCE MACROS FOR RENDER COMMANDS
     // ============================================================================
@@ -614,6 +748,26 @@ namespace Vortex
 #define VX_RENDER_DEBUG_POP() \
         ::Vortex::GetRenderCommandQueue().PopDebugGroup()
 
+    // GPU markers default to debug builds; define VX_ENABLE_GPU_MARKERS to
+    // 0/1 explicitly to force them off/on regardless of configuration
+#ifndef VX_ENABLE_GPU_MARKERS
+    #ifdef VX_DEBUG
+        #define VX_ENABLE_GPU_MARKERS 1
+    #else
+        #define VX_ENABLE_GPU_MARKERS 0
+    #endif
+#endif
+
+    // Scoped GPU debug group; expands to nothing (not even the name
+    // expression) when markers are disabled
+#if VX_ENABLE_GPU_MARKERS
+    #define VX_GPU_SCOPE_CONCAT2(a, b) a##b
+    #define VX_GPU_SCOPE_CONCAT(a, b) VX_GPU_SCOPE_CONCAT2(a, b)
+    #define VX_GPU_SCOPE(name) ::Vortex::GpuScope VX_GPU_SCOPE_CONCAT(_vxGpuScope, __LINE__){ name }
+#else
+    #define VX_GPU_SCOPE(name) ((void)0)
+#endif
+
 #define VX_RENDER_SET_DEPTH(test, write, func) \
         ::Vortex::GetRenderCommandQueue().SetDepthState(test, write, func)
 
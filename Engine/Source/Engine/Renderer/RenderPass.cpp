@@ -97,6 +97,33 @@ namespace Vortex
             return;
         }
 
+        // Discard attachments the spec marks DontCare now that all draws for
+        // this pass are queued; only meaningful with our own target, since the
+        // default/inherited framebuffer's contents are not ours to throw away
+        if (m_Spec.Target)
+        {
+            uint32_t attachments[InvalidateFramebufferCommand::kMaxAttachments];
+            uint32_t count = 0;
+            const auto& fbSpec = m_Spec.Target->GetSpec();
+            if (m_Spec.ColorStoreOp == AttachmentStoreOp::DontCare)
+            {
+                for (uint32_t i = 0; i < fbSpec.ColorAttachmentCount && count < InvalidateFramebufferCommand::kMaxAttachments; ++i)
+                {
+                    attachments[count++] = static_cast<uint32_t>(FramebufferAttachment::Color0) + i;
+                }
+            }
+            if (m_Spec.DepthStencilStoreOp == AttachmentStoreOp::DontCare && fbSpec.HasDepth &&
+                count < InvalidateFramebufferCommand::kMaxAttachments)
+            {
+                attachments[count++] = static_cast<uint32_t>(FramebufferAttachment::DepthStencil);
+            }
+            if (count > 0)
+            {
+                GetRenderCommandQueue().InvalidateFramebuffer(
+                    static_cast<uint32_t>(FramebufferTarget::Framebuffer), count, attachments);
+            }
+        }
+
         // Restore render state to defaults
         RestoreRenderState();
 
@@ -49,6 +49,14 @@ namespace Vortex
         bool CullingEnabled = false;
         bool CullBackFace = true;  // true = cull back faces, false = cull front faces
 
+        // Store ops applied at End(): DontCare invalidates the attachment so
+        // the driver can discard its contents instead of writing them back —
+        // the render-pass storeOp semantics tiled GPUs rely on. Use for
+        // intermediate targets nobody samples afterwards (e.g. depth that only
+        // exists for testing within the pass).
+        AttachmentStoreOp ColorStoreOp = AttachmentStoreOp::Store;
+        AttachmentStoreOp DepthStencilStoreOp = AttachmentStoreOp::Store;
+
         // Sorting
         RenderSortMode SortMode = RenderSortMode::None;
 
@@ -2,6 +2,20 @@
 
 namespace Vortex
 {
+    /**
+     * @brief Identity hasher for maps keyed by pre-mixed 64-bit values
+     *
+     * Renderer and shader caches key their maps by hashes (or random UUIDs)
+     * that are already uniformly distributed, so re-hashing the key adds
+     * nothing. libstdc++ and libc++ treat std::hash<uint64_t> as the
+     * identity, but MSVC runs FNV-1a over the bytes; supplying the identity
+     * explicitly makes lookups a single load on every platform.
+     */
+    struct IdentityU64Hash
+    {
+        size_t operator()(uint64_t value) const noexcept { return static_cast<size_t>(value); }
+    };
+
     // API-agnostic render enums used across the engine
 
     enum class BufferTarget : uint32_t
@@ -9,14 +23,24 @@ namespace Vortex
         ArrayBuffer = 0,
         ElementArrayBuffer = 1,
         UniformBuffer = 2,
-        ShaderStorageBuffer = 3
+        ShaderStorageBuffer = 3,
+        CopyReadBuffer = 4,
+        CopyWriteBuffer = 5,
+        DrawIndirectBuffer = 6,
+        PixelUnpackBuffer = 7,
+        ParameterBuffer = 8
     };
 
     enum class BufferUsage : uint32_t
     {
         StaticDraw = 0,
         DynamicDraw = 1,
-        StreamDraw = 2
+        StreamDraw = 2,
+
+        // Hint that the data is rewritten from scratch every frame; backends
+        // may route the upload through a persistently-mapped ring instead of
+        // the driver's internal staging (falls back to StreamDraw semantics)
+        TransientPerFrame = 3
     };
 
     enum class DataType : uint32_t
@@ -32,6 +56,22 @@ namespace Vortex
         DoubleType = 8
     };
 
+    // One attribute of a baked vertex layout. A fixed array of these fully
+    // describes a vertex format; RendererAPI::GetOrCreateVertexLayout bakes
+    // it into a backend layout object (a VAO on OpenGL) once, after which
+    // using the layout is a single bind instead of per-attribute setup calls
+    struct VertexAttrib
+    {
+        uint32_t Index = 0;             // shader attribute location
+        int32_t ComponentCount = 4;     // 1..4
+        DataType Type = DataType::Float;
+        bool Normalized = false;
+        bool Integer = false;           // integer attribute (no float conversion)
+        uint32_t RelativeOffset = 0;    // byte offset within the vertex
+        uint32_t Binding = 0;           // vertex buffer binding slot
+        uint32_t Divisor = 0;           // instance divisor for the binding (0 = per vertex)
+    };
+
     // Optional generic bitfields for persistent mapping / storage flags (values match OpenGL)
     enum class BufferStorageFlags : uint32_t
     {
@@ -71,6 +111,41 @@ namespace Vortex
 
     inline uint32_t ToFlags(MapBufferAccess f) { return static_cast<uint32_t>(f); }
 
+    // Memory barrier bits for compute/indirect pipelines (values match OpenGL)
+    enum class MemoryBarrierFlags : uint32_t
+    {
+        None                     = 0,
+        VertexAttribArrayBit     = 0x00000001,
+        UniformBit               = 0x00000004,
+        CommandBit               = 0x00000040,
+        BufferUpdateBit          = 0x00000200,
+        ShaderStorageBit         = 0x00002000
+    };
+
+    inline MemoryBarrierFlags operator|(MemoryBarrierFlags a, MemoryBarrierFlags b)
+    {
+        return static_cast<MemoryBarrierFlags>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+
+    inline uint32_t ToFlags(MemoryBarrierFlags f) { return static_cast<uint32_t>(f); }
+
+    // Fence sync wait flags and results (values match OpenGL)
+    enum class SyncWaitFlags : uint32_t
+    {
+        None             = 0,
+        FlushCommandsBit = 0x00000001
+    };
+
+    inline uint32_t ToFlags(SyncWaitFlags f) { return static_cast<uint32_t>(f); }
+
+    enum class SyncWaitStatus : uint32_t
+    {
+        AlreadySignaled    = 0x911A,
+        TimeoutExpired     = 0x911B,
+        ConditionSatisfied = 0x911C,
+        WaitFailed         = 0x911D
+    };
+
     enum class PrimitiveTopology : uint32_t
     {
         Points = 0,
@@ -115,6 +190,25 @@ namespace Vortex
         DepthStencil = 102
     };
 
+    // What happens to an attachment's contents when a render pass ends.
+    // Store keeps the data for later reads; DontCare lets the driver discard
+    // it (framebuffer invalidation), which on tiled GPUs skips the tile
+    // write-back entirely. Load-time behavior is already expressed through a
+    // pass's ClearFlags (clear vs. keep).
+    enum class AttachmentStoreOp : uint8_t
+    {
+        Store = 0,
+        DontCare
+    };
+
+    // Per-attachment clear value for ClearNamedFramebuffer; one entry per
+    // color attachment so MRT targets clear without rebinding between calls
+    struct ClearAttachmentDesc
+    {
+        uint32_t AttachmentIndex = 0;               // color attachment slot (0 -> COLOR_ATTACHMENT0)
+        float Color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    };
+
     // ============================================================================
     // RENDER PASS SYSTEM ENUMS
     // ============================================================================
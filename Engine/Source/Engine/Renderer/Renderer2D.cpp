@@ -3,6 +3,7 @@
 #include "Engine/Systems/SystemAccessors.h"
 #include "Engine/Camera/Camera.h"
 #include "Engine/Renderer/VertexArray.h"
+#include "Engine/Renderer/UniformBuffer.h"
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/Shader/Shader.h"
 #include "Engine/Renderer/Shader/ShaderManager.h"
@@ -12,9 +13,21 @@
 #include "Engine/Assets/AssetSystem.h"
 #include "Engine/Assets/TextureAsset.h"
 #include "Engine/Systems/RenderSystem.h"
+#include "Core/EngineConfig.h"
+#include "Core/Debug/Assert.h"
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <cstddef>
+#include <cstring>
+#include <bit>
+#include <thread>
+#if defined(_M_X64) || defined(__x86_64__)
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#endif
 
 namespace Vortex
 {
@@ -22,40 +35,31 @@ static Renderer2DStorage* s_Data = nullptr;
 // Define static member declared in Renderer2D.h
 std::shared_ptr<CameraSystem> Renderer2D::m_CameraSystem;
 
-// Helper to (re)bind per-instance attributes to a new base offset within the current VBO
-static void RebindInstanceAttribs(uint64_t baseOffset)
+// Helper to (re)bind per-instance attributes to a buffer + base offset
+// Per-instance attribute table, submitted as one BindVertexAttribTable command
+// instead of 18 individual Enable/Pointer/Divisor submissions. The snorm16 pair
+// expands back to [-1,1] floats in the shader, half-float Z arrives as a plain
+// float.
+static constexpr BindVertexAttribTableCommand::AttribDesc kQuadAttribLayout[6] = {
+    //  idx size type                                              norm   int    div offset
+    { 2, 2, static_cast<uint32_t>(DataType::Float),       false, false, 1, offsetof(Renderer2DStorage::QuadInstance, Center)    },
+    { 3, 2, static_cast<uint32_t>(DataType::Float),       false, false, 1, offsetof(Renderer2DStorage::QuadInstance, HalfSize)  },
+    { 4, 1, static_cast<uint32_t>(DataType::UnsignedInt), false, true,  1, offsetof(Renderer2DStorage::QuadInstance, ColorRGBA) },
+    { 5, 1, static_cast<uint32_t>(DataType::UnsignedInt), false, true,  1, offsetof(Renderer2DStorage::QuadInstance, TexIndex)  },
+    { 6, 2, static_cast<uint32_t>(DataType::Short),       true,  false, 1, offsetof(Renderer2DStorage::QuadInstance, RotSinCos) },
+    { 7, 1, static_cast<uint32_t>(DataType::HalfFloat),   false, false, 1, offsetof(Renderer2DStorage::QuadInstance, Z)         },
+};
+
+static void RebindInstanceAttribs(uint32_t bufferID, uint64_t baseOffset)
 {
     if (!s_Data) return;
     const uint64_t stride = sizeof(Renderer2DStorage::QuadInstance);
-    const uint32_t DT_Float = static_cast<uint32_t>(DataType::Float);
-    const uint32_t DT_UInt  = static_cast<uint32_t>(DataType::UnsignedInt);
 
     s_Data->QuadVA->Bind();
-    GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceVB->GetRendererID());
+    GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), bufferID);
+    s_Data->InstanceAttribsBufferID = bufferID;
 
-    GetRenderCommandQueue().EnableVertexAttribArray(2, true);
-    GetRenderCommandQueue().VertexAttribPointer(2, 2, DT_Float, false, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, Center));
-    GetRenderCommandQueue().VertexAttribDivisor(2, 1, true);
-
-    GetRenderCommandQueue().EnableVertexAttribArray(3, true);
-    GetRenderCommandQueue().VertexAttribPointer(3, 2, DT_Float, false, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, HalfSize));
-    GetRenderCommandQueue().VertexAttribDivisor(3, 1, true);
-
-    GetRenderCommandQueue().EnableVertexAttribArray(4, true);
-    GetRenderCommandQueue().VertexAttribIPointer(4, 1, DT_UInt, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, ColorRGBA));
-    GetRenderCommandQueue().VertexAttribDivisor(4, 1, true);
-
-    GetRenderCommandQueue().EnableVertexAttribArray(5, true);
-    GetRenderCommandQueue().VertexAttribIPointer(5, 1, DT_UInt, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, TexIndex));
-    GetRenderCommandQueue().VertexAttribDivisor(5, 1, true);
-
-    GetRenderCommandQueue().EnableVertexAttribArray(6, true);
-    GetRenderCommandQueue().VertexAttribPointer(6, 2, DT_Float, false, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, RotSinCos));
-    GetRenderCommandQueue().VertexAttribDivisor(6, 1, true);
-
-    GetRenderCommandQueue().EnableVertexAttribArray(7, true);
-    GetRenderCommandQueue().VertexAttribPointer(7, 1, DT_Float, false, stride, baseOffset + offsetof(Renderer2DStorage::QuadInstance, Z));
-    GetRenderCommandQueue().VertexAttribDivisor(7, 1, true);
+    GetRenderCommandQueue().BindVertexAttribTable(kQuadAttribLayout, 6, stride, baseOffset);
 }
 
 	static void EnsureShaderLoaded()
@@ -71,197 +75,688 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 		}
 	}
 
-	// Helper to pack RGBA color into uint32 (RGBA8)
-	static inline uint32_t PackColorRGBA8(const glm::vec4& color)
+	static void EnsureCullShaderLoaded()
 	{
-		uint32_t r = (uint32_t)glm::clamp((int)glm::round(color.r * 255.0f), 0, 255);
-		uint32_t g = (uint32_t)glm::clamp((int)glm::round(color.g * 255.0f), 0, 255);
-		uint32_t b = (uint32_t)glm::clamp((int)glm::round(color.b * 255.0f), 0, 255);
-		uint32_t a = (uint32_t)glm::clamp((int)glm::round(color.a * 255.0f), 0, 255);
-		return (r << 24) | (g << 16) | (b << 8) | a;
+		if (!s_Data) return;
+		if (s_Data->CullShaderHandle.IsValid()) return;
+
+		// Compute shader for GPU frustum culling; optional, the direct path covers its absence
+		auto assets = SysShared<AssetSystem>();
+		if (assets)
+		{
+			s_Data->CullShaderHandle = assets->LoadAsset<ShaderAsset>("Renderer2DCull");
+		}
+	}
+
+	// Precomputed texture sampler uniform names, materialized as std::string
+	// once at startup so SetTexture (which takes const std::string&) gets a
+	// ready-made object instead of allocating a temporary per bind
+	static const std::string kTexUniformNames[MaxTextureSlots] = {
+		"u_Textures[0]",  "u_Textures[1]",  "u_Textures[2]",  "u_Textures[3]",
+		"u_Textures[4]",  "u_Textures[5]",  "u_Textures[6]",  "u_Textures[7]",
+		"u_Textures[8]",  "u_Textures[9]",  "u_Textures[10]", "u_Textures[11]",
+		"u_Textures[12]", "u_Textures[13]", "u_Textures[14]", "u_Textures[15]",
+		"u_Textures[16]", "u_Textures[17]", "u_Textures[18]", "u_Textures[19]",
+		"u_Textures[20]", "u_Textures[21]", "u_Textures[22]", "u_Textures[23]",
+		"u_Textures[24]", "u_Textures[25]", "u_Textures[26]", "u_Textures[27]",
+		"u_Textures[28]", "u_Textures[29]", "u_Textures[30]", "u_Textures[31]"
+	};
+	static_assert(sizeof(kTexUniformNames) / sizeof(kTexUniformNames[0]) == MaxTextureSlots,
+	              "kTexUniformNames must cover every texture slot");
+
+	// Upload the per-frame constants UBO (view-projection, viewport, pixel snap)
+	static void UpdateFrameConstants()
+	{
+		if (!s_Data || !s_Data->FrameUBO) return;
+		Renderer2DStorage::FrameConstants constants{};
+		constants.ViewProj = s_Data->CurrentViewProj;
+		constants.ViewportSize = glm::vec2((float)s_Data->CurrentViewportSize.x, (float)s_Data->CurrentViewportSize.y);
+		constants.PixelSnap = s_Data->PixelSnapEnabled ? 1 : 0;
+		s_Data->FrameUBO->SetData(&constants, sizeof(constants));
 	}
 
-	// Optimized rotation helpers - avoid expensive matrix calculations
-	inline void RotateVertex2D(glm::vec3& vertex, float cosZ, float sinZ, const glm::vec2& center)
+	// Refresh the submit-time cull rows from the current view-projection.
+	// Only affine XY mappings qualify (ortho cameras, w == 1 everywhere);
+	// anything with perspective disables the CPU cull for the frame.
+	//
+	// The two rows are the 2x3 affine the 2D path actually needs — every
+	// CPU-side transform is 4 mul + 2 add against them. The full mat4 is
+	// still kept alongside: the UBO upload wants it (the shader handles Z
+	// and arbitrary cameras) and it is one 64-byte copy per frame, so a
+	// dedicated CPU-side 2x3 everywhere would save nothing further.
+	static void UpdateCullRows(Renderer2DStorage* __restrict d)
 	{
-		float x = vertex.x - center.x;
-		float y = vertex.y - center.y;
-		vertex.x = center.x + (x * cosZ - y * sinZ);
-		vertex.y = center.y + (x * sinZ + y * cosZ);
+		const glm::mat4& m = d->CurrentViewProj;
+		d->CullRowsValid = (m[0][3] == 0.0f && m[1][3] == 0.0f && m[3][3] == 1.0f);
+		if (!d->CullRowsValid) return;
+		d->CullRowX = glm::vec3(m[0][0], m[1][0], m[3][0]);
+		d->CullRowY = glm::vec3(m[0][1], m[1][1], m[3][1]);
+		d->CullReachX = std::abs(m[0][0]) + std::abs(m[1][0]);
+		d->CullReachY = std::abs(m[0][1]) + std::abs(m[1][1]);
 	}
 
-	// For 3D rotations, we'll handle Z-axis rotation first (most common), then apply X/Y if needed
-	inline void RotateVertex3D(glm::vec3& vertex, const glm::vec3& rotation, const glm::vec3& center)
+	// Stream a block of instance data into write-combined (mapped) memory.
+	// Uses non-temporal stores so the copy does not pollute the cache and hits
+	// the WC write bandwidth in full cache lines: the main loop emits 64 bytes
+	// per iteration so each WC buffer fills and drains in one burst. The
+	// staging array is 32-byte aligned (QuadInstance is alignas(32)), so the
+	// loads are aligned; falls back to memcpy off x64.
+	static void StreamCopyToMapped(void* dst, const void* src, size_t sizeBytes)
 	{
-		// Convert to radians once
-		float rx = glm::radians(rotation.x);
-		float ry = glm::radians(rotation.y);
-		float rz = glm::radians(rotation.z);
+#if defined(_M_X64) || defined(__x86_64__)
+		if ((reinterpret_cast<uintptr_t>(dst) & 15u) == 0 &&
+		    (reinterpret_cast<uintptr_t>(src) & 15u) == 0 && (sizeBytes & 15u) == 0)
+		{
+			auto* d = reinterpret_cast<__m128i*>(dst);
+			const auto* s = reinterpret_cast<const __m128i*>(src);
+			const size_t blocks = sizeBytes / 16;
+			size_t i = 0;
+			for (; i + 4 <= blocks; i += 4)
+			{
+				_mm_stream_si128(d + i + 0, _mm_load_si128(s + i + 0));
+				_mm_stream_si128(d + i + 1, _mm_load_si128(s + i + 1));
+				_mm_stream_si128(d + i + 2, _mm_load_si128(s + i + 2));
+				_mm_stream_si128(d + i + 3, _mm_load_si128(s + i + 3));
+			}
+			for (; i < blocks; ++i)
+			{
+				_mm_stream_si128(d + i, _mm_load_si128(s + i));
+			}
+			_mm_sfence();
+			return;
+		}
+#endif
+		std::memcpy(dst, src, sizeBytes);
+	}
+
+	// Find or allocate the batch texture slot for a texture. Probes the small
+	// open-addressed hash keyed on the GL renderer ID (Fibonacci hash, linear
+	// probing), so the hot path compares uint32 keys instead of chasing
+	// shared_ptr control blocks through TextureSlots. Flushes and starts a new
+	// batch when every slot is taken. (An 8-wide SIMD sweep of a flat ID array
+	// was considered instead; the hash usually resolves in a single uint32
+	// probe without touching all 32 slots, so it stays.)
+	static uint32_t AcquireTextureSlot(Renderer2DStorage* __restrict d, const Texture2DRef& texture)
+	{
+		constexpr uint32_t capacity = Renderer2DStorage::TextureHashCapacity;
+		constexpr uint32_t mask = capacity - 1;
+		static_assert((capacity & mask) == 0, "hash capacity must be a power of two");
+
+		const uint32_t texID = texture->GetRendererID();
+		for (;;)
+		{
+			uint32_t idx = (texID * 0x9E3779B1u) >> 26; // top bits index 64 buckets
+			for (;;)
+			{
+				const uint32_t key = d->TextureHashKeys[idx];
+				if (key == texID)
+					return d->TextureHashSlots[idx];
+				if (key == 0u)
+					break; // empty bucket: not in this batch yet
+				idx = (idx + 1) & mask;
+			}
+
+			if (d->TextureSlotIndex >= MaxTextureSlots)
+			{
+				// Batch is out of slots; flush and retry against the fresh table
+				Renderer2D::Flush();
+				Renderer2D::StartNewBatch();
+				continue;
+			}
 
-		// Pre-calculate trig functions
-		float cosX = std::cos(rx);
-		float sinX = std::sin(rx);
-		float cosY = std::cos(ry);
-		float sinY = std::sin(ry);
-		float cosZ = std::cos(rz);
-		float sinZ = std::sin(rz);
+			const uint32_t slot = d->TextureSlotIndex++;
+			d->TextureSlots[slot] = texture;
+			d->TextureSlotIDs[slot] = texID;
+			d->TextureHashKeys[idx] = texID;
+			d->TextureHashSlots[idx] = static_cast<uint8_t>(slot);
+			return slot;
+		}
+	}
 
-		// Translate to origin
-		float x = vertex.x - center.x;
-		float y = vertex.y - center.y;
-		float z = vertex.z - center.z;
+	// Single capacity "runway" check shared by every DrawQuad entry point. The
+	// flush path is annotated unlikely so codegen keeps the common case as a
+	// fall-through compare and the emit sequence stays hot in the uop cache.
+	static inline void EnsureCapacity(Renderer2DStorage* __restrict d, size_t needed = 1)
+	{
+		if (d->InstanceBufferPtr + needed > d->WriteEnd) [[unlikely]]
+		{
+			Renderer2D::Flush();
+			Renderer2D::StartNewBatch();
+		}
+	}
 
-		// Apply rotations in order: Y, X, Z (matching glm::yawPitchRoll)
-		// Y-axis rotation (yaw)
-		float tempX = x * cosY + z * sinY;
-		float tempZ = -x * sinY + z * cosY;
-		x = tempX;
-		z = tempZ;
+#if (defined(_M_X64) || defined(__x86_64__)) && !defined(__AVX__)
+	// Runtime-dispatched instance store for builds that don't already target
+	// AVX: Initialize probes the CPU once and flips the pointer to the 32-byte
+	// AVX variant when the hardware (and OS-saved YMM state) allow it. The
+	// indirect call sits behind a never-changing pointer, so the branch
+	// predictor resolves it for free in the hot loop.
+	static void StoreInstanceSSE2(float* dst, __m128 lo, __m128 hi)
+	{
+		_mm_storeu_ps(dst, lo);
+		_mm_storeu_ps(dst + 4, hi);
+	}
 
-		// X-axis rotation (pitch)
-		float tempY = y * cosX - z * sinX;
-		tempZ = y * sinX + z * cosX;
-		y = tempY;
-		z = tempZ;
+	#if defined(__GNUC__) || defined(__clang__)
+	__attribute__((target("avx2")))
+	#endif
+	static void StoreInstanceAVX2(float* dst, __m128 lo, __m128 hi)
+	{
+		_mm256_storeu_ps(dst, _mm256_set_m128(hi, lo));
+	}
 
-		// Z-axis rotation (roll)
-		tempX = x * cosZ - y * sinZ;
-		tempY = x * sinZ + y * cosZ;
-		x = tempX;
-		y = tempY;
+	static void (*s_StoreInstanceFn)(float*, __m128, __m128) = &StoreInstanceSSE2;
 
-		// Translate back
-		vertex.x = center.x + x;
-		vertex.y = center.y + y;
-		vertex.z = center.z + z;
+	static bool DetectAVX2()
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_cpu_supports("avx2");
+	#elif defined(_MSC_VER)
+		int info[4] = {};
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx) return false;
+		__cpuidex(info, 7, 0);
+		const bool avx2 = (info[1] & (1 << 5)) != 0;
+		// OS must save/restore XMM+YMM state for AVX to be usable
+		return avx2 && (_xgetbv(0) & 0x6) == 0x6;
+	#else
+		return false;
+	#endif
+	}
+#endif
+
+	// Emit one quad instance into the staging array with wide stores: the whole
+	// 32-byte instance goes out as a single AVX store (two SSE2 stores
+	// otherwise) instead of six field-at-a-time writes per quad. Also bumps the
+	// instance count/write pointer so call sites stay one-liners.
+	// packSnorm2x16({1, 0}) folded by hand: identity rotation, cos in the low
+	// half. Lets the unrotated overloads skip the pack call entirely.
+	constexpr uint32_t kIdentityRotPacked = 0x00007FFFu;
+
+	static inline void EmitInstancePacked(Renderer2DStorage* __restrict d,
+	                                      const glm::vec2& center, const glm::vec2& halfSize,
+	                                      uint32_t colorRGBA, uint32_t texIndex,
+	                                      uint32_t rotPacked, uint32_t zPacked)
+	{
+		Renderer2DStorage::QuadInstance* __restrict dst = d->InstanceBufferPtr++;
+#if defined(_M_X64) || defined(__x86_64__)
+		// Pull the line two cache lines ahead of the cursor into L1 so the
+		// first-touch store of a cold staging line overlaps this quad's prep
+		// instead of stalling on the write allocate
+		_mm_prefetch(reinterpret_cast<const char*>(dst + 4), _MM_HINT_T0);
+	#if defined(__AVX__)
+		__m256 v = _mm256_setr_ps(center.x, center.y, halfSize.x, halfSize.y,
+		                          std::bit_cast<float>(colorRGBA), std::bit_cast<float>(texIndex),
+		                          std::bit_cast<float>(rotPacked), std::bit_cast<float>(zPacked));
+		_mm256_storeu_ps(reinterpret_cast<float*>(dst), v);
+	#else
+		s_StoreInstanceFn(reinterpret_cast<float*>(dst),
+		                  _mm_setr_ps(center.x, center.y, halfSize.x, halfSize.y),
+		                  _mm_setr_ps(std::bit_cast<float>(colorRGBA), std::bit_cast<float>(texIndex),
+		                              std::bit_cast<float>(rotPacked), std::bit_cast<float>(zPacked)));
+	#endif
+#else
+		dst->Center = center;
+		dst->HalfSize = halfSize;
+		dst->ColorRGBA = colorRGBA;
+		dst->TexIndex = texIndex;
+		dst->RotSinCos = rotPacked;
+		dst->Z = static_cast<uint16_t>(zPacked);
+		dst->_Pad0 = 0;
+#endif
+		++d->InstanceCount;
 	}
 
-	// Cached version of RotateVertex3D for better performance
-	inline CachedRotation* GetCachedRotation(const glm::vec3& rotation)
+	static inline void EmitInstance(Renderer2DStorage* __restrict d,
+	                                const glm::vec2& center, const glm::vec2& halfSize,
+	                                uint32_t colorRGBA, uint32_t texIndex,
+	                                const glm::vec2& rotSinCos, float z)
 	{
-		if (!s_Data) return nullptr;
+		// Pad half of the packed Z stays zero
+		EmitInstancePacked(d, center, halfSize, colorRGBA, texIndex,
+		                   glm::packSnorm2x16(rotSinCos), glm::packHalf1x16(z));
+	}
 
-		// Check if rotation is zero (very common case)
-		if (rotation.x == 0.0f && rotation.y == 0.0f && rotation.z == 0.0f)
-			return nullptr;  // No rotation needed
+	// Half-float bits reordered so unsigned compare matches float compare
+	// (sign flip for positives, full complement for negatives)
+	static inline uint16_t SortableHalf(uint16_t bits)
+	{
+		return (bits & 0x8000u) ? static_cast<uint16_t>(~bits) : static_cast<uint16_t>(bits | 0x8000u);
+	}
 
-		// Look for existing cached rotation
-		for (auto& cached : s_Data->RotationCache)
+	// Append one quad to the deferred draw list. Textures dedupe against the
+	// per-frame table (last-used fast path, then a linear scan — distinct
+	// textures per frame are few compared to quads).
+	static void DeferQuad(Renderer2DStorage* __restrict d,
+	                      const glm::vec2& center, const glm::vec2& halfSize,
+	                      uint32_t colorRGBA, const Texture2DRef& texture,
+	                      uint32_t rotPacked, uint16_t zHalf)
+	{
+		uint16_t texIdx = 0;
+		if (texture)
 		{
-			if (cached.frameLastUsed > 0 && 
-				std::abs(cached.angles.x - rotation.x) < 0.001f &&
-				std::abs(cached.angles.y - rotation.y) < 0.001f &&
-				std::abs(cached.angles.z - rotation.z) < 0.001f)
+			const uint32_t texID = texture->GetRendererID();
+			if (texID == d->LastDeferredTexID)
+			{
+				texIdx = d->LastDeferredTexIdx;
+			}
+			else
 			{
-				cached.frameLastUsed = s_Data->CurrentFrame;
-				return &cached;
+				const size_t numTextures = d->DeferredTextureIDs.size();
+				size_t found = 1;
+				for (; found < numTextures; ++found)
+				{
+					if (d->DeferredTextureIDs[found] == texID)
+						break;
+				}
+				if (found == numTextures)
+				{
+					d->DeferredTextures.push_back(texture);
+					d->DeferredTextureIDs.push_back(texID);
+				}
+				texIdx = static_cast<uint16_t>(found);
+				d->LastDeferredTexID = texID;
+				d->LastDeferredTexIdx = texIdx;
 			}
 		}
 
-		// Find LRU slot to replace
-		CachedRotation* lruSlot = &s_Data->RotationCache[0];
-		for (auto& cached : s_Data->RotationCache)
+		Renderer2DStorage::QuadCmd& cmd = d->DeferredCmds.emplace_back();
+		cmd.Center = center;
+		cmd.HalfSize = halfSize;
+		cmd.ColorRGBA = colorRGBA;
+		cmd.RotSinCos = rotPacked;
+		cmd.ZHalf = zHalf;
+		cmd.TexIdx = texIdx;
+		cmd.SortKey = (static_cast<uint32_t>(SortableHalf(cmd.ZHalf)) << 16) | texIdx;
+	}
+
+	// Retire a frame-chunk fence. By the time the ring cycles back to a chunk
+	// the GPU has usually long finished with it, so probe with a zero timeout
+	// first (flushing queued commands on the initial probe) and only fall back
+	// to the blocking infinite wait when the fence is genuinely still pending —
+	// the signaled fast path skips the blocking driver round-trip entirely.
+	static void WaitFrameFence(uint64_t& fence)
+	{
+		if (fence == 0ull) return;
+
+		const auto signaled = [](uint32_t status)
+		{
+			return status == static_cast<uint32_t>(SyncWaitStatus::AlreadySignaled) ||
+			       status == static_cast<uint32_t>(SyncWaitStatus::ConditionSatisfied);
+		};
+
+		uint32_t status = 0;
+		GetRenderCommandQueue().ClientWaitSync(fence, ToFlags(SyncWaitFlags::FlushCommandsBit), 0ull, &status);
+		if (!signaled(status))
 		{
-			if (cached.frameLastUsed == 0 || cached.frameLastUsed < lruSlot->frameLastUsed)
-				lruSlot = &cached;
+			// Near-miss window: the fence often signals within a few hundred
+			// nanoseconds, so spin briefly before paying for a blocking wait
+			for (int spin = 0; spin < 3 && !signaled(status); ++spin)
+			{
+#if defined(_M_X64) || defined(__x86_64__)
+				_mm_pause();
+#endif
+				GetRenderCommandQueue().ClientWaitSync(fence, 0ull, 0ull, &status);
+			}
+			if (!signaled(status))
+			{
+				// GL_TIMEOUT_IGNORED == 0xFFFFFFFFFFFFFFFFull; use ~0ull
+				GetRenderCommandQueue().ClientWaitSync(fence, 0ull, ~0ull, &status);
+			}
 		}
+		GetRenderCommandQueue().DeleteSync(fence);
+		fence = 0ull;
+	}
 
-		// Cache new rotation
-		lruSlot->angles = rotation;
-		lruSlot->frameLastUsed = s_Data->CurrentFrame;
+#ifdef VX_ENABLE_ASSERTS
+	// Thread that called BeginScene; submission is single-threaded by design.
+	// If quad generation ever moves onto workers, the plan is per-thread
+	// staging arenas sliced out of the frame chunk and drawn via baseInstance,
+	// not a lock around this cursor — until then, catch misuse loudly.
+	static std::thread::id s_SubmitThreadId;
+#endif
+
+	// Funnel shared by the DrawQuad overloads: immediate mode acquires a slot
+	// and emits directly; deferred mode appends to the frame draw list instead
+	// Conservative submit-time cull: project the center with the affine XY
+	// rows and compare against NDC expanded by the quad's reach. halfX+halfY
+	// bounds the support of the quad under any Z rotation, so rotated quads
+	// never cull incorrectly (they just cull slightly late).
+	static inline bool CullQuad(const Renderer2DStorage* __restrict d,
+	                            const glm::vec2& center, const glm::vec2& halfSize)
+	{
+		const float reach = halfSize.x + halfSize.y;
+		const float ndcX = d->CullRowX.x * center.x + d->CullRowX.y * center.y + d->CullRowX.z;
+		const float ndcY = d->CullRowY.x * center.x + d->CullRowY.y * center.y + d->CullRowY.z;
+		return std::abs(ndcX) > 1.0f + d->CullReachX * reach ||
+		       std::abs(ndcY) > 1.0f + d->CullReachY * reach;
+	}
 
-		// Pre-calculate trig functions
-		float rx = glm::radians(rotation.x);
-		float ry = glm::radians(rotation.y);
-		float rz = glm::radians(rotation.z);
+	static inline void SubmitInstance(Renderer2DStorage* __restrict d,
+	                                  const glm::vec2& center, const glm::vec2& halfSize,
+	                                  uint32_t colorRGBA, const Texture2DRef& texture,
+	                                  uint32_t rotPacked, uint16_t zHalf)
+	{
+		VX_CORE_ASSERT(std::this_thread::get_id() == s_SubmitThreadId,
+		               "Renderer2D submission must stay on the BeginScene thread");
+		if (d->CPUCullingEnabled && d->CullRowsValid && CullQuad(d, center, halfSize))
+			return;
+		if (d->DeferredMode) [[unlikely]]
+		{
+			DeferQuad(d, center, halfSize, colorRGBA, texture, rotPacked, zHalf);
+			return;
+		}
+		EnsureCapacity(d);
+		const uint32_t texIndex = texture ? AcquireTextureSlot(d, texture) : 0u;
+		EmitInstancePacked(d, center, halfSize, colorRGBA, texIndex, rotPacked, zHalf);
+	}
 
-		lruSlot->cosX = std::cos(rx);
-		lruSlot->sinX = std::sin(rx);
-		lruSlot->cosY = std::cos(ry);
-		lruSlot->sinY = std::sin(ry);
-		lruSlot->cosZ = std::cos(rz);
-		lruSlot->sinZ = std::sin(rz);
+	static inline void SinCos1(float angle, float* outSin, float* outCos);
 
-		return lruSlot;
+	// One templated funnel behind the twelve DrawQuad overloads. Rotation and Z
+	// handling are template parameters so each overload compiles to a
+	// straight-line call with the unused paths folded away, instead of twelve
+	// hand-copied bodies that can drift apart.
+	template<bool HasRot, bool Is3D, typename PosT>
+	static inline void SubmitQuad(const PosT& position, const glm::vec2& size,
+	                              float rotationZDegrees, const Texture2DRef& texture,
+	                              const glm::vec4& color)
+	{
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d) [[unlikely]] return;
+		// Pack rotation and depth here, under if constexpr, so the common
+		// unrotated 2D overloads compile down to a capacity check plus one
+		// instance store — no trig, no pack calls, no dead Z plumbing
+		uint32_t rotPacked = kIdentityRotPacked;
+		if constexpr (HasRot)
+		{
+			float s, c;
+			SinCos1(glm::radians(rotationZDegrees), &s, &c);
+			rotPacked = glm::packSnorm2x16(glm::vec2(c, s));
+		}
+		glm::vec2 center;
+		uint16_t zHalf = 0; // packHalf1x16(0.0f)
+		if constexpr (Is3D)
+		{
+			center = { position.x, position.y };
+			zHalf = static_cast<uint16_t>(glm::packHalf1x16(position.z));
+		}
+		else
+		{
+			center = position;
+		}
+		SubmitInstance(d, center, size * 0.5f, PackColorRGBA8(color), texture, rotPacked, zHalf);
 	}
 
-	// Fast cached rotation using pre-computed sin/cos values
-	inline void RotateVertexCached(glm::vec3& vertex, const CachedRotation* cached, const glm::vec3& center)
+	// Shared TextureAsset resolution for the asset-handle overloads; returns
+	// null (white texture / untextured path) while the asset isn't ready yet
+	static inline Texture2DRef ResolveTextureAsset(const AssetHandle<TextureAsset>& handle)
 	{
-		if (!cached) return;
+		if (!handle.IsValid() || !handle.IsLoaded()) return nullptr;
+		const TextureAsset* texAsset = handle.TryGet();
+		if (!texAsset || !texAsset->IsReady() || !texAsset->GetTexture()) return nullptr;
+		return texAsset->GetTexture();
+	}
 
-		// Translate to origin
-		float x = vertex.x - center.x;
-		float y = vertex.y - center.y;
-		float z = vertex.z - center.z;
+	// Drain the deferred draw list: LSD radix sort (four 8-bit passes, stable)
+	// over the packed (Z, texture) key, then emit in sorted order so each
+	// texture's quads land in as few batches as possible
+	static void FlushDeferred(Renderer2DStorage* __restrict d)
+	{
+		const size_t count = d->DeferredCmds.size();
+		if (count != 0)
+		{
+			// key<<32 | index; sorting the high bytes carries the index along
+			std::vector<uint64_t>& keys = d->DeferredSortScratch;
+			keys.resize(count * 2);
+			uint64_t* src = keys.data();
+			uint64_t* tmp = keys.data() + count;
+			for (size_t i = 0; i < count; ++i)
+				src[i] = (static_cast<uint64_t>(d->DeferredCmds[i].SortKey) << 32) | i;
+
+			uint32_t histogram[256];
+			for (uint32_t pass = 0; pass < 4; ++pass)
+			{
+				const uint32_t shift = 32 + pass * 8;
+				std::memset(histogram, 0, sizeof(histogram));
+				for (size_t i = 0; i < count; ++i)
+					++histogram[(src[i] >> shift) & 0xFFu];
+				// Degenerate pass: every key shares this byte (common for the
+				// high Z bytes when a scene draws few distinct layers, and for
+				// the texture byte with few textures) — the scatter would be
+				// an exact copy, so skip it
+				if (histogram[(src[0] >> shift) & 0xFFu] == count)
+					continue;
+				uint32_t running = 0;
+				for (uint32_t b = 0; b < 256; ++b)
+				{
+					const uint32_t n = histogram[b];
+					histogram[b] = running;
+					running += n;
+				}
+				for (size_t i = 0; i < count; ++i)
+					tmp[histogram[(src[i] >> shift) & 0xFFu]++] = src[i];
+				std::swap(src, tmp);
+			}
 
-		// Apply rotations in order: Y, X, Z (matching glm::yawPitchRoll)
-		// Y-axis rotation (yaw)
-		float tempX = x * cached->cosY + z * cached->sinY;
-		float tempZ = -x * cached->sinY + z * cached->cosY;
-		x = tempX;
-		z = tempZ;
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Renderer2DStorage::QuadCmd& cmd = d->DeferredCmds[src[i] & 0xFFFFFFFFull];
+				EnsureCapacity(d);
+				const uint32_t texIndex = cmd.TexIdx != 0
+					? AcquireTextureSlot(d, d->DeferredTextures[cmd.TexIdx])
+					: 0u;
+				EmitInstancePacked(d, cmd.Center, cmd.HalfSize, cmd.ColorRGBA, texIndex,
+				                   cmd.RotSinCos, cmd.ZHalf);
+			}
+		}
 
-		// X-axis rotation (pitch)
-		float tempY = y * cached->cosX - z * cached->sinX;
-		tempZ = y * cached->sinX + z * cached->cosX;
-		y = tempY;
-		z = tempZ;
+		d->DeferredCmds.clear();
+		d->DeferredTextures.resize(1);
+		d->DeferredTextureIDs.resize(1);
+		d->LastDeferredTexID = 0;
+		d->LastDeferredTexIdx = 0;
+		d->DeferredMode = false;
+	}
 
-		// Z-axis rotation (roll)
-		tempX = x * cached->cosZ - y * cached->sinZ;
-		tempY = x * cached->sinZ + y * cached->cosZ;
-		x = tempX;
-		y = tempY;
+#if defined(_M_X64) || defined(__x86_64__)
+	// Four sin/cos pairs at once (sse_mathfun style): Cody-Waite range reduction
+	// to [-pi/4, pi/4] around the nearest multiple of pi/2, minimax polynomials
+	// for both halves, quadrant bits select and sign the results. SSE2 only.
+	static inline void SinCos4(__m128 x, __m128* outSin, __m128* outCos)
+	{
+		const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+		__m128 signBitSin = _mm_and_ps(x, signMask);
+		x = _mm_andnot_ps(signMask, x); // |x|
+
+		// j = nearest even multiple of pi/2 below/above
+		__m128 y = _mm_mul_ps(x, _mm_set1_ps(0.63661977236758134308f)); // 2/pi
+		__m128i j = _mm_cvttps_epi32(y);
+		j = _mm_add_epi32(j, _mm_set1_epi32(1));
+		j = _mm_and_si128(j, _mm_set1_epi32(~1));
+		y = _mm_cvtepi32_ps(j);
+
+		// Quadrant-derived masks: sign flip for sin, polynomial selection, sign for cos
+		__m128 swapSignSin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+		__m128 polyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+		__m128i jc = _mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4));
+		__m128 signBitCos = _mm_castsi128_ps(_mm_slli_epi32(jc, 29));
+		signBitSin = _mm_xor_ps(signBitSin, swapSignSin);
+
+		// Extended-precision reduction: x -= y * pi/2 in three steps
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-0.78515625f)));
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-2.4187564849853515625e-4f)));
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-3.77489497744594108e-8f)));
+
+		__m128 z = _mm_mul_ps(x, x);
+
+		// cos polynomial over [-pi/4, pi/4]
+		__m128 yc = _mm_set1_ps(2.443315711809948e-5f);
+		yc = _mm_add_ps(_mm_mul_ps(yc, z), _mm_set1_ps(-1.388731625493765e-3f));
+		yc = _mm_add_ps(_mm_mul_ps(yc, z), _mm_set1_ps(4.166664568298827e-2f));
+		yc = _mm_mul_ps(_mm_mul_ps(yc, z), z);
+		yc = _mm_sub_ps(yc, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+		yc = _mm_add_ps(yc, _mm_set1_ps(1.0f));
+
+		// sin polynomial over [-pi/4, pi/4]
+		__m128 ys = _mm_set1_ps(-1.9515295891e-4f);
+		ys = _mm_add_ps(_mm_mul_ps(ys, z), _mm_set1_ps(8.3321608736e-3f));
+		ys = _mm_add_ps(_mm_mul_ps(ys, z), _mm_set1_ps(-1.6666654611e-1f));
+		ys = _mm_mul_ps(_mm_mul_ps(ys, z), x);
+		ys = _mm_add_ps(ys, x);
+
+		__m128 sinSel = _mm_or_ps(_mm_and_ps(polyMask, ys), _mm_andnot_ps(polyMask, yc));
+		__m128 cosSel = _mm_or_ps(_mm_and_ps(polyMask, yc), _mm_andnot_ps(polyMask, ys));
+		*outSin = _mm_xor_ps(sinSel, signBitSin);
+		*outCos = _mm_xor_ps(cosSel, signBitCos);
+	}
+#endif
+
+	// Single sin/cos pair via the same polynomial as SinCos4, broadcast across
+	// one register: immediate-mode rotated quads skip the two libm calls and
+	// round identically to the batch path. Falls back to libm off x64.
+	// (A quantized sin/cos LUT was considered instead: at 512 entries it snaps
+	// smoothly-rotating sprites to ~0.7 degree steps and trades the polynomial's
+	// ~10 register-only cycles for a potential cache miss, so the polynomial
+	// stays.)
+	static inline void SinCos1(float angle, float* outSin, float* outCos)
+	{
+#if defined(_M_X64) || defined(__x86_64__)
+		__m128 s, c;
+		SinCos4(_mm_set1_ps(angle), &s, &c);
+		*outSin = _mm_cvtss_f32(s);
+		*outCos = _mm_cvtss_f32(c);
+#else
+		*outSin = std::sin(angle);
+		*outCos = std::cos(angle);
+#endif
+	}
 
-		// Translate back
-		vertex.x = center.x + x;
-		vertex.y = center.y + y;
-		vertex.z = center.z + z;
+	// Helper to pack RGBA color into uint32 (RGBA8)
+	static inline uint32_t PackColorRGBA8(const glm::vec4& color)
+	{
+#if defined(_M_X64) || defined(__x86_64__)
+		// Scale, round (per MXCSR) and saturate to bytes in one SSE2 sequence —
+		// five instructions, no branches, no libm. cvtps_epi32 rounds to
+		// nearest, packs_epi32 signed-saturates (HDR values pin at 32767, well
+		// above 255) and packus_epi16 supplies the final 0..255 clamp. Lanes
+		// are reversed up front so the packed bytes come out
+		// (r<<24)|(g<<16)|(b<<8)|a without a post-pack byte swap.
+		__m128 c = _mm_loadu_ps(&color.r);
+		__m128 s = _mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set1_ps(255.0f));
+		__m128i i = _mm_cvtps_epi32(s);
+		__m128i p16 = _mm_packs_epi32(i, i);
+		__m128i p8 = _mm_packus_epi16(p16, p16);
+		return static_cast<uint32_t>(_mm_cvtsi128_si32(p8));
+#else
+		// Scalar fallback: lrint keeps round-to-nearest without going through
+		// double-precision libm round
+		uint32_t r = (uint32_t)glm::clamp((int)std::lrint(color.r * 255.0f), 0, 255);
+		uint32_t g = (uint32_t)glm::clamp((int)std::lrint(color.g * 255.0f), 0, 255);
+		uint32_t b = (uint32_t)glm::clamp((int)std::lrint(color.b * 255.0f), 0, 255);
+		uint32_t a = (uint32_t)glm::clamp((int)std::lrint(color.a * 255.0f), 0, 255);
+		return (r << 24) | (g << 16) | (b << 8) | a;
+#endif
 	}
 
+#if defined(_M_X64) || defined(__x86_64__)
+	// Four colors per call for the batch paths: the two pack stages are shared
+	// across all four inputs, so this is ~9 instructions for 4 packs instead
+	// of 4x5 through the scalar helper
+	static inline __m128i PackColorRGBA8x4(const glm::vec4& c0, const glm::vec4& c1,
+	                                       const glm::vec4& c2, const glm::vec4& c3)
+	{
+		const __m128 scale = _mm_set1_ps(255.0f);
+		auto lanes = [&scale](const glm::vec4& c)
+		{
+			__m128 v = _mm_loadu_ps(&c.r);
+			return _mm_cvtps_epi32(_mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)), scale));
+		};
+		__m128i lo = _mm_packs_epi32(lanes(c0), lanes(c1));
+		__m128i hi = _mm_packs_epi32(lanes(c2), lanes(c3));
+		return _mm_packus_epi16(lo, hi); // lane k = packed RGBA8 of color k
+	}
+#endif
+
 	// Static data for Renderer2D can be defined here if needed
 	void Renderer2D::Initialize()
 	{
 		if (s_Data) return;
+#if (defined(_M_X64) || defined(__x86_64__)) && !defined(__AVX__)
+		// One-time CPU probe; the emit hot path dispatches through this pointer
+		if (DetectAVX2())
+			s_StoreInstanceFn = &StoreInstanceAVX2;
+#endif
 		s_Data = new Renderer2DStorage();
 		s_Data->QuadVA = VertexArray::Create();
 
+		// Batch capacity is config-tunable; clamp so a bad value can't blow up
+		// the persistent ring allocation (3x this per frame in flight)
+		s_Data->QuadCapacity = static_cast<uint32_t>(
+			glm::clamp(EngineConfig::Get().GetMax2DBatchQuads(), 1024, 1 << 20));
+
 		// Per-instance buffer (persistent-mapped ring): center, halfSize, color RGBA8, texIndex, rotSinCos, z
 		s_Data->FramesInFlight = 3;
-		s_Data->FrameChunkSizeBytes = sizeof(Renderer2DStorage::QuadInstance) * MaxQuads;
+		s_Data->FrameChunkSizeBytes = sizeof(Renderer2DStorage::QuadInstance) * s_Data->QuadCapacity;
 		s_Data->InstanceRingSizeBytes = s_Data->FrameChunkSizeBytes * s_Data->FramesInFlight;
 		s_Data->FrameFences.assign(s_Data->FramesInFlight, 0ull);
 
-		// Create buffer object
-		s_Data->InstanceVB = VertexBuffer::Create(static_cast<uint32_t>(s_Data->InstanceRingSizeBytes), nullptr, BufferUsage::StreamDraw);
+		// Device-local buffer the VAO reads from (one frame chunk; GPU command ordering protects reuse)
+		s_Data->InstanceVB = VertexBuffer::Create(static_cast<uint32_t>(s_Data->FrameChunkSizeBytes), nullptr, BufferUsage::StreamDraw);
 		{
 			BufferLayout ilayout{
 				{ ShaderDataType::Vec2, "iCenter" },
 				{ ShaderDataType::Vec2, "iHalfSize" },
 				{ ShaderDataType::UInt, "iColor" },
 				{ ShaderDataType::UInt, "iTexIndex" },
-				{ ShaderDataType::Vec2, "iRotSinCos" },
-				{ ShaderDataType::Float, "iZ" }
+				// Packed fields: listed as raw UInt words for the right stride;
+				// RebindInstanceAttribs sets the real snorm16/half types
+				{ ShaderDataType::UInt, "iRotSinCos" },
+				{ ShaderDataType::UInt, "iZPad" }
 			};
 			ilayout.SetDivisor(1); // per-instance
 			s_Data->InstanceVB->SetLayout(ilayout);
 			s_Data->QuadVA->AddVertexBuffer(s_Data->InstanceVB);
 		}
-
-		// Allocate persistent storage and map once
 		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceVB->GetRendererID());
-		uint32_t storageFlags = ToFlags(BufferStorageFlags::MapWriteBit | BufferStorageFlags::MapPersistentBit | BufferStorageFlags::MapCoherentBit | BufferStorageFlags::DynamicStorageBit);
+		GetRenderCommandQueue().BufferStorage(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->FrameChunkSizeBytes, ToFlags(BufferStorageFlags::DynamicStorageBit));
+
+		// Persistent-mapped upload ring; Flush streams into it and copies to the device buffer
+		s_Data->InstanceUploadVB = VertexBuffer::Create(static_cast<uint32_t>(s_Data->InstanceRingSizeBytes), nullptr, BufferUsage::StreamDraw);
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceUploadVB->GetRendererID());
+		uint32_t storageFlags = ToFlags(BufferStorageFlags::MapWriteBit | BufferStorageFlags::MapPersistentBit | BufferStorageFlags::DynamicStorageBit);
 		GetRenderCommandQueue().BufferStorage(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceRingSizeBytes, storageFlags);
 		void* mappedPtr = nullptr;
-		uint32_t mapAccess = ToFlags(MapBufferAccess::MapWriteBit | MapBufferAccess::MapPersistentBit | MapBufferAccess::MapCoherentBit);
+		uint32_t mapAccess = ToFlags(MapBufferAccess::MapWriteBit | MapBufferAccess::MapPersistentBit | MapBufferAccess::MapFlushExplicitBit);
 		GetRenderCommandQueue().MapBufferRange(static_cast<uint32_t>(BufferTarget::ArrayBuffer), 0, s_Data->InstanceRingSizeBytes, mapAccess, &mappedPtr);
 		s_Data->InstanceMappedBase = reinterpret_cast<uint8_t*>(mappedPtr);
 
-		s_Data->InstanceBuffer = nullptr; // we write directly into mapped GPU memory
-		s_Data->InstanceBufferPtr = nullptr;
+		// Regular cached CPU staging; DrawQuad writes land here, not in WC memory
+		s_Data->InstanceStaging = new Renderer2DStorage::QuadInstance[s_Data->QuadCapacity];
+		s_Data->InstanceBuffer = s_Data->InstanceStaging;
+		s_Data->InstanceBufferPtr = s_Data->InstanceStaging;
+		s_Data->WriteEnd = s_Data->InstanceStaging + s_Data->QuadCapacity;
 		s_Data->InstanceCount = 0;
 
+		// Configure per-instance attribute pointers once; the device buffer base never moves
+		RebindInstanceAttribs(s_Data->InstanceVB->GetRendererID(), 0);
+
+		// GPU culling resources: compacted survivor buffer + indirect draw command.
+		// Cheap to keep around; only exercised when culling is enabled and the compute asset resolves.
+		s_Data->CulledInstanceVB = VertexBuffer::Create(static_cast<uint32_t>(s_Data->FrameChunkSizeBytes), nullptr, BufferUsage::StreamDraw);
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->CulledInstanceVB->GetRendererID());
+		GetRenderCommandQueue().BufferStorage(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->FrameChunkSizeBytes, ToFlags(BufferStorageFlags::None));
+		GetRenderCommandQueue().GenBuffers(1, &s_Data->IndirectBufferID);
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::DrawIndirectBuffer), s_Data->IndirectBufferID);
+		// DrawArraysIndirect command: { count, instanceCount, first, baseInstance }
+		const uint32_t indirectInit[4] = { 4u, 0u, 0u, 0u };
+		GetRenderCommandQueue().BufferData(static_cast<uint32_t>(BufferTarget::DrawIndirectBuffer), indirectInit, sizeof(indirectInit), static_cast<uint32_t>(BufferUsage::DynamicDraw));
+
+		// Per-frame constants UBO at binding 0; refreshed once per BeginScene
+		s_Data->FrameUBO = UniformBuffer::Create(sizeof(Renderer2DStorage::FrameConstants), 0);
+
 		// White texture
 		uint32_t whitePixel = 0xFFFFFFFFu;
 		Texture2D::TextureCreateInfo whiteTextureInfo;
@@ -273,6 +768,7 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 		s_Data->WhiteTexture = Texture2D::Create(whiteTextureInfo);
 		// Reserve slot 0 for white texture
 		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+		s_Data->TextureSlotIDs[0] = s_Data->WhiteTexture->GetRendererID();
 
 		// Initialization code for 2D renderer (shaders, buffers, etc.)
 		EnsureShaderLoaded();
@@ -285,15 +781,27 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 		if (!s_Data) return;
 
 		// Optionally unmap (not strictly required for persistent mapping during app lifetime)
-		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceVB ? s_Data->InstanceVB->GetRendererID() : 0);
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer), s_Data->InstanceUploadVB ? s_Data->InstanceUploadVB->GetRendererID() : 0);
 		GetRenderCommandQueue().UnmapBuffer(static_cast<uint32_t>(BufferTarget::ArrayBuffer));
 
+		if (s_Data->IndirectBufferID != 0)
+		{
+			GetRenderCommandQueue().DeleteBuffers(1, &s_Data->IndirectBufferID);
+			s_Data->IndirectBufferID = 0;
+		}
+
+		delete[] s_Data->InstanceStaging;
+		s_Data->InstanceStaging = nullptr;
 		s_Data->InstanceBuffer = nullptr;
 		s_Data->InstanceBufferPtr = nullptr;
 		s_Data->QuadVA.reset();
 		s_Data->InstanceVB.reset();
+		s_Data->InstanceUploadVB.reset();
+		s_Data->CulledInstanceVB.reset();
+		s_Data->FrameUBO.reset();
 		s_Data->WhiteTexture.reset();
 		s_Data->QuadShaderHandle = {};
+		s_Data->CullShaderHandle = {};
 
 		delete s_Data;
 		s_Data = nullptr;
@@ -314,6 +822,9 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 	{
 		if (!s_Data) return;
 		EnsureShaderLoaded();
+#ifdef VX_ENABLE_ASSERTS
+		s_SubmitThreadId = std::this_thread::get_id();
+#endif
 
 		// Store the render pass context
 		s_Data->CurrentRenderPass = pass;
@@ -327,9 +838,7 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 		}
 
 		s_Data->CurrentViewProj = camera.GetViewProjectionMatrix();
-
-	// Increment frame counter for rotation cache LRU tracking
-	s_Data->CurrentFrame++;
+		UpdateCullRows(s_Data);
 
 	// Cache current viewport size (FBO if set, else window)
 	if (pass && pass->GetTarget())
@@ -346,30 +855,24 @@ static void RebindInstanceAttribs(uint64_t baseOffset)
 		s_Data->CurrentViewportSize = glm::uvec2(0, 0);
 	}
 
-// Advance ring chunk and rebind attribute base offsets
+// Advance upload ring chunk
 s_Data->CurrentFrameChunkIndex = (s_Data->CurrentFrameChunkIndex + 1) % s_Data->FramesInFlight;
 
-// Wait for GPU to finish using this chunk (if in flight)
-uint64_t& fence = s_Data->FrameFences[s_Data->CurrentFrameChunkIndex];
-if (fence != 0ull)
-{
-    uint32_t status = 0;
-    // GL_TIMEOUT_IGNORED == 0xFFFFFFFFFFFFFFFFull; use ~0ull
-    GetRenderCommandQueue().ClientWaitSync(fence, 0ull, ~0ull, &status);
-    GetRenderCommandQueue().DeleteSync(fence);
-    fence = 0ull;
-}
-
-uint64_t baseOffset = s_Data->CurrentFrameChunkIndex * s_Data->FrameChunkSizeBytes;
+// Wait for GPU to finish copying out of this chunk (if in flight)
+WaitFrameFence(s_Data->FrameFences[s_Data->CurrentFrameChunkIndex]);
 
-// Update attribute pointers for locations 2..7 to point at new base offset
-RebindInstanceAttribs(baseOffset);
-
-// Reset write pointer and per-frame offset for this frame
-s_Data->InstanceBuffer = reinterpret_cast<Renderer2DStorage::QuadInstance*>(s_Data->InstanceMappedBase + baseOffset);
+// Reset write pointer (into CPU staging) and per-frame offset for this frame
+s_Data->InstanceBuffer = s_Data->InstanceStaging;
 s_Data->InstanceBufferPtr = s_Data->InstanceBuffer;
 s_Data->InstanceCount = 0;
 s_Data->FrameInstanceOffset = 0;
+
+// Upload per-frame constants once; Flush no longer sets these per draw call
+UpdateFrameConstants();
+
+// Other passes may have rebound texture units between scenes; drop the
+// skip-redundant-bind cache so the first flush rebinds everything
+s_Data->LastBoundTextureIDs.fill(0u);
 	}
 
 	RenderDomain Renderer2D::GetCurrentDomain()
@@ -378,8 +881,24 @@ s_Data->FrameInstanceOffset = 0;
 		return s_Data->CurrentDomain;
 	}
 
+	void Renderer2D::BeginDeferred()
+	{
+		Renderer2DStorage* d = s_Data;
+		if (!d) return;
+		d->DeferredMode = true;
+		d->DeferredCmds.clear();
+		d->DeferredTextures.resize(1); // index 0 reserved for the white texture
+		d->DeferredTextureIDs.resize(1);
+		d->LastDeferredTexID = 0;
+		d->LastDeferredTexIdx = 0;
+	}
+
 	void Renderer2D::EndScene()
 	{
+		// Sort and emit any deferred quads before the final flush
+		if (s_Data && s_Data->DeferredMode)
+			FlushDeferred(s_Data);
+
 		Flush();
 
 		// Clear render pass context
@@ -393,36 +912,94 @@ s_Data->FrameInstanceOffset = 0;
 	void Renderer2D::SetPixelSnapEnabled(bool enabled)
 	{
 		if (!s_Data) return;
+		if (s_Data->PixelSnapEnabled == enabled) return;
 		s_Data->PixelSnapEnabled = enabled;
+		// Keep the UBO in sync if toggled mid-scene
+		UpdateFrameConstants();
+	}
+
+	void Renderer2D::SetGPUCullingEnabled(bool enabled)
+	{
+		if (!s_Data) return;
+		s_Data->GPUCullingEnabled = enabled;
+		if (enabled)
+		{
+			EnsureCullShaderLoaded();
+		}
+	}
+
+	void Renderer2D::SetCPUCullingEnabled(bool enabled)
+	{
+		if (!s_Data) return;
+		s_Data->CPUCullingEnabled = enabled;
 	}
 
 	// Batching utilities
 	void Renderer2D::Flush()
 	{
-		if (!s_Data) return;
-		if (s_Data->InstanceCount == 0)
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d) return;
+		if (d->InstanceCount == 0)
 			return;
 
 		// Bind shader and set uniforms (only if shader asset is loaded)
 		auto& sm = GetShaderManager();
-		if (!s_Data->QuadShaderHandle.IsValid() || !s_Data->QuadShaderHandle.IsLoaded())
+		if (!d->QuadShaderHandle.IsValid() || !d->QuadShaderHandle.IsLoaded())
 			return;
-		sm.BindShader(s_Data->QuadShaderHandle);
-		sm.SetUniform("u_ViewProjection", s_Data->CurrentViewProj);
-		// Pixel snapping uniforms (engine-level)
-		glm::vec2 vpSize = glm::vec2((float)s_Data->CurrentViewportSize.x, (float)s_Data->CurrentViewportSize.y);
-		sm.SetUniform("u_ViewportSize", vpSize);
-		sm.SetUniform("u_PixelSnap", s_Data->PixelSnapEnabled ? 1 : 0);
-
-		// Bind all textures used in this batch to their slots
-		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; ++i)
-		{
-			const auto& tex = s_Data->TextureSlots[i];
-			if (tex)
-			{
-				std::string uniformName = "u_Textures[" + std::to_string(i) + "]";
-				sm.SetTexture(uniformName, tex->GetRendererID(), i);
-			}
+		sm.BindShader(d->QuadShaderHandle);
+		// View-projection / viewport / pixel-snap live in the FrameConstants UBO
+		// (binding 0), uploaded once per BeginScene — no per-draw uniform calls here
+
+		// Bind textures used in this batch; names come from the precomputed table,
+		// IDs from the flat mirror of TextureSlots, and slots whose texture didn't
+		// change since the last flush are skipped
+		for (uint32_t i = 0; i < d->TextureSlotIndex; ++i)
+		{
+			const uint32_t texID = d->TextureSlotIDs[i];
+			if (texID == 0u || d->LastBoundTextureIDs[i] == texID)
+				continue;
+			sm.SetTexture(kTexUniformNames[i], texID, i);
+			d->LastBoundTextureIDs[i] = texID;
+		}
+
+		// Stream this batch from cached CPU staging into the mapped upload ring in one shot,
+		// then kick a single GPU-side copy into the device-local instance buffer
+		const uint64_t stride = sizeof(Renderer2DStorage::QuadInstance);
+		const uint64_t chunkBase = static_cast<uint64_t>(d->CurrentFrameChunkIndex) * d->FrameChunkSizeBytes;
+		const uint64_t byteOffset = static_cast<uint64_t>(d->FrameInstanceOffset) * stride;
+		const uint64_t dataSize = static_cast<uint64_t>(d->InstanceCount) * stride;
+		StreamCopyToMapped(d->InstanceMappedBase + chunkBase + byteOffset,
+		                   d->InstanceBuffer + d->FrameInstanceOffset,
+		                   static_cast<size_t>(dataSize));
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::CopyReadBuffer), d->InstanceUploadVB->GetRendererID());
+		GetRenderCommandQueue().FlushMappedBufferRange(static_cast<uint32_t>(BufferTarget::CopyReadBuffer), chunkBase + byteOffset, dataSize);
+		GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::CopyWriteBuffer), d->InstanceVB->GetRendererID());
+		GetRenderCommandQueue().CopyBufferSubData(static_cast<uint32_t>(BufferTarget::CopyReadBuffer), static_cast<uint32_t>(BufferTarget::CopyWriteBuffer),
+		                                          chunkBase + byteOffset, byteOffset, dataSize);
+
+		// GPU culling path: compute pass compacts visible instances into CulledInstanceVB
+		// and bumps the indirect instance count; only taken when the compute asset is ready
+		const bool useGPUCulling = d->GPUCullingEnabled
+			&& d->CullShaderHandle.IsValid() && d->CullShaderHandle.IsLoaded();
+		if (useGPUCulling)
+		{
+			// Reset the indirect command's instanceCount before the cull pass accumulates into it
+			const uint32_t indirectReset[4] = { 4u, 0u, 0u, 0u };
+			GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::DrawIndirectBuffer), d->IndirectBufferID);
+			GetRenderCommandQueue().BufferSubData(static_cast<uint32_t>(BufferTarget::DrawIndirectBuffer), 0, indirectReset, sizeof(indirectReset));
+
+			sm.BindShader(d->CullShaderHandle);
+			// View-projection comes from the shared FrameConstants UBO
+			sm.SetUniform("u_FirstInstance", static_cast<int>(d->FrameInstanceOffset));
+			sm.SetUniform("u_InstanceCount", static_cast<int>(d->InstanceCount));
+			GetRenderCommandQueue().BindBufferBase(BufferTarget::ShaderStorageBuffer, 0, d->InstanceVB->GetRendererID());
+			GetRenderCommandQueue().BindBufferBase(BufferTarget::ShaderStorageBuffer, 1, d->CulledInstanceVB->GetRendererID());
+			GetRenderCommandQueue().BindBufferBase(BufferTarget::ShaderStorageBuffer, 2, d->IndirectBufferID);
+			GetRenderCommandQueue().DispatchCompute((d->InstanceCount + 63u) / 64u, 1, 1);
+			GetRenderCommandQueue().MemoryBarrier(ToFlags(MemoryBarrierFlags::CommandBit | MemoryBarrierFlags::VertexAttribArrayBit));
+
+			// Restore the quad shader for the actual draw (uniforms set above are per-program and persist)
+			sm.BindShader(d->QuadShaderHandle);
 		}
 
 		// 2D overlay: disable depth test for draw, then restore default
@@ -430,398 +1007,309 @@ s_Data->FrameInstanceOffset = 0;
 		GetRenderCommandQueue().SetBlendState(true);
 
 		// Bind VAO and draw instanced (triangle strip with 4 verts)
-		s_Data->QuadVA->Bind();
-		// Draw starting at FrameInstanceOffset within this frame chunk
-		GetRenderCommandQueue().DrawArrays(4, s_Data->InstanceCount, 0, s_Data->FrameInstanceOffset, static_cast<uint32_t>(PrimitiveTopology::TriangleStrip));
+		d->QuadVA->Bind();
+		if (useGPUCulling)
+		{
+			// Survivors are compacted from slot 0 of CulledInstanceVB; the GPU-written
+			// command supplies the instance count
+			if (d->InstanceAttribsBufferID != d->CulledInstanceVB->GetRendererID())
+			{
+				RebindInstanceAttribs(d->CulledInstanceVB->GetRendererID(), 0);
+			}
+			GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::DrawIndirectBuffer), d->IndirectBufferID);
+			GetRenderCommandQueue().DrawArraysIndirect(static_cast<uint32_t>(PrimitiveTopology::TriangleStrip), 0);
+		}
+		else
+		{
+			// Direct path: draw starting at FrameInstanceOffset within this frame
+			// chunk. Four strip vertices per instance, expanded from gl_VertexID
+			// in the vertex shader — there is deliberately no index buffer (a
+			// 6-indices-per-quad IBO would cost memory and an index fetch per
+			// vertex for a corner pattern the shader derives for free).
+			if (d->InstanceAttribsBufferID != d->InstanceVB->GetRendererID())
+			{
+				RebindInstanceAttribs(d->InstanceVB->GetRendererID(), 0);
+			}
+			GetRenderCommandQueue().DrawArrays(4, d->InstanceCount, 0, d->FrameInstanceOffset, static_cast<uint32_t>(PrimitiveTopology::TriangleStrip));
+		}
 
 		// Restore depth defaults (test/write enabled, Less) and disable blending
 		GetRenderCommandQueue().SetDepthState(true, true, SetDepthStateCommand::Less);
 		GetRenderCommandQueue().SetBlendState(false);
 
 		// Update per-frame offset to account for the submitted instances
-		s_Data->FrameInstanceOffset += s_Data->InstanceCount;
+		d->FrameInstanceOffset += d->InstanceCount;
 
 		// Replace any existing fence for this frame chunk (avoid leaking GLsyncs when flushing multiple times per frame)
-		if (s_Data->FrameFences[s_Data->CurrentFrameChunkIndex] != 0ull)
+		if (d->FrameFences[d->CurrentFrameChunkIndex] != 0ull)
 		{
-			GetRenderCommandQueue().DeleteSync(s_Data->FrameFences[s_Data->CurrentFrameChunkIndex]);
-			s_Data->FrameFences[s_Data->CurrentFrameChunkIndex] = 0ull;
+			GetRenderCommandQueue().DeleteSync(d->FrameFences[d->CurrentFrameChunkIndex]);
+			d->FrameFences[d->CurrentFrameChunkIndex] = 0ull;
 		}
 		uint64_t fenceHandle = 0ull;
 		GetRenderCommandQueue().FenceSync(&fenceHandle);
-		s_Data->FrameFences[s_Data->CurrentFrameChunkIndex] = fenceHandle;
+		d->FrameFences[d->CurrentFrameChunkIndex] = fenceHandle;
 
 		// Stats
-		s_Data->Stats.DrawCalls += 1;
-		s_Data->Stats.QuadCount += s_Data->InstanceCount;
+		d->Stats.DrawCalls += 1;
+		d->Stats.QuadCount += d->InstanceCount;
 
 		// Reset geometry for next batch; keep texture slots unless caller resets them
-		s_Data->InstanceCount = 0;
-		s_Data->InstanceBufferPtr = s_Data->InstanceBuffer + s_Data->FrameInstanceOffset;
+		d->InstanceCount = 0;
+		d->InstanceBufferPtr = d->InstanceBuffer + d->FrameInstanceOffset;
 	}
 
 	void Renderer2D::StartNewBatch()
 	{
-		if (!s_Data) return;
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d) return;
 
-		// If we've exhausted this frame chunk, rotate to the next one (with sync)
-		if (s_Data->FrameInstanceOffset >= MaxQuads)
+		// If we've exhausted this frame chunk, rotate the upload ring to the next one (with sync)
+		if (d->FrameInstanceOffset >= d->QuadCapacity)
 		{
-			const uint32_t next = (s_Data->CurrentFrameChunkIndex + 1) % s_Data->FramesInFlight;
-			uint64_t& nextFence = s_Data->FrameFences[next];
-			if (nextFence != 0ull)
-			{
-				uint32_t status = 0;
-				GetRenderCommandQueue().ClientWaitSync(nextFence, 0ull, ~0ull, &status);
-				GetRenderCommandQueue().DeleteSync(nextFence);
-				nextFence = 0ull;
-			}
-			s_Data->CurrentFrameChunkIndex = next;
-			const uint64_t newBase = static_cast<uint64_t>(s_Data->CurrentFrameChunkIndex) * s_Data->FrameChunkSizeBytes;
-			RebindInstanceAttribs(newBase);
-			s_Data->InstanceBuffer = reinterpret_cast<Renderer2DStorage::QuadInstance*>(s_Data->InstanceMappedBase + newBase);
-			s_Data->FrameInstanceOffset = 0;
+			const uint32_t next = (d->CurrentFrameChunkIndex + 1) % d->FramesInFlight;
+			WaitFrameFence(d->FrameFences[next]);
+			d->CurrentFrameChunkIndex = next;
+			d->FrameInstanceOffset = 0;
 		}
 
 		// Reset instance counters and pointer to next free slot within this frame chunk
-		s_Data->InstanceCount = 0;
-		s_Data->InstanceBufferPtr = s_Data->InstanceBuffer + s_Data->FrameInstanceOffset;
-
-		// Reset texture slots for a fresh batch
-		s_Data->TextureSlotIndex = 1;
-		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+		d->InstanceCount = 0;
+		d->InstanceBufferPtr = d->InstanceBuffer + d->FrameInstanceOffset;
+
+		// Reset texture slots for a fresh batch. Slot 0 stays pinned to the
+		// white texture from Initialize — AcquireTextureSlot never touches it,
+		// so there is no shared_ptr copy or ID refresh to redo per batch.
+		d->TextureSlotIndex = 1;
+		d->TextureHashKeys.fill(0u);
 	}
 
-	// DrawQuad implementations
+	// DrawQuad implementations: every overload is a thin wrapper over the
+	// SubmitQuad<HasRot, Is3D> funnel (null textures take the white-texture
+	// path inside SubmitInstance, so no separate untextured fallback is needed)
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
 	{
-		if (!s_Data) return;
-		// Ensure capacity; split batches and rotate chunks as needed
-		if (s_Data->FrameInstanceOffset + s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
-
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = position;
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(color);
-		inst.TexIndex = 0u; // white texture
-		inst.RotSinCos = { 1.0f, 0.0f };
-		inst.Z = 0.0f;
-		++s_Data->InstanceCount;
+		SubmitQuad<false, false>(position, size, 0.0f, nullptr, color);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Texture2DRef& texture, const glm::vec4& tintColor)
 	{
-		if (!s_Data) return;
-		if (!texture) { DrawQuad(position, size, tintColor); return; }
+		SubmitQuad<false, false>(position, size, 0.0f, texture, tintColor);
+	}
 
-		// Find existing texture slot or assign new one
-		uint32_t texIndex = 0u;
-		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; ++i)
-		{
-			if (s_Data->TextureSlots[i] && s_Data->TextureSlots[i].get() == texture.get())
-			{
-				texIndex = i;
-				break;
-			}
-		}
-		if (texIndex == 0u)
-		{
-			if (s_Data->TextureSlotIndex >= MaxTextureSlots)
-			{
-				Flush();
-				StartNewBatch();
-			}
-			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
-			texIndex = s_Data->TextureSlotIndex;
-			++s_Data->TextureSlotIndex;
-		}
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	{
+		SubmitQuad<false, false>(position, size, 0.0f, ResolveTextureAsset(textureAsset), tintColor);
+	}
 
-		if (s_Data->FrameInstanceOffset + s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
+	// Rotated variants. The float overloads are the native path — the batcher
+	// only supports Z rotation; the vec3 overloads stay for callers with
+	// Euler-angle data and assert (debug) that X/Y are actually zero.
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const glm::vec4& color)
+	{
+		SubmitQuad<true, false>(position, size, rotationZDegrees, nullptr, color);
+	}
 
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = position;
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(tintColor);
-		inst.TexIndex = texIndex;
-		inst.RotSinCos = { 1.0f, 0.0f };
-		inst.Z = 0.0f;
-		++s_Data->InstanceCount;
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const Texture2DRef& texture, const glm::vec4& tintColor)
+	{
+		SubmitQuad<true, false>(position, size, rotationZDegrees, texture, tintColor);
 	}
 
-	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
 	{
-		if (!textureAsset.IsValid() || !textureAsset.IsLoaded())
-		{
-			DrawQuad(position, size, tintColor);
-			return;
-		}
-		const TextureAsset* texAsset = textureAsset.TryGet();
-		if (!texAsset || !texAsset->IsReady() || !texAsset->GetTexture())
-		{
-			DrawQuad(position, size, tintColor);
-			return;
-		}
-		DrawQuad(position, size, texAsset->GetTexture(), tintColor);
+		SubmitQuad<true, false>(position, size, rotationZDegrees, ResolveTextureAsset(textureAsset), tintColor);
 	}
 
-		// Rotated colored quad (Unity-style Euler angles in degrees)
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const glm::vec4& color)
 	{
-		if (!s_Data) return;
-		if (s_Data->FrameInstanceOffset + s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
-
-		float rz = glm::radians(rotation.z);
-		float c = std::cos(rz), s = std::sin(rz);
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = position;
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(color);
-		inst.TexIndex = 0u;
-		inst.RotSinCos = { c, s };
-		inst.Z = 0.0f;
-		++s_Data->InstanceCount;
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, false>(position, size, rotation.z, nullptr, color);
 	}
 
-		// Rotated textured quad (Texture2DRef)
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const Texture2DRef& texture, const glm::vec4& tintColor)
 	{
-		if (!s_Data) return;
-		if (!texture) { DrawQuad(position, size, rotation, tintColor); return; }
-
-		// Find texture slot or allocate
-		uint32_t texIndex = 0u;
-		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; ++i)
-		{
-			if (s_Data->TextureSlots[i] && s_Data->TextureSlots[i].get() == texture.get())
-			{
-				texIndex = i;
-				break;
-			}
-		}
-		if (texIndex == 0u)
-		{
-			if (s_Data->TextureSlotIndex >= MaxTextureSlots)
-			{
-				Flush();
-				StartNewBatch();
-			}
-			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
-			texIndex = s_Data->TextureSlotIndex;
-			++s_Data->TextureSlotIndex;
-		}
-
-		if (s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
-
-		float rz = glm::radians(rotation.z);
-		float c = std::cos(rz), s = std::sin(rz);
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = position;
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(tintColor);
-		inst.TexIndex = texIndex;
-		inst.RotSinCos = { c, s };
-		inst.Z = 0.0f;
-		++s_Data->InstanceCount;
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, false>(position, size, rotation.z, texture, tintColor);
 	}
 
-	// Rotated textured quad (TextureAsset)
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
 	{
-		if (!textureAsset.IsValid() || !textureAsset.IsLoaded())
-		{
-			DrawQuad(position, size, rotation, tintColor);
-			return;
-		}
-		const TextureAsset* texAsset = textureAsset.TryGet();
-		if (!texAsset || !texAsset->IsReady() || !texAsset->GetTexture())
-		{
-			DrawQuad(position, size, rotation, tintColor);
-			return;
-		}
-		DrawQuad(position, size, rotation, texAsset->GetTexture(), tintColor);
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, false>(position, size, rotation.z, ResolveTextureAsset(textureAsset), tintColor);
 	}
 
-	// 3D positioned colored quad
+	// 3D positioned variants carry position.z through as the quad's depth
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
 	{
-		if (!s_Data) return;
-		if (s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
-
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = { position.x, position.y };
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(color);
-		inst.TexIndex = 0u;
-		inst.RotSinCos = { 1.0f, 0.0f };
-		inst.Z = position.z;
-		++s_Data->InstanceCount;
+		SubmitQuad<false, true>(position, size, 0.0f, nullptr, color);
 	}
 
-		// 3D positioned textured quad (Texture2DRef)
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Texture2DRef& texture, const glm::vec4& tintColor)
 	{
-		if (!s_Data) return;
-		if (!texture) { DrawQuad(position, size, tintColor); return; }
+		SubmitQuad<false, true>(position, size, 0.0f, texture, tintColor);
+	}
 
-		// Find existing texture slot or assign new one
-		uint32_t texIndex = 0u;
-		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; ++i)
-		{
-			if (s_Data->TextureSlots[i] && s_Data->TextureSlots[i].get() == texture.get())
-			{
-				texIndex = i;
-				break;
-			}
-		}
-		if (texIndex == 0u)
-		{
-			// Need a new slot
-			if (s_Data->TextureSlotIndex >= MaxTextureSlots)
-			{
-				Flush();
-				StartNewBatch();
-			}
-			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
-			texIndex = s_Data->TextureSlotIndex;
-			++s_Data->TextureSlotIndex;
-		}
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	{
+		SubmitQuad<false, true>(position, size, 0.0f, ResolveTextureAsset(textureAsset), tintColor);
+	}
 
-		if (s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const glm::vec4& color)
+	{
+		SubmitQuad<true, true>(position, size, rotationZDegrees, nullptr, color);
+	}
 
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = { position.x, position.y };
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(tintColor);
-		inst.TexIndex = texIndex;
-		inst.RotSinCos = { 1.0f, 0.0f };
-		inst.Z = position.z;
-		++s_Data->InstanceCount;
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const Texture2DRef& texture, const glm::vec4& tintColor)
+	{
+		SubmitQuad<true, true>(position, size, rotationZDegrees, texture, tintColor);
 	}
 
-		// 3D positioned textured quad (TextureAsset)
-	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
 	{
-		if (!textureAsset.IsValid() || !textureAsset.IsLoaded())
-		{
-			DrawQuad(position, size, tintColor);
-			return;
-		}
-		const TextureAsset* texAsset = textureAsset.TryGet();
-		if (!texAsset || !texAsset->IsReady() || !texAsset->GetTexture())
-		{
-			DrawQuad(position, size, tintColor);
-			return;
-		}
-		DrawQuad(position, size, texAsset->GetTexture(), tintColor);
+		SubmitQuad<true, true>(position, size, rotationZDegrees, ResolveTextureAsset(textureAsset), tintColor);
 	}
 
-		// 3D positioned rotated colored quad (Unity-style Euler angles in degrees)
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const glm::vec4& color)
 	{
-		if (!s_Data) return;
-		if (s_Data->InstanceCount >= MaxQuads)
-		{
-			Flush();
-			StartNewBatch();
-		}
-
-		float rz = glm::radians(rotation.z);
-		float c = std::cos(rz), s = std::sin(rz);
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = { position.x, position.y };
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(color);
-		inst.TexIndex = 0u;
-		inst.RotSinCos = { c, s };
-		inst.Z = position.z;
-		++s_Data->InstanceCount;
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, true>(position, size, rotation.z, nullptr, color);
 	}
 
-		// 3D positioned rotated textured quad (Texture2DRef)
 	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const Texture2DRef& texture, const glm::vec4& tintColor)
 	{
-		if (!s_Data) return;
-		if (!texture) { DrawQuad(position, size, rotation, tintColor); return; }
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, true>(position, size, rotation.z, texture, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	{
+		VX_CORE_ASSERT(rotation.x == 0.0f && rotation.y == 0.0f, "Renderer2D quads only rotate around Z");
+		SubmitQuad<true, true>(position, size, rotation.z, ResolveTextureAsset(textureAsset), tintColor);
+	}
+
+	// Batched submission: rotations are converted four at a time with SinCos4
+	// instead of per-quad libm calls; the tail (and non-x64) uses the scalar path
+	void Renderer2D::DrawQuads(const QuadDesc* descs, size_t count)
+	{
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d || !descs || count == 0) [[unlikely]] return;
+
+		constexpr float kDegToRad = 0.01745329251994329577f;
+		size_t i = 0;
 
-		// Find texture slot or allocate
-		uint32_t texIndex = 0u;
-		for (uint32_t i = 1; i < s_Data->TextureSlotIndex; ++i)
+#if defined(_M_X64) || defined(__x86_64__)
+		for (; i + 4 <= count; i += 4)
 		{
-			if (s_Data->TextureSlots[i] && s_Data->TextureSlots[i].get() == texture.get())
+			EnsureCapacity(d, 4);
+
+			__m128 rad = _mm_mul_ps(_mm_setr_ps(descs[i + 0].RotationZDegrees, descs[i + 1].RotationZDegrees,
+			                                    descs[i + 2].RotationZDegrees, descs[i + 3].RotationZDegrees),
+			                        _mm_set1_ps(kDegToRad));
+			__m128 s4, c4;
+			SinCos4(rad, &s4, &c4);
+			alignas(16) float sv[4], cv[4];
+			_mm_store_ps(sv, s4);
+			_mm_store_ps(cv, c4);
+
+			// Colors are packed four at a time as well; the two pack stages
+			// amortize across the block
+			alignas(16) uint32_t rgba[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(rgba),
+			                PackColorRGBA8x4(descs[i + 0].Color, descs[i + 1].Color,
+			                                 descs[i + 2].Color, descs[i + 3].Color));
+
+			for (size_t k = 0; k < 4; ++k)
 			{
-				texIndex = i;
-				break;
+				const QuadDesc& q = descs[i + k];
+				EmitInstance(d, q.Position, q.Size * 0.5f, rgba[k], 0u, { cv[k], sv[k] }, q.Z);
 			}
 		}
-		if (texIndex == 0u)
+#endif
+
+		for (; i < count; ++i)
 		{
-			if (s_Data->TextureSlotIndex >= MaxTextureSlots)
-			{
-				Flush();
-				StartNewBatch();
-			}
-			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
-			texIndex = s_Data->TextureSlotIndex;
-			++s_Data->TextureSlotIndex;
+			EnsureCapacity(d);
+
+			const QuadDesc& q = descs[i];
+			float s, c;
+			SinCos1(q.RotationZDegrees * kDegToRad, &s, &c);
+			EmitInstance(d, q.Position, q.Size * 0.5f, PackColorRGBA8(q.Color), 0u, { c, s }, q.Z);
 		}
+	}
+
+	// Uniform-size batch: half-size and packed color leave the loop, so each
+	// iteration is just a position load and one instance store
+	void Renderer2D::DrawQuadsUniformSize(const glm::vec2& size, const glm::vec2* positions, size_t count,
+	                                      const glm::vec4& color, float z)
+	{
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d || !positions || count == 0) [[unlikely]] return;
+
+		const glm::vec2 halfSize = size * 0.5f;
+		const uint32_t colorRGBA = PackColorRGBA8(color);
+		const uint32_t zPacked = glm::packHalf1x16(z);
 
-		if (s_Data->InstanceCount >= MaxQuads)
+		for (size_t i = 0; i < count; ++i)
 		{
-			Flush();
-			StartNewBatch();
+			EnsureCapacity(d);
+			EmitInstancePacked(d, positions[i], halfSize, colorRGBA, 0u, kIdentityRotPacked, zPacked);
 		}
-
-		float rz = glm::radians(rotation.z);
-		float c = std::cos(rz), s = std::sin(rz);
-		auto& inst = *s_Data->InstanceBufferPtr++;
-		inst.Center = { position.x, position.y };
-		inst.HalfSize = size * 0.5f;
-		inst.ColorRGBA = PackColorRGBA8(tintColor);
-		inst.TexIndex = texIndex;
-		inst.RotSinCos = { c, s };
-		inst.Z = position.z;
-		++s_Data->InstanceCount;
 	}
 
-	// 3D positioned rotated textured quad (TextureAsset)
-	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor)
+	// SoA batch path: four quads' (center, halfSize) rows are assembled with
+	// unpack/movelh shuffles straight from the input streams, and the constant
+	// (color, texIndex, rotation, z) half of the instance is built once and
+	// reused for the whole batch — two stores per quad, no per-quad packing
+	void Renderer2D::DrawQuadsSoA(const float* xs, const float* ys,
+	                              const float* widths, const float* heights, size_t count,
+	                              const glm::vec4& color, float z)
 	{
-		if (!textureAsset.IsValid() || !textureAsset.IsLoaded())
+		Renderer2DStorage* __restrict d = s_Data;
+		if (!d || !xs || !ys || !widths || !heights || count == 0) [[unlikely]] return;
+
+		const uint32_t colorRGBA = PackColorRGBA8(color);
+		const uint32_t rotPacked = kIdentityRotPacked;
+		const uint32_t zPacked = glm::packHalf1x16(z);
+
+		size_t i = 0;
+#if defined(_M_X64) || defined(__x86_64__)
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 hiHalf = _mm_castsi128_ps(_mm_setr_epi32(
+			static_cast<int32_t>(colorRGBA), 0,
+			static_cast<int32_t>(rotPacked), static_cast<int32_t>(zPacked)));
+		for (; i + 4 <= count; i += 4)
 		{
-			DrawQuad(position, size, rotation, tintColor);
-			return;
+			EnsureCapacity(d, 4);
+			const __m128 x4 = _mm_loadu_ps(xs + i);
+			const __m128 y4 = _mm_loadu_ps(ys + i);
+			const __m128 hw4 = _mm_mul_ps(_mm_loadu_ps(widths + i), half);
+			const __m128 hh4 = _mm_mul_ps(_mm_loadu_ps(heights + i), half);
+
+			// Transpose lanes into per-quad (x, y, hw, hh) rows
+			const __m128 xy01 = _mm_unpacklo_ps(x4, y4);
+			const __m128 xy23 = _mm_unpackhi_ps(x4, y4);
+			const __m128 wh01 = _mm_unpacklo_ps(hw4, hh4);
+			const __m128 wh23 = _mm_unpackhi_ps(hw4, hh4);
+
+			float* dst = reinterpret_cast<float*>(d->InstanceBufferPtr);
+			_mm_storeu_ps(dst + 0,  _mm_movelh_ps(xy01, wh01));
+			_mm_storeu_ps(dst + 4,  hiHalf);
+			_mm_storeu_ps(dst + 8,  _mm_movehl_ps(wh01, xy01));
+			_mm_storeu_ps(dst + 12, hiHalf);
+			_mm_storeu_ps(dst + 16, _mm_movelh_ps(xy23, wh23));
+			_mm_storeu_ps(dst + 20, hiHalf);
+			_mm_storeu_ps(dst + 24, _mm_movehl_ps(wh23, xy23));
+			_mm_storeu_ps(dst + 28, hiHalf);
+			d->InstanceBufferPtr += 4;
+			d->InstanceCount += 4;
 		}
-		const TextureAsset* texAsset = textureAsset.TryGet();
-		if (!texAsset || !texAsset->IsReady() || !texAsset->GetTexture())
+#endif
+		for (; i < count; ++i)
 		{
-			DrawQuad(position, size, rotation, tintColor);
-			return;
+			EnsureCapacity(d);
+			EmitInstancePacked(d, { xs[i], ys[i] }, { widths[i] * 0.5f, heights[i] * 0.5f },
+			                   colorRGBA, 0u, rotPacked, zPacked);
 		}
-		DrawQuad(position, size, rotation, texAsset->GetTexture(), tintColor);
 	}
 
 	const Renderer2DStatistics& Renderer2D::GetStats()
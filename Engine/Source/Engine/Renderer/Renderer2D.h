@@ -16,60 +16,121 @@ namespace Vortex
 	class CameraSystem;
 	class VertexArray;
 	class VertexBuffer;
-	class IndexBuffer;
 	class Shader;
 	class TextureAsset;
 	class RenderPass;
+	class UniformBuffer;
 
-	// Batch capacity (quads per draw call). If exceeded we flush and start
-	constexpr uint32_t MaxQuads = 10000;
-	constexpr uint32_t MaxVertices = MaxQuads * 4;
-	constexpr uint32_t MaxIndices = MaxQuads * 6;
+	// Default batch capacity (quads per frame chunk). The actual capacity is
+	// read once from "Renderer.Max2DBatchQuads" in the engine config at
+	// Initialize() and sizes the staging array and upload ring; exceeding it
+	// mid-frame flushes and rotates to the next ring chunk.
+	constexpr uint32_t DefaultMaxQuads = 10000;
 	constexpr uint32_t MaxTextureSlots = 32;
 
-	struct QuadVertex 
-	{
-		glm::vec3 Position;
-		glm::vec4 Color;
-		glm::vec2 TexCoord;
-		float     TexIndex;
-	};
-
-	struct Renderer2DStatistics 
+	struct Renderer2DStatistics
 	{
 		uint32_t DrawCalls = 0;
 		uint32_t QuadCount = 0;
 	};
 
-	// Cached rotation data for frequently used angles
-	struct CachedRotation
+	// One quad for the batched DrawQuads path (colored, optional Z-rotation)
+	struct QuadDesc
 	{
-		glm::vec3 angles = glm::vec3(0.0f);
-		float cosX, sinX, cosY, sinY, cosZ, sinZ;
-		uint32_t frameLastUsed = 0;
+		glm::vec2 Position = glm::vec2(0.0f);
+		glm::vec2 Size = glm::vec2(1.0f);
+		glm::vec4 Color = glm::vec4(1.0f);
+		float RotationZDegrees = 0.0f;
+		float Z = 0.0f;
 	};
 
+	// Members are grouped by access frequency: the per-quad hot state sits
+	// first on its own cache lines (alignas(64)), per-batch/per-frame state
+	// follows, and setup-time/cold state trails. DrawQuad then touches one or
+	// two lines instead of pulling shader handles and camera state into L1
+	// alongside the write cursor.
 	struct Renderer2DStorage
 	{
-		std::shared_ptr<VertexArray>  QuadVA;
-		// Per-instance buffer (persistent-mapped ring)
-		std::shared_ptr<VertexBuffer> InstanceVB;
-
-		// CPU-side instance buffer
-		struct QuadInstance
+		// CPU-side instance buffer. Rotation and depth are packed to shrink the
+		// stride to 32 bytes: sin/cos fit snorm16 exactly and Z rarely needs more
+		// than half precision, which cuts both ring bandwidth and vertex fetch.
+		// alignas keeps every instance wholly inside one cache line and makes
+		// the staging array a valid source for aligned SIMD loads.
+		//
+		// Layout note: this is deliberately AoS, not SoA. At 32 bytes an
+		// instance is exactly one SIMD register wide, so DrawQuad emits it with
+		// a single vector store and Flush streams the array to the ring as-is.
+		// SoA staging would need nine stride-1 writes per quad plus a second
+		// interleave pass at Flush into this same GPU layout — more bytes
+		// touched for no extra vectorization. Batch entry points that benefit
+		// from SoA inputs get it at the API boundary instead (DrawQuadsSoA).
+		//
+		// 32 bytes is also the floor for quantization: Center must stay fp32
+		// (fp16's 11-bit mantissa visibly wobbles sub-pixel positions a few
+		// thousand units from the origin) and shrinking HalfSize to fp16 would
+		// only reach 28 bytes — an odd stride that breaks the one-register
+		// store and lets instances straddle cache lines.
+		struct alignas(32) QuadInstance
 		{
 			glm::vec2 Center;
 			glm::vec2 HalfSize;
 			uint32_t  ColorRGBA;
 			uint32_t  TexIndex;
-			glm::vec2 RotSinCos; // (cosZ, sinZ)
-			float     Z;
+			uint32_t  RotSinCos; // (cosZ, sinZ) as two snorm16
+			uint16_t  Z;         // depth as half-float
+			uint16_t  _Pad0;     // keeps the struct a clean 32 bytes
 		};
-		QuadInstance* InstanceBuffer = nullptr; // points into mapped GPU memory
-		QuadInstance* InstanceBufferPtr = nullptr;
+		static_assert(sizeof(QuadInstance) == 32, "QuadInstance must stay 32 bytes");
+
+		// --- Hot: read/written on every DrawQuad ---
+		// Write cursor into the staging array (next free slot)
+		alignas(64) QuadInstance* InstanceBufferPtr = nullptr;
+		// One past the last writable staging slot; capacity checks are a single
+		// pointer compare against this instead of re-deriving offset + count
+		QuadInstance* WriteEnd = nullptr;
+		// When set, DrawQuad records into DeferredCmds instead of emitting
+		bool DeferredMode = false;
+		// Opt-in conservative CPU cull (see SetCPUCullingEnabled); rows are
+		// only valid for affine (ortho) view-projections
+		bool CPUCullingEnabled = false;
+		bool CullRowsValid = false;
+		// X/Y rows of the view-projection as (m00, m01, translate) plus the
+		// per-axis |row| sums used to expand the NDC bound; set in BeginScene
+		glm::vec3 CullRowX = glm::vec3(0.0f);
+		glm::vec3 CullRowY = glm::vec3(0.0f);
+		float CullReachX = 0.0f;
+		float CullReachY = 0.0f;
+		uint32_t TextureSlotIndex = 1; // 0 = white texture reserved
+		// Texture→slot fast path for the deferred list (last texture reused)
+		uint32_t LastDeferredTexID = 0;
+		uint16_t LastDeferredTexIdx = 0;
+
+		// Open-addressed hash from texture renderer ID to slot index (2x slots,
+		// power of two); key 0 = empty. Replaces the per-quad linear slot scan.
+		static constexpr uint32_t TextureHashCapacity = MaxTextureSlots * 2;
+		alignas(64) std::array<uint32_t, TextureHashCapacity> TextureHashKeys{};
+		std::array<uint8_t, TextureHashCapacity> TextureHashSlots{};
+		// Raw renderer IDs mirroring TextureSlots, so Flush walks one flat
+		// array instead of dereferencing shared_ptr control blocks
+		std::array<uint32_t, MaxTextureSlots> TextureSlotIDs{};
+
+		// --- Warm: touched per batch / per frame ---
+		// Cached CPU staging array; DrawQuad writes here with full cache benefits,
+		// Flush streams it to the upload ring in one shot
+		QuadInstance* InstanceStaging = nullptr;
+		QuadInstance* InstanceBuffer = nullptr; // base pointer for the current frame (into InstanceStaging)
 		uint32_t InstanceCount = 0;
+		// Quads per frame chunk; read from the engine config at Initialize
+		uint32_t QuadCapacity = DefaultMaxQuads;
 
-		// Persistent mapping state
+		// Persistent mapping state (upload ring). The ring protocol: the
+		// buffer holds FramesInFlight chunks of FrameChunkSizeBytes, mapped
+		// once at Initialize (write + persistent + explicit flush — no
+		// orphaning, no per-frame map/unmap). Flush streams staged instances
+		// into the current chunk, flushes the written range, copies it to the
+		// device-local buffer, and fences the chunk; BeginScene advances the
+		// ring and retires the fence of the chunk about to be reused (see
+		// WaitFrameFence). Draws index into the chunk via baseInstance.
 		uint8_t* InstanceMappedBase = nullptr;
 		uint64_t InstanceRingSizeBytes = 0;
 		uint32_t FramesInFlight = 3;
@@ -80,22 +141,76 @@ namespace Vortex
         // Tracks how many instances have been submitted from this frame chunk
         uint32_t FrameInstanceOffset = 0;
 
+        // Lifetime keep-alive for bound textures (the probe path uses TextureSlotIDs)
         std::array<Texture2DRef, MaxTextureSlots> TextureSlots;
-        uint32_t TextureSlotIndex = 1; // 0 = white texture reserved
+        // Texture IDs bound by the previous Flush; unchanged slots are skipped
+        std::array<uint32_t, MaxTextureSlots> LastBoundTextureIDs{};
+
+        // One deferred quad; SortKey is (sortable Z half bits << 16) | texture
+        // index so one radix sort orders the list by layer, then by texture
+        struct QuadCmd
+        {
+            glm::vec2 Center;
+            glm::vec2 HalfSize;
+            uint32_t  ColorRGBA;
+            uint32_t  RotSinCos; // packed as in QuadInstance
+            uint16_t  ZHalf;
+            uint16_t  TexIdx;    // index into DeferredTextures; 0 = white
+            uint32_t  SortKey;
+        };
+        static_assert(sizeof(QuadCmd) == 32, "QuadCmd must stay 32 bytes");
+
+        // Deferred draw list (opt-in via BeginDeferred): quads accumulate here
+        // and are sorted by (Z, texture) at EndScene to minimize batch splits
+        std::vector<QuadCmd> DeferredCmds;
+        std::vector<Texture2DRef> DeferredTextures;
+        std::vector<uint32_t> DeferredTextureIDs; // parallel to DeferredTextures
+        std::vector<uint64_t> DeferredSortScratch;
+
+		// --- Cold: setup-time state and GPU object handles ---
+		std::shared_ptr<VertexArray>  QuadVA;
+		// Device-local per-instance buffer the VAO reads from
+		std::shared_ptr<VertexBuffer> InstanceVB;
+		// Persistent-mapped upload ring (staging on the GPU side); flushed to InstanceVB via CopyBufferSubData
+		std::shared_ptr<VertexBuffer> InstanceUploadVB;
+		// Compacted survivor stream written by the GPU culling compute pass (unused when culling is off)
+		std::shared_ptr<VertexBuffer> CulledInstanceVB;
 
 		Texture2DRef WhiteTexture;
 		AssetHandle<ShaderAsset> QuadShaderHandle;
 		std::shared_ptr<Shader>  QuadShader;
 
+		// GPU culling (opt-in): compute pass frustum-culls instances into CulledInstanceVB
+		// and fills an indirect draw command; falls back to the direct path when the
+		// compute shader or GL support is unavailable
+		AssetHandle<ShaderAsset> CullShaderHandle;
+		std::shared_ptr<Shader>  CullShader;
+		uint32_t IndirectBufferID = 0;
+		bool GPUCullingEnabled = false;
+		// Which buffer the instance attribs currently source from (avoids redundant rebinds)
+		uint32_t InstanceAttribsBufferID = 0;
+
 		glm::mat4 CurrentViewProj = glm::mat4(1.0f);
 		glm::uvec2 CurrentViewportSize = glm::uvec2(0, 0);
 		bool PixelSnapEnabled = false;
 
-		// Rotation cache for performance optimization
-		std::array<CachedRotation, 16> RotationCache;
-		uint32_t CurrentFrame = 0;
+		// Per-frame shader constants, uploaded to a UBO (binding 0) once per BeginScene
+		// instead of via string-keyed SetUniform on every Flush. std140 layout.
+		struct FrameConstants
+		{
+			glm::mat4 ViewProj;
+			glm::vec2 ViewportSize;
+			int32_t   PixelSnap;
+			float     _Pad0;
+		};
+		std::shared_ptr<UniformBuffer> FrameUBO;
+
 
-		// Current render pass context (nullptr for default)
+		// Current render pass context (nullptr for default). Domain and pixel
+		// snap are per-scene state resolved at BeginScene (snap runs in the
+		// vertex shader off the frame UBO), so no per-quad path branches on
+		// either — there is nothing for a per-domain DrawQuad specialization
+		// to remove.
 		RenderPass* CurrentRenderPass = nullptr;
 		RenderDomain CurrentDomain = RenderDomain::World2D;
 
@@ -129,6 +244,17 @@ namespace Vortex
 
 		static void EndScene();
 
+		/**
+		 * @brief Defer this scene's DrawQuad calls into a sorted draw list
+		 *
+		 * Call after BeginScene. Quads accumulate in a per-frame list instead of
+		 * being emitted immediately; EndScene radix-sorts the list by (Z, texture)
+		 * before emitting, so intermixed textures no longer split batches. The
+		 * mode resets when the scene ends. Batch APIs (DrawQuads,
+		 * DrawQuadsUniformSize) bypass the list and draw immediately.
+		 */
+		static void BeginDeferred();
+
 		/**
 		 * @brief Get the current render domain
 		 * @return The render domain of the current pass, or World2D if none
@@ -138,14 +264,44 @@ namespace Vortex
 		// Configuration
 		static void SetPixelSnapEnabled(bool enabled);
 
+		/**
+		 * @brief Enable/disable the GPU compute culling path for large static scenes
+		 *
+		 * Requires GL 4.3 compute support and the Renderer2DCull compute shader asset;
+		 * when either is missing the renderer silently uses the direct draw path.
+		 */
+		static void SetGPUCullingEnabled(bool enabled);
+
+		/**
+		 * @brief Enable/disable conservative CPU culling of quads at submit time
+		 *
+		 * Rejects quads whose bounds fall outside the view before they reach the
+		 * instance buffer. Only active for orthographic (affine) cameras; with a
+		 * perspective view-projection quads pass through untested. Worth enabling
+		 * when a large fraction of submitted quads is off-screen (e.g. tilemaps
+		 * drawn without chunking); otherwise the per-quad test is pure overhead.
+		 */
+		static void SetCPUCullingEnabled(bool enabled);
+
 		// Mid-scene batching controls
 		static void Flush();          // Submit current batch without ending the scene
 		static void StartNewBatch();   // Reset batch state (clears geometry and texture slots)
 
-		// Draw Quad overloads - 2D positioning
+		// Draw Quad overloads - 2D positioning.
+		// All overloads are deliberately out-of-line: inlining them would mean
+		// exposing Renderer2DStorage, the packed-emit helpers, and the texture
+		// slot hash from this header for a saved call/ret per quad. Builds
+		// with LTO get the cross-TU folding anyway without the API leak.
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
+		// Z-only rotation fast path (degrees) — the native form; quads can only
+		// rotate around Z, so this skips the Euler vec3 plumbing entirely
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const glm::vec4& color);
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotationZDegrees, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
+		// Euler-angle convenience overloads; only rotation.z is honored and
+		// debug builds assert that X/Y are zero
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const glm::vec4& color);
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec3& rotation, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
@@ -154,10 +310,44 @@ namespace Vortex
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const glm::vec4& color);
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, float rotationZDegrees, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const glm::vec4& color);
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const Texture2DRef& texture, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec3& rotation, const AssetHandle<TextureAsset>& textureAsset, const glm::vec4& tintColor = glm::vec4(1.0f));
 
+		/**
+		 * @brief Submit many quads at once
+		 *
+		 * Rotations are converted with a SIMD sin/cos approximation four at a
+		 * time instead of per-quad libm calls; prefer this over a DrawQuad loop
+		 * when emitting large numbers of rotated sprites.
+		 */
+		static void DrawQuads(const QuadDesc* descs, size_t count);
+
+		/**
+		 * @brief Submit many axis-aligned quads that share one size and color
+		 *
+		 * The half-size and packed color are computed once up front, so the
+		 * inner loop is a single instance store per quad; use for particle
+		 * systems and tilemaps where per-quad state is just a position.
+		 */
+		static void DrawQuadsUniformSize(const glm::vec2& size, const glm::vec2* positions, size_t count,
+		                                 const glm::vec4& color = glm::vec4(1.0f), float z = 0.0f);
+
+		/**
+		 * @brief Submit many axis-aligned quads from SoA position/size streams
+		 *
+		 * Centers and sizes arrive as separate float arrays, so the emit loop
+		 * interleaves four quads at a time with SIMD shuffles instead of
+		 * gathering scattered struct fields; use when placement is computed in
+		 * bulk by systems that already keep their data SoA.
+		 */
+		static void DrawQuadsSoA(const float* xs, const float* ys,
+		                         const float* widths, const float* heights, size_t count,
+		                         const glm::vec4& color = glm::vec4(1.0f), float z = 0.0f);
+
 		// Renderer2D Stats
 		static const Renderer2DStatistics& GetStats();
 		static void ResetStats();
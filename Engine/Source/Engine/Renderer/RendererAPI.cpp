@@ -24,92 +24,147 @@ namespace Vortex
     // RendererAPI Factory Methods
     // ============================================================================
 
-    std::unique_ptr<RendererAPI> RendererAPI::Create(GraphicsAPI api)
+    namespace
     {
-        switch (api)
+        using RendererFactory = std::unique_ptr<RendererAPI> (*)();
+
+        #ifdef VX_OPENGL_SUPPORT
+            std::unique_ptr<RendererAPI> MakeOpenGL() { return std::make_unique<OpenGLRendererAPI>(); }
+        #endif
+        #ifdef VX_DIRECTX11_SUPPORT
+            std::unique_ptr<RendererAPI> MakeDX11() { return std::make_unique<DX11RendererAPI>(); }
+        #endif
+        #ifdef VX_DIRECTX12_SUPPORT
+            std::unique_ptr<RendererAPI> MakeDX12() { return std::make_unique<DX12RendererAPI>(); }
+        #endif
+        #ifdef VX_VULKAN_SUPPORT
+            std::unique_ptr<RendererAPI> MakeVulkan() { return std::make_unique<VulkanRendererAPI>(); }
+        #endif
+
+        // Indexed by GraphicsAPI; backends compiled out leave a null slot, so
+        // the linker can drop their object code entirely
+        constexpr RendererFactory kFactories[] =
         {
+            /* None      */ nullptr,
             #ifdef VX_OPENGL_SUPPORT
-                case GraphicsAPI::OpenGL:
-                    return std::make_unique<OpenGLRendererAPI>();
+            /* OpenGL    */ &MakeOpenGL,
+            #else
+            /* OpenGL    */ nullptr,
             #endif
-
             #ifdef VX_DIRECTX11_SUPPORT
-                case GraphicsAPI::DirectX11:
-                    return std::make_unique<DX11RendererAPI>();
+            /* DirectX11 */ &MakeDX11,
+            #else
+            /* DirectX11 */ nullptr,
             #endif
-
             #ifdef VX_DIRECTX12_SUPPORT
-                case GraphicsAPI::DirectX12:
-                    return std::make_unique<DX12RendererAPI>();
+            /* DirectX12 */ &MakeDX12,
+            #else
+            /* DirectX12 */ nullptr,
             #endif
-
             #ifdef VX_VULKAN_SUPPORT
-                case GraphicsAPI::Vulkan:
-                    return std::make_unique<VulkanRendererAPI>();
+            /* Vulkan    */ &MakeVulkan,
+            #else
+            /* Vulkan    */ nullptr,
             #endif
+            /* Metal     */ nullptr
+        };
+        static_assert(sizeof(kFactories) / sizeof(kFactories[0]) ==
+                      static_cast<size_t>(GraphicsAPI::Metal) + 1,
+                      "kFactories must cover every GraphicsAPI value");
+
+        // Platform preference order for the default Create()
+        constexpr GraphicsAPI kPreferredAPIs[] =
+        {
+        #if defined(VX_PLATFORM_WINDOWS)
+            GraphicsAPI::DirectX12, GraphicsAPI::DirectX11, GraphicsAPI::OpenGL, GraphicsAPI::Vulkan
+        #elif defined(VX_PLATFORM_MACOS)
+            GraphicsAPI::OpenGL
+        #else
+            GraphicsAPI::OpenGL, GraphicsAPI::Vulkan
+        #endif
+        };
+    }
 
-            case GraphicsAPI::None:
-                default:
-                VX_CORE_ERROR("Unsupported graphics API: {}", static_cast<int>(api));
-                return nullptr;
+    std::unique_ptr<RendererAPI> RendererAPI::Create(GraphicsAPI api)
+    {
+        const auto index = static_cast<size_t>(api);
+        const RendererFactory factory =
+            index < sizeof(kFactories) / sizeof(kFactories[0]) ? kFactories[index] : nullptr;
+        if (!factory)
+        {
+            VX_CORE_ERROR("Unsupported graphics API: {}", static_cast<int>(api));
+            return nullptr;
         }
+        return factory();
     }
 
     std::unique_ptr<RendererAPI> RendererAPI::Create()
     {
-        // Default preference order based on platform and availability
-        #if defined(VX_PLATFORM_WINDOWS)
-            // On Windows, prefer DirectX 12 > DirectX 11 > OpenGL > Vulkan
-            #ifdef VX_DIRECTX12_SUPPORT
-                auto renderer = Create(GraphicsAPI::DirectX12);
-                if (renderer) return renderer;
-            #endif
-
-            #ifdef VX_DIRECTX11_SUPPORT
-                auto renderer = Create(GraphicsAPI::DirectX11);
-                if (renderer) return renderer;
-            #endif
-
-            #ifdef VX_OPENGL_SUPPORT
-                auto renderer = Create(GraphicsAPI::OpenGL);
-                if (renderer) return renderer;
-            #endif
+        for (GraphicsAPI api : kPreferredAPIs)
+        {
+            if (kFactories[static_cast<size_t>(api)])
+            {
+                return Create(api);
+            }
+        }
 
-            #ifdef VX_VULKAN_SUPPORT
-                return Create(GraphicsAPI::Vulkan);
-            #endif
+        VX_CORE_ERROR("No supported graphics API found!");
+        return nullptr;
+    }
 
-        #elif defined(VX_PLATFORM_MACOS)
-            // On macOS, prefer OpenGL (Metal not yet implemented)
-            #ifdef VX_OPENGL_SUPPORT
-                return Create(GraphicsAPI::OpenGL);
-            #endif
+    Result<uint32_t> RendererAPI::GetOrCreateVertexLayout(const VertexAttrib* attribs, uint32_t count)
+    {
+        if (!attribs || count == 0)
+        {
+            return Result<uint32_t>(ErrorCode::InvalidParameter, "Empty vertex layout description");
+        }
 
-        #else
-            // On Linux and other platforms, prefer OpenGL > Vulkan
-            #ifdef VX_OPENGL_SUPPORT
-                auto renderer = Create(GraphicsAPI::OpenGL);
-                if (renderer) return renderer;
-            #endif
+        // FNV-1a over the description fields (not the raw struct bytes, so
+        // padding never perturbs the hash)
+        uint64_t hash = 1469598103934665603ull;
+        auto mix = [&hash](uint64_t value)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        };
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const VertexAttrib& attrib = attribs[i];
+            mix(attrib.Index);
+            mix(static_cast<uint64_t>(attrib.ComponentCount));
+            mix(static_cast<uint64_t>(attrib.Type));
+            mix((uint64_t(attrib.Normalized) << 1) | uint64_t(attrib.Integer));
+            mix(attrib.RelativeOffset);
+            mix(attrib.Binding);
+            mix(attrib.Divisor);
+        }
 
-            #ifdef VX_VULKAN_SUPPORT
-                return Create(GraphicsAPI::Vulkan);
-            #endif
-        #endif
+        auto it = m_VertexLayoutCache.find(hash);
+        if (it != m_VertexLayoutCache.end())
+        {
+            return Result<uint32_t>(uint32_t(it->second));
+        }
 
-        VX_CORE_ERROR("No supported graphics API found!");
-        return nullptr;
+        auto created = CreateVertexLayout(attribs, count);
+        if (created.IsSuccess())
+        {
+            m_VertexLayoutCache.emplace(hash, created.GetValue());
+        }
+        return created;
     }
 
     // ============================================================================
     // RendererAPIManager Implementation
     // ============================================================================
 
-    RendererAPIManager& RendererAPIManager::GetInstance()
-    {
-        static RendererAPIManager instance;
-        return instance;
-    }
+    RendererAPIManager RendererAPIManager::s_Instance;
+
+    // Cached by Initialize/Shutdown so the global GetRenderer() and
+    // GetGraphicsContextFromRenderer() are each a single pointer load instead
+    // of chasing the manager's unique_ptr (and then the renderer's context
+    // member) every call
+    static RendererAPI* s_ActiveRenderer = nullptr;
+    static GraphicsContext* s_ActiveContext = nullptr;
 
     Result<void> RendererAPIManager::Initialize(GraphicsAPI api, GraphicsContext* context)
     {
@@ -148,6 +203,8 @@ namespace Vortex
         }
 
         m_CurrentAPI = api;
+        s_ActiveRenderer = m_RendererAPI.get();
+        s_ActiveContext = context;
         VX_CORE_INFO("Renderer API initialized successfully: {}", m_RendererAPI->GetName());
 
         return Result<void>();
@@ -164,6 +221,8 @@ namespace Vortex
 
         VX_CORE_INFO("Shutting down renderer API: {}", m_RendererAPI->GetName());
 
+        s_ActiveRenderer = nullptr;
+        s_ActiveContext = nullptr;
         auto shutdownResult = m_RendererAPI->Shutdown();
         m_RendererAPI.reset();
         m_CurrentAPI = GraphicsAPI::None;
@@ -184,7 +243,12 @@ namespace Vortex
 
     RendererAPI* GetRenderer()
     {
-        return RendererAPIManager::GetInstance().GetRenderer();
+        return s_ActiveRenderer;
+    }
+
+    GraphicsContext* GetGraphicsContextFromRenderer()
+    {
+        return s_ActiveContext;
     }
 
     Result<void> InitializeRenderer(GraphicsAPI api, GraphicsContext* context)
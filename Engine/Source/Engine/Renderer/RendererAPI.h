@@ -1,36 +1,89 @@
 #pragma once
 
+#include "FrameArena.h"
 #include "GraphicsContext.h"
 #include "RenderCommand.h"
 #include "RenderTypes.h"
 #include "Core/Debug/ErrorCodes.h"
 
+#include <unordered_map>
+
 namespace Vortex
 {
     // Enums moved to RenderTypes.h
+
+    // Render-state blocks packed into single 64-bit keys. The backend enum
+    // values the setters receive all fit in 16 bits, so each block packs
+    // into the low bits of a uint64_t and the redundancy check (and any
+    // sorting of draws by state) becomes one scalar compare instead of a
+    // field-by-field walk. The all-ones value is reserved as the "unknown"
+    // sentinel for the front-end cache; no packed state can produce it.
+
+    struct PackedDepthState  { uint64_t Bits = 0; };
+    struct PackedBlendState  { uint64_t Bits = 0; };
+    struct PackedCullState   { uint64_t Bits = 0; };
+
+    inline PackedDepthState PackDepthState(bool testEnabled, bool writeEnabled, uint32_t compareFunc)
+    {
+        return { (uint64_t(testEnabled) << 17) | (uint64_t(writeEnabled) << 16) | (compareFunc & 0xFFFFu) };
+    }
+
+    inline PackedBlendState PackBlendState(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp)
+    {
+        return { (uint64_t(enabled) << 48) | (uint64_t(blendOp & 0xFFFFu) << 32) |
+                 (uint64_t(dstFactor & 0xFFFFu) << 16) | (srcFactor & 0xFFFFu) };
+    }
+
+    inline PackedCullState PackCullState(uint32_t cullMode, uint32_t frontFace)
+    {
+        return { (uint64_t(frontFace & 0xFFFFu) << 16) | (cullMode & 0xFFFFu) };
+    }
+
     /**
      * @brief Abstract renderer API interface
-     * 
+     *
      * This class defines the interface that all rendering API implementations must provide.
      * It serves as the bridge between the engine's high-level rendering systems and the
      * low-level graphics API calls (OpenGL, DirectX, Vulkan, etc.)
+     *
+     * Deliberately a virtual interface rather than a CRTP/compile-time backend:
+     * the active API is chosen at runtime from the engine config
+     * ("Renderer.API"), and per frame these methods are called a few thousand
+     * times at most — the indirect call is noise next to the driver work each
+     * method performs. LTO can still devirtualize when one backend is compiled.
+     *
+     * Object handles are the backend's own 32-bit names (GL object IDs),
+     * passed through untranslated. Typed 64-bit packed handles with
+     * generation counters — the usual multi-backend design, and what a
+     * Vulkan backend would need since its objects are 64-bit — were
+     * considered and deferred: with one backend whose names are already
+     * 32-bit integers, a handle table would add an indirection on every call
+     * and a lookup structure to keep coherent, for validation we currently
+     * get from GL's own name checks. If a second backend lands, introduce
+     * the typed handle at the GenBuffers/GenTextures boundary first so call
+     * sites migrate type-by-type instead of in one flag-day change.
      */
     class RendererAPI
     {
     public:
         virtual ~RendererAPI() = default;
 
+        // These identity/status queries are deliberately non-virtual: they are
+        // called from per-frame logging and validation paths, and the values
+        // never change after construction (or, for IsInitialized, outside
+        // Initialize/Shutdown), so an indirect call buys nothing.
+
         /**
          * @brief Get the graphics API type for this renderer
          * @return The graphics API enum
          */
-        virtual GraphicsAPI GetAPI() const = 0;
+        [[nodiscard]] GraphicsAPI GetAPI() const noexcept { return m_API; }
 
         /**
          * @brief Get a human-readable name for this renderer
          * @return Renderer name string
          */
-        virtual const char* GetName() const = 0;
+        [[nodiscard]] const char* GetName() const noexcept { return m_Name; }
 
         // ============================================================================
         // INITIALIZATION AND CLEANUP
@@ -53,7 +106,7 @@ namespace Vortex
          * @brief Check if the renderer is currently initialized
          * @return True if initialized, false otherwise
          */
-        virtual bool IsInitialized() const = 0;
+        [[nodiscard]] bool IsInitialized() const noexcept { return m_Initialized; }
 
         // ============================================================================
         // BASIC RENDERING OPERATIONS
@@ -67,7 +120,10 @@ namespace Vortex
          * @param stencil Clear stencil value
          * @return Success/failure result
          */
-        virtual Result<void> Clear(uint32_t flags, const glm::vec4& color, float depth, int32_t stencil) = 0;
+        // vec4 is passed by value: four floats travel in XMM registers on both
+        // x64 calling conventions, where a reference would force a stack
+        // spill and a reload in the callee
+        virtual Result<void> Clear(uint32_t flags, glm::vec4 color, float depth, int32_t stencil) = 0;
 
         /**
          * @brief Set the viewport
@@ -135,6 +191,15 @@ namespace Vortex
          */
         virtual Result<void> BindVertexBuffer(uint32_t binding, uint32_t buffer, uint64_t offset, uint64_t stride) = 0;
 
+        /**
+         * @brief Bind a contiguous range of vertex buffer binding points in one call
+         *
+         * Multi-bind counterpart to BindVertexBuffer: one driver call for N
+         * bindings instead of N. A null entry in buffers unbinds that point.
+         */
+        virtual Result<void> BindVertexBuffers(uint32_t first, uint32_t count, const uint32_t* buffers,
+                                               const uint64_t* offsets, const uint64_t* strides) = 0;
+
         /**
          * @brief Bind an index buffer
          * @param buffer Buffer ID
@@ -170,11 +235,99 @@ namespace Vortex
         /** Unmap the currently bound buffer */
         virtual Result<void> UnmapBuffer(uint32_t target) = 0;
 
+        /** Flush a written range of a buffer mapped with MapFlushExplicitBit */
+        virtual Result<void> FlushMappedBufferRange(uint32_t target, uint64_t offset, uint64_t length) = 0;
+
         /**
          * @brief Bind a buffer object to an indexed binding point (e.g., UBO)
          */
         virtual Result<void> BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) = 0;
 
+        /**
+         * @brief Bind a contiguous range of indexed binding points in one call
+         *
+         * Multi-bind counterpart to BindBufferBase; a zero entry unbinds that index.
+         */
+        virtual Result<void> BindBuffersBase(uint32_t target, uint32_t first, uint32_t count,
+                                             const uint32_t* buffers) = 0;
+
+        /**
+         * @brief Bind a sub-range of a buffer to an indexed binding point
+         *
+         * Lets a persistent-mapped ring expose one section at a time as a UBO/SSBO;
+         * offset must respect the API's indexed-binding alignment rules.
+         */
+        virtual Result<void> BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer,
+                                             uint64_t offset, uint64_t size) = 0;
+
+        /**
+         * @brief Copy a byte range between the buffers bound to two targets (GPU-side, no CPU roundtrip)
+         */
+        virtual Result<void> CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, uint64_t readOffset, uint64_t writeOffset, uint64_t size) = 0;
+
+        /**
+         * @brief Draw non-indexed geometry with parameters sourced from the bound indirect buffer
+         * @param primitiveTopology Primitive topology to use
+         * @param offset Byte offset of the draw command within the indirect buffer
+         */
+        virtual Result<void> DrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset) = 0;
+
+        /**
+         * @brief Draw indexed geometry with parameters sourced from the bound indirect buffer
+         *
+         * Index type comes from the currently bound index buffer, as with DrawIndexed.
+         * @param primitiveTopology Primitive topology to use
+         * @param offset Byte offset of the draw command within the indirect buffer
+         */
+        virtual Result<void> DrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset) = 0;
+
+        /**
+         * @brief Issue drawCount non-indexed indirect draws from the bound indirect buffer
+         * @param primitiveTopology Primitive topology to use
+         * @param offset Byte offset of the first draw command within the indirect buffer
+         * @param drawCount Number of consecutive draw commands to execute
+         * @param stride Byte stride between commands (0 = tightly packed)
+         */
+        virtual Result<void> MultiDrawArraysIndirect(uint32_t primitiveTopology, uint64_t offset,
+                                                     uint32_t drawCount, uint32_t stride) = 0;
+
+        /**
+         * @brief Issue drawCount indexed indirect draws from the bound indirect buffer
+         *
+         * Index type comes from the currently bound index buffer, as with DrawIndexed.
+         */
+        virtual Result<void> MultiDrawElementsIndirect(uint32_t primitiveTopology, uint64_t offset,
+                                                       uint32_t drawCount, uint32_t stride) = 0;
+
+        /**
+         * @brief Indexed multi-draw whose draw count is read by the GPU
+         *
+         * Like MultiDrawElementsIndirect, but the number of draws comes from
+         * the buffer bound to BufferTarget::ParameterBuffer instead of a CPU
+         * argument, capped at maxDrawCount. This is the consumer side of
+         * GPU-driven rendering: a compute pass (DispatchCompute) culls and
+         * writes both the draw list and the count without a CPU round-trip.
+         * @param primitiveTopology Primitive topology to use
+         * @param offset Byte offset of the first draw command within the indirect buffer
+         * @param drawCountOffset Byte offset of the GLuint draw count within the parameter buffer
+         * @param maxDrawCount Upper bound on draws; sized to the indirect buffer capacity
+         * @param stride Byte stride between commands (0 = tightly packed)
+         */
+        virtual Result<void> MultiDrawElementsIndirectCount(uint32_t primitiveTopology, uint64_t offset,
+                                                            uint64_t drawCountOffset, uint32_t maxDrawCount,
+                                                            uint32_t stride) = 0;
+
+        /**
+         * @brief Dispatch a compute workload with the currently bound compute program
+         */
+        virtual Result<void> DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) = 0;
+
+        /**
+         * @brief Insert a memory barrier ordering shader writes against later operations
+         * @param barrierBits MemoryBarrierFlags bit combination
+         */
+        virtual Result<void> MemoryBarrier(uint32_t barrierBits) = 0;
+
         // ============================================================================
         // OBJECT LIFETIME (GEN/DELETE)
         // ============================================================================
@@ -225,19 +378,87 @@ namespace Vortex
          */
         virtual Result<void> EnableVertexAttribArray(uint32_t index, bool enabled) = 0;
 
+        // Separated vertex format (set once per layout) from buffer binding
+        // (cheap, per draw). Prefer these over the combined VertexAttribPointer
+        // calls when the backend supports them; rebinding a buffer then costs
+        // one BindVertexBuffer instead of re-describing every attribute.
+
+        /**
+         * @brief Describe a float attribute's format, independent of its source buffer
+         */
+        virtual Result<void> VertexAttribFormat(uint32_t index, int32_t size, uint32_t type,
+                                                bool normalized, uint32_t relativeOffset) = 0;
+
+        /** Integer attribute format (no normalization) */
+        virtual Result<void> VertexAttribIFormat(uint32_t index, int32_t size, uint32_t type,
+                                                 uint32_t relativeOffset) = 0;
+
+        /** Associate an attribute index with a vertex buffer binding slot */
+        virtual Result<void> VertexAttribBinding(uint32_t attribIndex, uint32_t bindingIndex) = 0;
+
+        /** Instance divisor for a vertex buffer binding slot (0 = per vertex) */
+        virtual Result<void> VertexBindingDivisor(uint32_t bindingIndex, uint32_t divisor) = 0;
+
+        /**
+         * @brief Bake a vertex layout into a backend layout object
+         * @param attribs Attribute descriptions
+         * @param count Number of attributes
+         * @return Layout handle (a VAO on OpenGL), bindable via BindVertexArray
+         *
+         * A shipped title uses a small fixed set of vertex formats; baking
+         * each one once replaces the N format/binding/enable calls per setup
+         * with a single bind of the returned handle.
+         */
+        virtual Result<uint32_t> CreateVertexLayout(const VertexAttrib* attribs, uint32_t count) = 0;
+
+        /**
+         * @brief Create-or-lookup front end over CreateVertexLayout
+         * @param attribs Attribute descriptions
+         * @param count Number of attributes
+         * @return Layout handle, shared between callers with identical layouts
+         *
+         * Hashes the description and reuses a previously baked layout on a
+         * match, so dynamically assembled layouts (materials, importers)
+         * converge on one backend object per distinct format.
+         */
+        Result<uint32_t> GetOrCreateVertexLayout(const VertexAttrib* attribs, uint32_t count);
+
+        // Like the render state setters further down, the frequent binds are
+        // non-virtual wrappers over a front-end cache: a rebind of the
+        // already-bound object returns before the virtual call. Slots beyond
+        // the cached texture range always forward. The multi-bind entry
+        // points conservatively invalidate the slots they touch rather than
+        // trying to mirror them.
+
         /**
          * @brief Bind a vertex array object
          * @param vao Vertex array object ID
          * @return Success/failure result
          */
-        virtual Result<void> BindVertexArray(uint32_t vao) = 0;
+        Result<void> BindVertexArray(uint32_t vao)
+        {
+            if (m_CachedVAO.Valid && m_CachedVAO.Value == vao)
+            {
+                return Result<void>();
+            }
+            m_CachedVAO = { true, vao };
+            return BindVertexArrayImpl(vao);
+        }
 
         /**
          * @brief Bind a shader program
          * @param program Program ID
          * @return Success/failure result
          */
-        virtual Result<void> BindShader(uint32_t program) = 0;
+        Result<void> BindShader(uint32_t program)
+        {
+            if (m_CachedProgram.Valid && m_CachedProgram.Value == program)
+            {
+                return Result<void>();
+            }
+            m_CachedProgram = { true, program };
+            return BindShaderImpl(program);
+        }
 
         /**
          * @brief Bind a texture
@@ -246,7 +467,64 @@ namespace Vortex
          * @param sampler Sampler ID (optional)
          * @return Success/failure result
          */
-        virtual Result<void> BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler) = 0;
+        Result<void> BindTexture(uint32_t slot, uint32_t texture, uint32_t sampler)
+        {
+            if (slot < kCachedTextureSlots)
+            {
+                auto& cached = m_CachedTextures[slot];
+                if (cached.Valid && cached.Texture == texture && cached.Sampler == sampler)
+                {
+                    return Result<void>();
+                }
+                cached = { true, texture, sampler };
+            }
+            return BindTextureImpl(slot, texture, sampler);
+        }
+
+        /**
+         * @brief Bind a contiguous range of texture units in one call
+         *
+         * Multi-bind counterpart to BindTexture: N units for one driver call.
+         * Each texture binds to its own target with its own sampler state; a
+         * zero entry unbinds that unit.
+         */
+        Result<void> BindTextures(uint32_t firstSlot, uint32_t count, const uint32_t* textures)
+        {
+            InvalidateTextureSlots(firstSlot, count);
+            return BindTexturesImpl(firstSlot, count, textures);
+        }
+
+        /**
+         * @brief Bind sampler objects to a contiguous range of texture units in one call
+         *
+         * Pairs with BindTextures for fully batched material binding; a zero
+         * entry restores the texture's own sampler state for that unit.
+         */
+        Result<void> BindSamplers(uint32_t firstSlot, uint32_t count, const uint32_t* samplers)
+        {
+            InvalidateTextureSlots(firstSlot, count);
+            return BindSamplersImpl(firstSlot, count, samplers);
+        }
+
+        /**
+         * @brief Query a bindless handle for a texture
+         * @param texture Texture object
+         * @param sampler Sampler object, or 0 to use the texture's own sampling state
+         * @param outHandle Receives the 64-bit bindless handle
+         *
+         * Bindless alternative to the slot model: shaders address the texture
+         * by handle, so per-draw BindTexture calls disappear. Handles must be
+         * made resident before use. Fails with NotImplemented where bindless
+         * textures are unsupported; callers fall back to slot binding.
+         */
+        virtual Result<void> GetTextureHandle(uint32_t texture, uint32_t sampler, uint64_t* outHandle) = 0;
+
+        /**
+         * @brief Make a bindless texture handle resident (or evict it)
+         * @param handle Handle obtained from GetTextureHandle
+         * @param resident True to make resident, false to evict
+         */
+        virtual Result<void> MakeTextureHandleResident(uint64_t handle, bool resident) = 0;
 
         // ============================================================================
         // TEXTURE OPERATIONS
@@ -274,6 +552,27 @@ namespace Vortex
                                         uint32_t width, uint32_t height, uint32_t format, uint32_t type,
                                         const void* data) = 0;
 
+        /**
+         * @brief Update a texture region from a staging buffer without a CPU-side copy
+         * @param texture Texture object to update
+         * @param level Mip level
+         * @param x,y Region origin
+         * @param width,height Region size
+         * @param format Pixel format of the staged data
+         * @param type Pixel data type of the staged data
+         * @param stagingBuffer Buffer holding the pixel data (e.g. a persistent-mapped ring)
+         * @param stagingOffset Byte offset of the pixels within stagingBuffer
+         * @param outFence Optional; receives a fence signaled when the transfer completes
+         *
+         * Async counterpart to TexImage2D for streaming: the transfer runs as
+         * a GPU-side DMA from the staging buffer, and the caller polls the
+         * fence with ClientWaitSync before reusing the staged range instead of
+         * blocking in the upload call.
+         */
+        virtual Result<void> TexSubImage2DAsync(uint32_t texture, int32_t level, uint32_t x, uint32_t y,
+                                                uint32_t width, uint32_t height, uint32_t format, uint32_t type,
+                                                uint32_t stagingBuffer, uint64_t stagingOffset, uint64_t* outFence) = 0;
+
         /**
          * @brief Set integer parameter for the texture target
          */
@@ -322,10 +621,64 @@ namespace Vortex
          */
         virtual Result<void> SetDrawBuffers(uint32_t count, const uint32_t* attachments) = 0;
 
+        /**
+         * @brief Clear attachments of a framebuffer without binding it
+         * @param fbo Framebuffer object (0 for the default framebuffer)
+         * @param colorCount Number of entries in colors
+         * @param colors Per-color-attachment clear values
+         * @param clearDepthStencil Whether to also clear depth and stencil
+         * @param depth Clear depth value
+         * @param stencil Clear stencil value
+         *
+         * DSA counterpart to Clear for MRT targets: a deferred G-buffer clears
+         * all attachments in one call with no bind/restore round-trip.
+         */
+        virtual Result<void> ClearNamedFramebuffer(uint32_t fbo, uint32_t colorCount,
+                                                   const ClearAttachmentDesc* colors,
+                                                   bool clearDepthStencil, float depth, int32_t stencil) = 0;
+
+        /**
+         * @brief Tell the driver the listed attachments' contents may be discarded
+         * @param target Framebuffer target (FramebufferTarget values)
+         * @param count Number of entries in attachments
+         * @param attachments Array of FramebufferAttachment values
+         *
+         * Purely a hint: backends without invalidation support treat it as a
+         * no-op. Issued at render-pass end for StoreOp::DontCare attachments so
+         * tiled GPUs can skip the tile write-back.
+         */
+        virtual Result<void> InvalidateFramebuffer(uint32_t target, uint32_t count, const uint32_t* attachments) = 0;
+
         // ============================================================================
         // RENDER STATE
         // ============================================================================
 
+        // The three state setters are called once per material/pass and are
+        // overwhelmingly redundant, so the public entry points are non-virtual
+        // wrappers that compare against a front-end cache and only reach the
+        // virtual backend implementation on an actual change. Each state block
+        // is held as one packed 64-bit key (see PackDepthState and friends
+        // above), so the redundancy check is a single scalar compare and the
+        // key doubles as a sort key for callers that order draws by state.
+        // Backends refresh the cache via InvalidateStateCache() when their
+        // real state may have diverged (init, lost context).
+
+        /**
+         * @brief Set depth testing state from a packed key
+         * @param state Key built by PackDepthState
+         * @return Success/failure result
+         */
+        Result<void> SetDepthState(PackedDepthState state)
+        {
+            if (m_CachedDepthKey == state.Bits)
+            {
+                return Result<void>();
+            }
+            m_CachedDepthKey = state.Bits;
+            return SetDepthStateImpl(((state.Bits >> 17) & 1u) != 0, ((state.Bits >> 16) & 1u) != 0,
+                                     uint32_t(state.Bits & 0xFFFFu));
+        }
+
         /**
          * @brief Set depth testing state
          * @param testEnabled Enable depth testing
@@ -333,7 +686,28 @@ namespace Vortex
          * @param compareFunc Depth comparison function
          * @return Success/failure result
          */
-        virtual Result<void> SetDepthState(bool testEnabled, bool writeEnabled, uint32_t compareFunc) = 0;
+        Result<void> SetDepthState(bool testEnabled, bool writeEnabled, uint32_t compareFunc)
+        {
+            return SetDepthState(PackDepthState(testEnabled, writeEnabled, compareFunc));
+        }
+
+        /**
+         * @brief Set blending state from a packed key
+         * @param state Key built by PackBlendState
+         * @return Success/failure result
+         */
+        Result<void> SetBlendState(PackedBlendState state)
+        {
+            if (m_CachedBlendKey == state.Bits)
+            {
+                return Result<void>();
+            }
+            m_CachedBlendKey = state.Bits;
+            return SetBlendStateImpl(((state.Bits >> 48) & 1u) != 0,
+                                     uint32_t(state.Bits & 0xFFFFu),
+                                     uint32_t((state.Bits >> 16) & 0xFFFFu),
+                                     uint32_t((state.Bits >> 32) & 0xFFFFu));
+        }
 
         /**
          * @brief Set blending state
@@ -343,7 +717,26 @@ namespace Vortex
          * @param blendOp Blend operation
          * @return Success/failure result
          */
-        virtual Result<void> SetBlendState(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp) = 0;
+        Result<void> SetBlendState(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp)
+        {
+            return SetBlendState(PackBlendState(enabled, srcFactor, dstFactor, blendOp));
+        }
+
+        /**
+         * @brief Set culling state from a packed key
+         * @param state Key built by PackCullState
+         * @return Success/failure result
+         */
+        Result<void> SetCullState(PackedCullState state)
+        {
+            if (m_CachedCullKey == state.Bits)
+            {
+                return Result<void>();
+            }
+            m_CachedCullKey = state.Bits;
+            return SetCullStateImpl(uint32_t(state.Bits & 0xFFFFu),
+                                    uint32_t((state.Bits >> 16) & 0xFFFFu));
+        }
 
         /**
          * @brief Set culling state
@@ -351,7 +744,10 @@ namespace Vortex
          * @param frontFace Front face winding order
          * @return Success/failure result
          */
-        virtual Result<void> SetCullState(uint32_t cullMode, uint32_t frontFace) = 0;
+        Result<void> SetCullState(uint32_t cullMode, uint32_t frontFace)
+        {
+            return SetCullState(PackCullState(cullMode, frontFace));
+        }
 
         // ============================================================================
         // SYNCHRONIZATION (optional)
@@ -370,10 +766,10 @@ namespace Vortex
 
         /**
          * @brief Push a debug group for profiling
-         * @param name Debug group name
+         * @param name Debug group name; a view so literal callers don't allocate
          * @return Success/failure result
          */
-        virtual Result<void> PushDebugGroup(const std::string& name) = 0;
+        virtual Result<void> PushDebugGroup(std::string_view name) = 0;
 
         /**
          * @brief Pop a debug group
@@ -388,7 +784,17 @@ namespace Vortex
         virtual std::string GetDebugInfo() const = 0;
 
         // Public read-only access to underlying graphics context
-        GraphicsContext* GetContext() const { return m_GraphicsContext; }
+        [[nodiscard]] GraphicsContext* GetContext() const noexcept { return m_GraphicsContext; }
+
+        /**
+         * @brief Per-frame linear allocator for transient render strings
+         * @return The renderer's frame arena
+         *
+         * Reset once per frame by the render system after command
+         * processing; allocations (debug-group names and the like) are
+         * valid until then and cost one pointer bump instead of a malloc.
+         */
+        FrameArena& GetFrameArena() { return m_FrameArena; }
 
         // ============================================================================
         // FACTORY METHODS
@@ -399,18 +805,101 @@ namespace Vortex
          * @param api The graphics API to create a renderer for
          * @return Unique pointer to the renderer API, nullptr on failure
          */
-        static std::unique_ptr<RendererAPI> Create(GraphicsAPI api);
+        [[nodiscard]] static std::unique_ptr<RendererAPI> Create(GraphicsAPI api);
 
         /**
          * @brief Create a renderer API for the current/default graphics API
          * @return Unique pointer to the renderer API, nullptr on failure
          */
-        static std::unique_ptr<RendererAPI> Create();
+        [[nodiscard]] static std::unique_ptr<RendererAPI> Create();
 
     protected:
+        // Concrete backends supply their identity once; GetAPI/GetName read
+        // the stored values without a virtual call
+        RendererAPI(GraphicsAPI api, const char* name) : m_API(api), m_Name(name) {}
+
         // Provide derived classes a safe accessor to the active graphics context
         GraphicsContext* GetGraphicsContext() const { return m_GraphicsContext; }
         GraphicsContext* m_GraphicsContext = nullptr;
+
+        // Set by the backend's Initialize/Shutdown
+        bool m_Initialized = false;
+
+        // Backend implementations behind the state-delta cache above
+        virtual Result<void> SetDepthStateImpl(bool testEnabled, bool writeEnabled, uint32_t compareFunc) = 0;
+        virtual Result<void> SetBlendStateImpl(bool enabled, uint32_t srcFactor, uint32_t dstFactor, uint32_t blendOp) = 0;
+        virtual Result<void> SetCullStateImpl(uint32_t cullMode, uint32_t frontFace) = 0;
+
+        // Backend implementations behind the bind cache above
+        virtual Result<void> BindVertexArrayImpl(uint32_t vao) = 0;
+        virtual Result<void> BindShaderImpl(uint32_t program) = 0;
+        virtual Result<void> BindTextureImpl(uint32_t slot, uint32_t texture, uint32_t sampler) = 0;
+        virtual Result<void> BindTexturesImpl(uint32_t firstSlot, uint32_t count, const uint32_t* textures) = 0;
+        virtual Result<void> BindSamplersImpl(uint32_t firstSlot, uint32_t count, const uint32_t* samplers) = 0;
+
+        /** Drop the layout-dedup cache; backends call this from Shutdown
+            after deleting the baked layout objects it refers to */
+        void ClearVertexLayoutCache() { m_VertexLayoutCache.clear(); }
+
+        /** Drop the cached state so the next setter calls reach the backend */
+        void InvalidateStateCache()
+        {
+            m_CachedDepthKey = kUnknownStateKey;
+            m_CachedBlendKey = kUnknownStateKey;
+            m_CachedCullKey = kUnknownStateKey;
+            m_CachedVAO.Valid = false;
+            m_CachedProgram.Valid = false;
+            for (auto& cached : m_CachedTextures)
+            {
+                cached.Valid = false;
+            }
+        }
+
+    private:
+        // No packed state produces the all-ones key (the pack helpers leave
+        // the high bits clear), so it serves as the "unknown" cache value
+        static constexpr uint64_t kUnknownStateKey = ~0ull;
+
+        struct CachedBinding
+        {
+            bool Valid = false;
+            uint32_t Value = 0;
+        };
+        struct CachedTextureBinding
+        {
+            bool Valid = false;
+            uint32_t Texture = 0;
+            uint32_t Sampler = 0;
+        };
+        static constexpr uint32_t kCachedTextureSlots = 32;
+
+        void InvalidateTextureSlots(uint32_t firstSlot, uint32_t count)
+        {
+            for (uint32_t i = 0; i < count && firstSlot + i < kCachedTextureSlots; ++i)
+            {
+                m_CachedTextures[firstSlot + i].Valid = false;
+            }
+        }
+
+        uint64_t m_CachedDepthKey = kUnknownStateKey;
+        uint64_t m_CachedBlendKey = kUnknownStateKey;
+        uint64_t m_CachedCullKey = kUnknownStateKey;
+        CachedBinding m_CachedVAO;
+        CachedBinding m_CachedProgram;
+        CachedTextureBinding m_CachedTextures[kCachedTextureSlots];
+
+        // Layout-description hash -> baked layout handle (see
+        // GetOrCreateVertexLayout); survives InvalidateStateCache because
+        // it maps to objects, not mutable state
+        // Keyed by the FNV-1a hash of the layout description, so the
+        // identity hasher makes each probe a single load
+        std::unordered_map<uint64_t, uint32_t, IdentityU64Hash> m_VertexLayoutCache;
+
+        // Transient string storage, reset each frame (see GetFrameArena)
+        FrameArena m_FrameArena;
+
+        GraphicsAPI m_API = GraphicsAPI::None;
+        const char* m_Name = "None";
     };
 
     /**
@@ -425,8 +914,13 @@ namespace Vortex
         /**
          * @brief Get the singleton instance
          * @return Reference to the manager instance
+         *
+         * The instance is an eagerly-defined static member rather than a
+         * function-local static: the members are constant-initialized, so
+         * there is no init-order hazard, and callers skip the thread-safe
+         * magic-statics guard (atomic load + branch) on every access.
          */
-        static RendererAPIManager& GetInstance();
+        static RendererAPIManager& GetInstance() { return s_Instance; }
 
         /**
          * @brief Initialize the renderer API manager
@@ -467,6 +961,8 @@ namespace Vortex
         RendererAPIManager(const RendererAPIManager&) = delete;
         RendererAPIManager& operator=(const RendererAPIManager&) = delete;
 
+        static RendererAPIManager s_Instance;
+
         std::unique_ptr<RendererAPI> m_RendererAPI;
         GraphicsAPI m_CurrentAPI = GraphicsAPI::None;
     };
@@ -481,12 +977,10 @@ namespace Vortex
      */
     RendererAPI* GetRenderer();
 
-    // Helper to expose GraphicsContext from renderer for systems that need caps
-    inline GraphicsContext* GetGraphicsContextFromRenderer()
-    {
-        if (auto* r = GetRenderer()) return r->GetContext();
-        return nullptr;
-    }
+    // Helper to expose GraphicsContext from renderer for systems that need
+    // caps; returns a pointer cached at renderer init so callers don't chase
+    // renderer->context on every query
+    GraphicsContext* GetGraphicsContextFromRenderer();
 
     /**
      * @brief Initialize the global renderer API
@@ -7,10 +7,42 @@
 
 namespace Vortex
 {
-    bool GPUShader::HasStage(ShaderStage stage) const
+    Result<void> GPUShader::SetUniforms(const UniformUpdate* updates, size_t count)
     {
-        uint32_t stageFlag = 1u << static_cast<uint32_t>(stage);
-        return (m_StageFlags & stageFlag) != 0;
+        // Bracketing in a uniform block pass lets block members coalesce
+        // into one upload even through the generic per-entry dispatch
+        BeginUniformBlock();
+
+        Result<void> firstError = Result<void>();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const UniformUpdate& update = updates[i];
+            if (!update.Handle.IsValid())
+                continue;
+
+            Result<void> result;
+            switch (update.Type)
+            {
+                case ShaderDataType::Int:   result = SetUniform(update.Handle, update.IntValue); break;
+                case ShaderDataType::Float: result = SetUniform(update.Handle, update.FloatValue); break;
+                case ShaderDataType::Vec2:  result = SetUniform(update.Handle, update.Vec2Value); break;
+                case ShaderDataType::Vec3:  result = SetUniform(update.Handle, update.Vec3Value); break;
+                case ShaderDataType::Vec4:  result = SetUniform(update.Handle, update.Vec4Value); break;
+                case ShaderDataType::Mat3:  result = SetUniform(update.Handle, update.Mat3Value); break;
+                case ShaderDataType::Mat4:  result = SetUniform(update.Handle, update.Mat4Value); break;
+                default:
+                    result = Result<void>(ErrorCode::InvalidParameter, "Unsupported uniform update type");
+                    break;
+            }
+
+            if (result.IsError() && !firstError.IsError())
+                firstError = std::move(result);
+        }
+
+        Result<void> flush = EndUniformBlock();
+        if (flush.IsError() && !firstError.IsError())
+            firstError = std::move(flush);
+        return firstError;
     }
 
     void GPUShader::SetMetadata(const std::string& name, 
@@ -22,30 +54,45 @@ namespace Vortex
         m_StageFlags = stageFlags;
     }
 
-    std::unique_ptr<GPUShader> GPUShader::Create(const std::string& name)
+    namespace
+    {
+        // Factories return a raw pointer; GPUShader::Create adopts it into a
+        // ShaderRef (which takes the first intrusive reference)
+        using ShaderFactoryFn = GPUShader* (*)(const std::string&);
+
+        GPUShader* CreateOpenGLShader(const std::string& name)
+        {
+            return new OpenGLShader(name);
+        }
+
+        // Indexed by GraphicsAPI like the RendererAPI factory table; APIs
+        // without a shader backend leave a null slot. TODO: fill in the
+        // Vulkan/D3D slots when those shader backends land.
+        constexpr ShaderFactoryFn kShaderFactories[] =
+        {
+            /* None      */ nullptr,
+            /* OpenGL    */ &CreateOpenGLShader,
+            /* DirectX11 */ nullptr,
+            /* DirectX12 */ nullptr,
+            /* Vulkan    */ nullptr,
+            /* Metal     */ nullptr
+        };
+        static_assert(sizeof(kShaderFactories) / sizeof(kShaderFactories[0]) ==
+                      static_cast<size_t>(GraphicsAPI::Metal) + 1,
+                      "kShaderFactories must cover every GraphicsAPI value");
+    }
+
+    ShaderRef GPUShader::Create(const std::string& name)
     {
-        // Get current graphics API and create appropriate shader implementation
-        auto currentAPI = GetGraphicsAPI();
-        
-        switch (currentAPI)
+        // A single table load and indirect call; asset-loading paths create
+        // shaders in bulk and the active API never changes at runtime
+        const ShaderFactoryFn factory = kShaderFactories[static_cast<size_t>(GetGraphicsAPI())];
+        VX_CORE_ASSERT(factory, "No shader backend for the active graphics API!");
+        if (!factory)
         {
-            case GraphicsAPI::OpenGL:
-                return std::make_unique<OpenGLShader>(name);
-            case GraphicsAPI::Vulkan:
-                // TODO: Implement VulkanShader when we add Vulkan support
-                VX_CORE_ASSERT(false, "Vulkan shaders not yet implemented!");
-                return nullptr;
-		    case GraphicsAPI::DirectX11:
-			    VX_CORE_ASSERT(false, "DirectX11 shaders not yet implemented!");
-			    return nullptr;
-            case GraphicsAPI::DirectX12:
-                // TODO: Implement D3D12Shader when we add D3D12 support
-                VX_CORE_ASSERT(false, "D3D12 shaders not yet implemented!");
-                return nullptr;
-            default:
-                VX_CORE_ASSERT(false, "Unknown graphics API!");
             return nullptr;
         }
+        return ShaderRef(factory(name));
     }
 
 } // namespace Vortex
\ No newline at end of file
@@ -4,15 +4,84 @@
 #include "Core/Debug/ErrorCodes.h"
 #include "Core/Common/UUID.h"
 
+#include <atomic>
+#include <cstddef>
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 namespace Vortex
 {
+    /**
+     * @brief Pre-resolved uniform identifier
+     *
+     * Resolved once from a name via GPUShader::GetUniformHandle — typically
+     * when a material or pass is built — and then passed to the handle-based
+     * SetUniform overloads. Per-draw uniform sets become an array subscript
+     * in the backend instead of a string hash and map probe.
+     */
+    struct UniformHandle
+    {
+        static constexpr uint32_t Invalid = 0xFFFFFFFFu;
+
+        uint32_t Index = Invalid;
+
+        bool IsValid() const { return Index != Invalid; }
+    };
+
+    /**
+     * @brief One entry of a batched uniform update
+     *
+     * Pairs a pre-resolved UniformHandle with a tagged value; only the
+     * union member matching Type is read. Fill an array of these and hand
+     * it to GPUShader::SetUniforms (or the ShaderManager wrapper) so a
+     * material's whole uniform push crosses the virtual boundary once.
+     */
+    struct UniformUpdate
+    {
+        UniformHandle Handle;
+        ShaderDataType Type = ShaderDataType::Float;
+        union
+        {
+            int IntValue;
+            float FloatValue;
+            glm::vec2 Vec2Value;
+            glm::vec3 Vec3Value;
+            glm::vec4 Vec4Value;
+            glm::mat3 Mat3Value;
+            glm::mat4 Mat4Value;
+        };
+
+        UniformUpdate() : FloatValue(0.0f) {}
+        UniformUpdate(UniformHandle handle, int value)              : Handle(handle), Type(ShaderDataType::Int),   IntValue(value) {}
+        UniformUpdate(UniformHandle handle, float value)            : Handle(handle), Type(ShaderDataType::Float), FloatValue(value) {}
+        UniformUpdate(UniformHandle handle, const glm::vec2& value) : Handle(handle), Type(ShaderDataType::Vec2),  Vec2Value(value) {}
+        UniformUpdate(UniformHandle handle, const glm::vec3& value) : Handle(handle), Type(ShaderDataType::Vec3),  Vec3Value(value) {}
+        UniformUpdate(UniformHandle handle, const glm::vec4& value) : Handle(handle), Type(ShaderDataType::Vec4),  Vec4Value(value) {}
+        UniformUpdate(UniformHandle handle, const glm::mat3& value) : Handle(handle), Type(ShaderDataType::Mat3),  Mat3Value(value) {}
+        UniformUpdate(UniformHandle handle, const glm::mat4& value) : Handle(handle), Type(ShaderDataType::Mat4),  Mat4Value(value) {}
+    };
+
+    class ShaderRef;
+
+    /**
+     * @brief One stage's SPIR-V words for GPUShader::Create
+     *
+     * Non-owning view; the words only need to stay alive for the duration
+     * of the Create call, so callers point straight at their compile
+     * results instead of copying them into a container.
+     */
+    struct ShaderStageBinary
+    {
+        ShaderStage Stage = ShaderStage::Vertex;
+        const uint32_t* Words = nullptr;
+        size_t WordCount = 0;
+    };
+
     /**
      * @brief Render API agnostic shader interface
-     * 
+     *
      * Represents a compiled shader program that can be bound for rendering.
      * Implementations handle the specifics for each graphics API (OpenGL, Vulkan, D3D12).
      */
@@ -22,52 +91,83 @@ namespace Vortex
         GPUShader() = default;
         virtual ~GPUShader() = default;
 
-        // Non-copyable, moveable
+        // Non-copyable, non-moveable: the intrusive reference count is tied
+        // to this object's identity and must not travel to another instance
         GPUShader(const GPUShader&) = delete;
         GPUShader& operator=(const GPUShader&) = delete;
-        GPUShader(GPUShader&&) = default;
-        GPUShader& operator=(GPUShader&&) = default;
+        GPUShader(GPUShader&&) = delete;
+        GPUShader& operator=(GPUShader&&) = delete;
+
+        // The virtuals are declared hot-first on purpose: declaration order
+        // is vtable slot order, so the entry points the draw loop hits every
+        // frame (Bind, the handle setters, the block staging pair) share the
+        // first cache lines of the vtable, while load-time and debug entry
+        // points sit after them. Keep new virtuals in the section matching
+        // their call frequency.
 
         // ============================================================================
-        // SHADER LIFECYCLE
+        // SHADER BINDING (hot)
         // ============================================================================
 
         /**
-         * @brief Create shader from compiled SPIR-V bytecode
-         * @param shaders Map of shader stages to compiled SPIR-V
-         * @param reflection Combined reflection data for all stages
-         * @return Success/failure result
+         * @brief Bind shader for rendering
          */
-        virtual Result<void> Create(const std::unordered_map<ShaderStage, std::vector<uint32_t>>& shaders,
-                                   const ShaderReflectionData& reflection) = 0;
+        virtual void Bind() = 0;
 
         /**
-         * @brief Destroy shader and release GPU resources
+         * @brief Unbind shader
          */
-        virtual void Destroy() = 0;
+        virtual void Unbind() = 0;
 
         /**
-         * @brief Check if shader is valid and ready to use
-         * @return True if valid, false otherwise
+         * @brief Hot-path uniform setters taking a pre-resolved handle
+         *
+         * Same semantics as the string overloads without the per-call name
+         * lookup; invalid handles fail with ResourceNotFound.
          */
-        virtual bool IsValid() const = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, int value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, float value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, const glm::vec2& value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, const glm::vec3& value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, const glm::vec4& value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, const glm::mat3& value) = 0;
+        virtual Result<void> SetUniform(UniformHandle handle, const glm::mat4& value) = 0;
 
-        // ============================================================================
-        // SHADER BINDING
-        // ============================================================================
+        /**
+         * @brief Apply a batch of pre-resolved uniform updates
+         *
+         * One virtual call for a material's whole uniform push. The base
+         * implementation brackets the batch in Begin/EndUniformBlock so
+         * block members coalesce into a single upload, and dispatches each
+         * entry to the matching handle setter; backends can override with
+         * a tighter loop. Entries with an invalid handle are skipped; the
+         * first per-entry failure is returned after applying the rest.
+         * @param updates Pointer to the first update
+         * @param count Number of updates
+         * @return Success/failure result
+         */
+        virtual Result<void> SetUniforms(const UniformUpdate* updates, size_t count);
 
         /**
-         * @brief Bind shader for rendering
+         * @brief Start accumulating uniform sets into CPU-side staging
+         *
+         * Between BeginUniformBlock and EndUniformBlock, SetUniform calls for
+         * members of reflected uniform blocks become memcpys into a staging
+         * buffer at the member's reflected offset instead of individual
+         * driver calls. EndUniformBlock uploads each block's coalesced dirty
+         * range with a single buffer update, so N per-draw uniform sets cost
+         * one upload per block. Uniforms outside any block fall through to
+         * the immediate path unchanged.
          */
-        virtual void Bind() = 0;
+        virtual Result<void> BeginUniformBlock() = 0;
 
         /**
-         * @brief Unbind shader
+         * @brief Stop accumulating and flush staged uniform data
          */
-        virtual void Unbind() = 0;
+        virtual Result<void> EndUniformBlock() = 0;
 
         // ============================================================================
-        // UNIFORM MANAGEMENT
+        // UNIFORM MANAGEMENT (warm: string-keyed paths)
         // ============================================================================
 
         /**
@@ -90,6 +190,16 @@ namespace Vortex
         virtual Result<void> SetUniform(const std::string& name, const glm::mat3& value) = 0;
         virtual Result<void> SetUniform(const std::string& name, const glm::mat4& value) = 0;
 
+        /**
+         * @brief Resolve a uniform name to a handle
+         *
+         * Resolution (and the warning for unknown names) happens here, once,
+         * so the handle setters stay quiet on the hot path.
+         * @param name Uniform name
+         * @return Handle for the uniform, invalid if the name is unknown
+         */
+        virtual UniformHandle GetUniformHandle(const std::string& name) const = 0;
+
         /**
          * @brief Set texture uniform
          * @param name Texture uniform name
@@ -109,6 +219,32 @@ namespace Vortex
          */
         virtual Result<void> SetUniformBuffer(const std::string& name, uint32_t bufferId, uint32_t offset, uint32_t size) = 0;
 
+        // ============================================================================
+        // SHADER LIFECYCLE (cold)
+        // ============================================================================
+
+        /**
+         * @brief Create shader from compiled SPIR-V bytecode
+         * @param stages Stage binaries, at most one per stage; non-owning
+         *               views so callers avoid staging a map of copies
+         * @param count Number of stage binaries
+         * @param reflection Combined reflection data for all stages
+         * @return Success/failure result
+         */
+        virtual Result<void> Create(const ShaderStageBinary* stages, size_t count,
+                                   const ShaderReflectionData& reflection) = 0;
+
+        /**
+         * @brief Destroy shader and release GPU resources
+         */
+        virtual void Destroy() = 0;
+
+        /**
+         * @brief Check if shader is valid and ready to use
+         * @return True if valid, false otherwise
+         */
+        virtual bool IsValid() const = 0;
+
         // ============================================================================
         // SHADER INFORMATION
         // ============================================================================
@@ -141,8 +277,13 @@ namespace Vortex
          * @brief Check if shader has a specific stage
          * @param stage Shader stage to check
          * @return True if shader has this stage
+         * @note Header-inline so stage dispatch loops fold this to a bit
+         *       test instead of paying a call
          */
-        bool HasStage(ShaderStage stage) const;
+        constexpr bool HasStage(ShaderStage stage) const noexcept
+        {
+            return ((m_StageFlags >> static_cast<uint32_t>(stage)) & 1u) != 0;
+        }
 
         /**
          * @brief Get debug information
@@ -157,9 +298,9 @@ namespace Vortex
         /**
          * @brief Create shader for current graphics API
          * @param name Shader name
-         * @return Unique pointer to shader
+         * @return Reference-counted handle to the shader
          */
-        static std::unique_ptr<GPUShader> Create(const std::string& name = "");
+        static ShaderRef Create(const std::string& name = "");
 
     protected:
         /**
@@ -170,15 +311,101 @@ namespace Vortex
                         ShaderStageFlags stageFlags);
 
     private:
+        friend class ShaderRef;
+
         UUID m_Id;
         std::string m_Name;
         ShaderReflectionData m_ReflectionData;
         ShaderStageFlags m_StageFlags = 0;
+
+        // Intrusive reference count, managed exclusively by ShaderRef
+        mutable std::atomic<uint32_t> m_RefCount{ 0 };
     };
 
     /**
-     * @brief Shared pointer type for shaders
+     * @brief Intrusive reference-counted handle to a GPUShader
+     *
+     * Replaces the shared_ptr alias: the count lives inside the shader
+     * object, so there is no separate control-block allocation per shader
+     * and a ref-count op touches the object's own cache line instead of a
+     * second one. Increments are relaxed - the source reference the copy
+     * was made from already keeps the object alive - and the decrement is
+     * acq_rel so the thread that deletes sees all writes made through
+     * other references. The get()/reset() spelling matches shared_ptr so
+     * existing call sites read unchanged.
      */
-    using ShaderRef = std::shared_ptr<GPUShader>;
+    class ShaderRef
+    {
+    public:
+        ShaderRef() noexcept = default;
+        ShaderRef(std::nullptr_t) noexcept {}
+
+        /**
+         * @brief Take a reference to a shader (first one adopts a fresh object)
+         */
+        explicit ShaderRef(GPUShader* shader) noexcept
+            : m_Shader(shader)
+        {
+            if (m_Shader)
+                m_Shader->m_RefCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ShaderRef(const ShaderRef& other) noexcept
+            : m_Shader(other.m_Shader)
+        {
+            if (m_Shader)
+                m_Shader->m_RefCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ShaderRef(ShaderRef&& other) noexcept
+            : m_Shader(other.m_Shader)
+        {
+            other.m_Shader = nullptr;
+        }
+
+        ShaderRef& operator=(const ShaderRef& other) noexcept
+        {
+            ShaderRef(other).Swap(*this);
+            return *this;
+        }
+
+        ShaderRef& operator=(ShaderRef&& other) noexcept
+        {
+            ShaderRef(std::move(other)).Swap(*this);
+            return *this;
+        }
+
+        ~ShaderRef()
+        {
+            Release();
+        }
+
+        void reset() noexcept { Release(); }
+
+        GPUShader* get() const noexcept { return m_Shader; }
+        GPUShader* operator->() const noexcept { return m_Shader; }
+        GPUShader& operator*() const noexcept { return *m_Shader; }
+        explicit operator bool() const noexcept { return m_Shader != nullptr; }
+
+        bool operator==(const ShaderRef& other) const noexcept { return m_Shader == other.m_Shader; }
+        bool operator!=(const ShaderRef& other) const noexcept { return m_Shader != other.m_Shader; }
+        bool operator==(std::nullptr_t) const noexcept { return m_Shader == nullptr; }
+        bool operator!=(std::nullptr_t) const noexcept { return m_Shader != nullptr; }
+
+    private:
+        void Release() noexcept
+        {
+            if (m_Shader && m_Shader->m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete m_Shader;
+            m_Shader = nullptr;
+        }
+
+        void Swap(ShaderRef& other) noexcept
+        {
+            std::swap(m_Shader, other.m_Shader);
+        }
+
+        GPUShader* m_Shader = nullptr;
+    };
 
 } // namespace Vortex
\ No newline at end of file
@@ -5,11 +5,33 @@
 
 #include <shaderc/shaderc.hpp>
 
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <deque>
 #include <fstream>
 #include <filesystem>
 #include <future>
-#include <sstream>
 #include <shared_mutex>
+#include <string_view>
+#include <thread>
+
+// Platform-specific headers for memory-mapped reads and direct file writes
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
 
 namespace Vortex
 {
@@ -17,50 +39,285 @@ namespace Vortex
     // Utility Functions
     // ============================================================================
 
+    // Stage lookups run on every cache-path operation, so both conversions
+    // are flat tables indexed by the enum value instead of switch trees.
+    // Order must match the ShaderStage declaration.
+    static constexpr shaderc_shader_kind kShadercKindTable[] = {
+        shaderc_vertex_shader,          // Vertex
+        shaderc_tess_control_shader,    // TessellationControl
+        shaderc_tess_evaluation_shader, // TessellationEvaluation
+        shaderc_geometry_shader,        // Geometry
+        shaderc_fragment_shader,        // Fragment
+        shaderc_compute_shader,         // Compute
+        shaderc_raygen_shader,          // RayGeneration
+        shaderc_anyhit_shader,          // AnyHit
+        shaderc_closesthit_shader,      // ClosestHit
+        shaderc_miss_shader,            // Miss
+        shaderc_intersection_shader,    // Intersection
+        shaderc_callable_shader,        // Callable
+    };
+    static_assert(sizeof(kShadercKindTable) / sizeof(kShadercKindTable[0]) == MaxShaderStages,
+                  "kShadercKindTable must cover every ShaderStage");
+
+    static constexpr std::string_view kShaderStageNames[] = {
+        "vertex", "tess_control", "tess_eval", "geometry", "fragment", "compute",
+        "raygen", "anyhit", "closesthit", "miss", "intersection", "callable",
+    };
+    static_assert(sizeof(kShaderStageNames) / sizeof(kShaderStageNames[0]) == MaxShaderStages,
+                  "kShaderStageNames must cover every ShaderStage");
+
     static shaderc_shader_kind GetShadercKind(ShaderStage stage)
     {
-        switch (stage)
-        {
-        case ShaderStage::Vertex:                   return shaderc_vertex_shader;
-        case ShaderStage::Fragment:                 return shaderc_fragment_shader;
-        case ShaderStage::Geometry:                 return shaderc_geometry_shader;
-        case ShaderStage::TessellationControl:      return shaderc_tess_control_shader;
-        case ShaderStage::TessellationEvaluation:   return shaderc_tess_evaluation_shader;
-        case ShaderStage::Compute:                  return shaderc_compute_shader;
-        case ShaderStage::RayGeneration:            return shaderc_raygen_shader;
-        case ShaderStage::AnyHit:                   return shaderc_anyhit_shader;
-        case ShaderStage::ClosestHit:               return shaderc_closesthit_shader;
-        case ShaderStage::Miss:                     return shaderc_miss_shader;
-        case ShaderStage::Intersection:             return shaderc_intersection_shader;
-        case ShaderStage::Callable:                 return shaderc_callable_shader;
-        default:
+        const size_t index = static_cast<size_t>(stage);
+        if (index >= MaxShaderStages) [[unlikely]]
+        {
             VX_CORE_ERROR("Unknown shader stage: {0}", static_cast<int>(stage));
             return shaderc_vertex_shader;
         }
+        return kShadercKindTable[index];
+    }
+
+    static std::string_view GetShaderStageString(ShaderStage stage)
+    {
+        const size_t index = static_cast<size_t>(stage);
+        return index < MaxShaderStages ? kShaderStageNames[index] : std::string_view("unknown");
+    }
+
+    // "variant_12" / "batch_7" style task names, formatted on the stack so
+    // building one costs a single exact-size string instead of the
+    // to_string temporary plus concatenation an operator+ chain makes
+    static std::string MakeIndexedName(std::string_view prefix, size_t index)
+    {
+        char buffer[20]; // size_t decimal max is 20 digits
+        auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), index);
+        (void)ec;
+
+        std::string name;
+        name.reserve(prefix.size() + static_cast<size_t>(end - buffer));
+        name.append(prefix);
+        name.append(buffer, end);
+        return name;
+    }
+
+    // Packs a file extension (dot included, max 8 bytes) into a uint64_t,
+    // ORing in 0x20 per byte to lowercase ASCII letters ('.' already has
+    // that bit set). Stage detection then becomes one packed load plus an
+    // integer switch instead of a chain of string compares over a freshly
+    // allocated, byte-wise lowercased std::string.
+    static constexpr uint64_t PackExtension(std::string_view extension)
+    {
+        if (extension.size() > sizeof(uint64_t))
+            return 0;
+
+        uint64_t packed = 0;
+        for (size_t i = 0; i < extension.size(); ++i)
+        {
+            packed |= static_cast<uint64_t>(static_cast<uint8_t>(extension[i]) | 0x20u) << (i * 8);
+        }
+        return packed;
     }
 
-    static std::string GetShaderStageString(ShaderStage stage)
+    static bool ShaderStageFromExtension(std::string_view extension, ShaderStage& outStage)
     {
-        switch (stage)
+        switch (PackExtension(extension))
         {
-        case ShaderStage::Vertex:                   return "vertex";
-        case ShaderStage::Fragment:                 return "fragment";
-        case ShaderStage::Geometry:                 return "geometry";
-        case ShaderStage::TessellationControl:     return "tess_control";
-        case ShaderStage::TessellationEvaluation:  return "tess_eval";
-        case ShaderStage::Compute:                  return "compute";
-        case ShaderStage::RayGeneration:            return "raygen";
-        case ShaderStage::AnyHit:                   return "anyhit";
-        case ShaderStage::ClosestHit:               return "closesthit";
-        case ShaderStage::Miss:                     return "miss";
-        case ShaderStage::Intersection:             return "intersection";
-        case ShaderStage::Callable:                 return "callable";
-        default:                                    return "unknown";
+        case PackExtension(".vert"):
+        case PackExtension(".vs"):
+            outStage = ShaderStage::Vertex;
+            return true;
+        case PackExtension(".frag"):
+        case PackExtension(".fs"):
+            outStage = ShaderStage::Fragment;
+            return true;
+        case PackExtension(".geom"):
+        case PackExtension(".gs"):
+            outStage = ShaderStage::Geometry;
+            return true;
+        case PackExtension(".tesc"):
+        case PackExtension(".tcs"):
+            outStage = ShaderStage::TessellationControl;
+            return true;
+        case PackExtension(".tese"):
+        case PackExtension(".tes"):
+            outStage = ShaderStage::TessellationEvaluation;
+            return true;
+        case PackExtension(".comp"):
+        case PackExtension(".cs"):
+            outStage = ShaderStage::Compute;
+            return true;
+        default:
+            return false;
         }
     }
 
+    // Files below this size are read with a single buffered read instead of
+    // being mapped: the mmap/MapViewOfFile setup costs more than the copy it
+    // would save on a few KiB of data.
+    static constexpr size_t kMappedReadThreshold = 64 * 1024;
+
+    // Last write time in platform-native units (100 ns FILETIME ticks on
+    // Windows, whole seconds on POSIX); 0 means the file could not be
+    // queried. Values are only ever compared against each other, never
+    // interpreted as wall-clock time.
+    static uint64_t GetFileWriteTime(const std::string& filepath)
+    {
+#ifdef _WIN32
+        WIN32_FILE_ATTRIBUTE_DATA attributes{};
+        if (!GetFileAttributesExA(filepath.c_str(), GetFileExInfoStandard, &attributes))
+            return 0;
+
+        ULARGE_INTEGER time{};
+        time.LowPart = attributes.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = attributes.ftLastWriteTime.dwHighDateTime;
+        return time.QuadPart;
+#else
+        struct stat info{};
+        if (::stat(filepath.c_str(), &info) != 0)
+            return 0;
+        return static_cast<uint64_t>(info.st_mtime);
+#endif
+    }
+
+    // Current time in the same units as GetFileWriteTime(), for stamping
+    // cache records without stat'ing the file just written
+    static uint64_t GetCurrentFileTime()
+    {
+#ifdef _WIN32
+        FILETIME now{};
+        GetSystemTimeAsFileTime(&now);
+        ULARGE_INTEGER time{};
+        time.LowPart = now.dwLowDateTime;
+        time.HighPart = now.dwHighDateTime;
+        return time.QuadPart;
+#else
+        return static_cast<uint64_t>(::time(nullptr));
+#endif
+    }
+
+    // Read-only memory-mapped view of a file. Mapping lets readers copy
+    // straight out of the OS page cache instead of funnelling the bytes
+    // through stream buffers (and paying a seekg/tellg round trip just to
+    // size the read). Files smaller than minSize are deliberately left
+    // unmapped; callers fall back to a buffered read.
+    class MappedFile
+    {
+    public:
+        MappedFile(const std::string& filepath, size_t minSize)
+        {
+#ifdef _WIN32
+            HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return;
+
+            // Write time comes from the handle we already hold, so callers
+            // never need a separate path-based stat for staleness checks
+            FILETIME lastWrite{};
+            if (GetFileTime(file, nullptr, nullptr, &lastWrite))
+            {
+                ULARGE_INTEGER time{};
+                time.LowPart = lastWrite.dwLowDateTime;
+                time.HighPart = lastWrite.dwHighDateTime;
+                m_WriteTime = time.QuadPart;
+            }
+
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file, &size) || static_cast<size_t>(size.QuadPart) < minSize)
+            {
+                CloseHandle(file);
+                return;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping)
+            {
+                CloseHandle(file);
+                return;
+            }
+
+            m_Data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (!m_Data)
+            {
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return;
+            }
+
+            m_File = file;
+            m_Mapping = mapping;
+            m_Size = static_cast<size_t>(size.QuadPart);
+#else
+            int fd = open(filepath.c_str(), O_RDONLY);
+            if (fd < 0)
+                return;
+
+            struct stat info{};
+            if (fstat(fd, &info) != 0)
+            {
+                close(fd);
+                return;
+            }
+
+            // Captured even when the file is too small to map, so the
+            // buffered-read fallback still gets the write time for free
+            m_WriteTime = static_cast<uint64_t>(info.st_mtime);
+
+            if (static_cast<size_t>(info.st_size) < minSize)
+            {
+                close(fd);
+                return;
+            }
+
+            void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd); // the mapping keeps the file alive
+            if (data == MAP_FAILED)
+                return;
+
+            m_Data = data;
+            m_Size = static_cast<size_t>(info.st_size);
+#endif
+        }
+
+        ~MappedFile()
+        {
+#ifdef _WIN32
+            if (m_Data) UnmapViewOfFile(m_Data);
+            if (m_Mapping) CloseHandle(m_Mapping);
+            if (m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+#else
+            if (m_Data) munmap(m_Data, m_Size);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool IsMapped() const { return m_Data != nullptr; }
+        const char* GetData() const { return static_cast<const char*>(m_Data); }
+        size_t GetSize() const { return m_Size; }
+
+        // Same units as GetFileWriteTime(); 0 if the file could not be opened
+        uint64_t GetWriteTime() const { return m_WriteTime; }
+
+    private:
+#ifdef _WIN32
+        HANDLE m_File = INVALID_HANDLE_VALUE;
+        HANDLE m_Mapping = nullptr;
+#endif
+        void* m_Data = nullptr;
+        size_t m_Size = 0;
+        uint64_t m_WriteTime = 0;
+    };
+
     static std::string ReadFileToString(const std::string& filepath)
     {
+        MappedFile mapped(filepath, kMappedReadThreshold);
+        if (mapped.IsMapped())
+        {
+            return std::string(mapped.GetData(), mapped.GetSize());
+        }
+
+        // Small (or unmappable) file: one buffered read
         std::ifstream file(filepath, std::ios::in | std::ios::binary);
         if (!file.is_open())
         {
@@ -76,10 +333,627 @@ namespace Vortex
         return content;
     }
 
-    static uint64_t HashString(const std::string& str)
+    // One piece of a file written by WriteFileSpans
+    struct FileWriteSpan
+    {
+        const void* Data = nullptr;
+        size_t Size = 0;
+    };
+
+    // Writes all spans to a file with direct platform calls - truncating by
+    // default, appending at the end when `append` is set. std::ofstream
+    // drains its ~4 KiB buffer one write() at a time, so a 40 KB SPIR-V
+    // blob cost a dozen syscalls plus iostream sentry overhead per call;
+    // here the whole payload goes out in a single writev (POSIX) or one
+    // WriteFile per span (Windows). Returns false on any failure.
+    static bool WriteFileSpans(const std::string& filepath, const FileWriteSpan* spans, size_t count,
+                               bool append = false)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filepath.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, 0, nullptr,
+                                  append ? OPEN_ALWAYS : CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        bool ok = true;
+        for (size_t i = 0; i < count && ok; ++i)
+        {
+            const uint8_t* data = static_cast<const uint8_t*>(spans[i].Data);
+            size_t remaining = spans[i].Size;
+            while (remaining > 0)
+            {
+                DWORD written = 0;
+                const DWORD chunk = static_cast<DWORD>(std::min<size_t>(remaining, 0x7FFFF000));
+                if (!WriteFile(file, data, chunk, &written, nullptr) || written == 0)
+                {
+                    ok = false;
+                    break;
+                }
+                data += written;
+                remaining -= written;
+            }
+        }
+        CloseHandle(file);
+        return ok;
+#else
+        int fd = ::open(filepath.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0644);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        constexpr int kMaxIov = 8;
+        bool ok = true;
+        size_t index = 0;  // first span not fully written
+        size_t offset = 0; // bytes of spans[index] already written
+        while (index < count)
+        {
+            iovec iov[kMaxIov];
+            int iovCount = 0;
+            for (size_t i = index; i < count && iovCount < kMaxIov; ++i)
+            {
+                const size_t skip = (i == index) ? offset : 0;
+                iov[iovCount].iov_base = const_cast<uint8_t*>(static_cast<const uint8_t*>(spans[i].Data)) + skip;
+                iov[iovCount].iov_len = spans[i].Size - skip;
+                ++iovCount;
+            }
+
+            const ssize_t written = ::writev(fd, iov, iovCount);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                ok = false;
+                break;
+            }
+
+            // Advance past fully written spans, then into the partial one
+            size_t advanced = static_cast<size_t>(written);
+            while (index < count && advanced >= spans[index].Size - offset)
+            {
+                advanced -= spans[index].Size - offset;
+                ++index;
+                offset = 0;
+            }
+            offset += advanced;
+        }
+        ::close(fd);
+        return ok;
+#endif
+    }
+
+    // ============================================================================
+    // Directory Change Notification
+    // ============================================================================
+
+    // Kernel change notification for the hot-reload watcher: change
+    // notifications on Windows (subtree-recursive) and inotify on Linux.
+    // Wait() reports whether the kernel saw write activity under the watched
+    // trees, so the watcher only pays for a recursive directory walk after a
+    // real event instead of every tick. If the directories cannot be watched
+    // (exotic filesystems, watch limits), Wait() always reports activity and
+    // the watcher degrades to the previous scan-every-tick behavior.
+    class DirectoryChangeNotifier
+    {
+    public:
+        ~DirectoryChangeNotifier() { Close(); }
+
+        void Watch(const std::vector<std::string>& directories)
+        {
+            Close();
+#ifdef _WIN32
+            for (const auto& dir : directories)
+            {
+                if (m_Handles.size() >= MAXIMUM_WAIT_OBJECTS)
+                    break;
+                HANDLE handle = FindFirstChangeNotificationA(dir.c_str(), TRUE,
+                    FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+                if (handle != INVALID_HANDLE_VALUE)
+                    m_Handles.push_back(handle);
+            }
+#else
+            m_Fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (m_Fd < 0)
+                return;
+
+            // inotify watches are per-directory, not recursive: register the
+            // roots plus every subdirectory present now. IN_CREATE on the
+            // parents still signals when a new folder appears, and the scan
+            // that follows sees its files; only writes inside a folder
+            // created after this setup go unseen until watches are rebuilt,
+            // which a hot-reload toggle does.
+            namespace fs = std::filesystem;
+            for (const auto& dir : directories)
+            {
+                AddWatch(dir);
+                std::error_code ec;
+                for (const auto& entry : fs::recursive_directory_iterator(dir, ec))
+                {
+                    if (entry.is_directory(ec))
+                        AddWatch(entry.path().string());
+                }
+            }
+#endif
+        }
+
+        // True when the kernel reported write activity before the timeout
+        // elapsed (0 = just check); true on every call when nothing could be
+        // watched, so callers fall back to scanning each tick
+        bool Wait(int timeoutMillis)
+        {
+#ifdef _WIN32
+            if (m_Handles.empty())
+            {
+                if (timeoutMillis > 0)
+                    Sleep(static_cast<DWORD>(timeoutMillis));
+                return true;
+            }
+
+            const DWORD result = WaitForMultipleObjects(static_cast<DWORD>(m_Handles.size()),
+                                                        m_Handles.data(), FALSE,
+                                                        static_cast<DWORD>(timeoutMillis));
+            if (result >= WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + m_Handles.size())
+            {
+                FindNextChangeNotification(m_Handles[result - WAIT_OBJECT_0]);
+                return true;
+            }
+            return false;
+#else
+            if (m_Fd < 0)
+            {
+                if (timeoutMillis > 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMillis));
+                return true;
+            }
+
+            pollfd pfd{};
+            pfd.fd = m_Fd;
+            pfd.events = POLLIN;
+            if (::poll(&pfd, 1, timeoutMillis) <= 0)
+                return false;
+
+            // Drain the event queue; the mtime scan that follows identifies
+            // the actual files, so the event payloads themselves are unused
+            char buffer[4096];
+            while (::read(m_Fd, buffer, sizeof(buffer)) > 0)
+            {
+            }
+            return true;
+#endif
+        }
+
+        void Close()
+        {
+#ifdef _WIN32
+            for (HANDLE handle : m_Handles)
+                FindCloseChangeNotification(handle);
+            m_Handles.clear();
+#else
+            if (m_Fd >= 0)
+            {
+                ::close(m_Fd);
+                m_Fd = -1;
+            }
+#endif
+        }
+
+    private:
+#ifdef _WIN32
+        std::vector<HANDLE> m_Handles;
+#else
+        void AddWatch(const std::string& path)
+        {
+            inotify_add_watch(m_Fd, path.c_str(),
+                              IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+        }
+
+        int m_Fd = -1;
+#endif
+    };
+
+    // ============================================================================
+    // Shader Cache Serialization
+    // ============================================================================
+
+    // The disk cache is one packed pair of files per toolchain directory
+    // instead of one file per shader: an append-only data file holding raw
+    // SPIR-V words followed by the flat reflection snapshot for each entry,
+    // and a sidecar index of fixed-size records saying where each entry
+    // lives. Startup maps the data file and reads the index once, so a
+    // cold-cache session costs two opens total rather than one per shader,
+    // and a disk hit is a memcpy out of the mapping rather than an
+    // open/read/close round trip. Both files are append-only; a recompiled
+    // shader appends a fresh entry and the newer index record wins, so
+    // superseded data lingers as garbage until the cache is cleared.
+    struct ShaderPackHeader
+    {
+        uint32_t Magic = 0;
+        uint32_t Version = 0;
+    };
+
+    struct ShaderPackRecord
+    {
+        uint64_t Hash = 0;
+        uint64_t DataOffset = 0;
+        uint64_t WriteTime = 0; // GetFileWriteTime() units, taken at append
+        uint32_t Stage = 0;
+        uint32_t SpirvWords = 0;
+        uint32_t ReflectionBytes = 0;
+        uint32_t Reserved = 0;
+    };
+
+    static constexpr uint32_t kShaderPackMagic = 0x49505856; // "VXPI"
+    // Bump when the record or reflection layout changes; a mismatched index
+    // is discarded wholesale and the cache rebuilt on recompile
+    static constexpr uint32_t kShaderPackVersion = 1;
+
+    static constexpr const char* kShaderPackDataFileName = "shaders.pack";
+    static constexpr const char* kShaderPackIndexFileName = "shaders.idx";
+
+    static void AppendBytes(std::vector<uint8_t>& out, const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    template<typename T>
+    static void AppendValue(std::vector<uint8_t>& out, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "AppendValue requires a trivially copyable type");
+        AppendBytes(out, &value, sizeof(T));
+    }
+
+    static void AppendString(std::vector<uint8_t>& out, const std::string& value)
+    {
+        AppendValue(out, static_cast<uint32_t>(value.size()));
+        AppendBytes(out, value.data(), value.size());
+    }
+
+    // Bounds-checked cursor over a serialized reflection blob; every read
+    // reports failure instead of walking past the end of a truncated or
+    // corrupted cache file.
+    struct BlobReader
+    {
+        const uint8_t* Data = nullptr;
+        size_t Size = 0;
+        size_t Offset = 0;
+
+        bool ReadBytes(void* dst, size_t size)
+        {
+            if (size > Size - Offset)
+                return false;
+            std::memcpy(dst, Data + Offset, size);
+            Offset += size;
+            return true;
+        }
+
+        template<typename T>
+        bool ReadValue(T& out)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "ReadValue requires a trivially copyable type");
+            return ReadBytes(&out, sizeof(T));
+        }
+
+        bool ReadString(std::string& out)
+        {
+            uint32_t length = 0;
+            if (!ReadValue(length) || length > Size - Offset)
+                return false;
+            out.assign(reinterpret_cast<const char*>(Data + Offset), length);
+            Offset += length;
+            return true;
+        }
+    };
+
+    static void AppendUniform(std::vector<uint8_t>& out, const ShaderUniform& uniform)
+    {
+        AppendString(out, uniform.Name);
+        AppendValue(out, static_cast<uint32_t>(uniform.Type));
+        AppendValue(out, uniform.Size);
+        AppendValue(out, uniform.Offset);
+        AppendValue(out, uniform.ArraySize);
+        AppendValue(out, uniform.Location);
+    }
+
+    static bool ReadUniform(BlobReader& reader, ShaderUniform& uniform)
+    {
+        uint32_t type = 0;
+        if (!reader.ReadString(uniform.Name) || !reader.ReadValue(type))
+            return false;
+        uniform.Type = static_cast<ShaderDataType>(type);
+        return reader.ReadValue(uniform.Size) && reader.ReadValue(uniform.Offset)
+            && reader.ReadValue(uniform.ArraySize) && reader.ReadValue(uniform.Location);
+    }
+
+    static std::vector<uint8_t> SerializeReflection(const ShaderReflectionData& reflection)
+    {
+        std::vector<uint8_t> blob;
+
+        AppendValue(blob, static_cast<uint32_t>(reflection.Uniforms.size()));
+        for (const ShaderUniform& uniform : reflection.Uniforms)
+            AppendUniform(blob, uniform);
+
+        AppendValue(blob, static_cast<uint32_t>(reflection.Resources.size()));
+        for (const ShaderResource& resource : reflection.Resources)
+        {
+            AppendString(blob, resource.Name);
+            AppendValue(blob, static_cast<uint32_t>(resource.Type));
+            AppendValue(blob, resource.Set);
+            AppendValue(blob, resource.Binding);
+            AppendValue(blob, resource.ArraySize);
+            AppendValue(blob, resource.Stages);
+        }
+
+        AppendValue(blob, static_cast<uint32_t>(reflection.VertexInputs.size()));
+        for (const ShaderVertexInput& input : reflection.VertexInputs)
+        {
+            AppendString(blob, input.Name);
+            AppendValue(blob, input.Location);
+            AppendValue(blob, static_cast<uint32_t>(input.Type));
+            AppendValue(blob, input.Size);
+        }
+
+        AppendValue(blob, static_cast<uint32_t>(reflection.UniformBuffers.size()));
+        for (const auto& [binding, uniforms] : reflection.UniformBuffers)
+        {
+            AppendValue(blob, binding);
+            AppendValue(blob, static_cast<uint32_t>(uniforms.size()));
+            for (const ShaderUniform& uniform : uniforms)
+                AppendUniform(blob, uniform);
+        }
+
+        AppendValue(blob, reflection.LocalSize.x);
+        AppendValue(blob, reflection.LocalSize.y);
+        AppendValue(blob, reflection.LocalSize.z);
+        AppendValue(blob, reflection.InstructionCount);
+        AppendValue(blob, reflection.MemoryUsage);
+
+        return blob;
+    }
+
+    static bool DeserializeReflection(const uint8_t* data, size_t size, ShaderReflectionData& outReflection)
+    {
+        BlobReader reader{ data, size };
+        outReflection = {};
+
+        // Counts are sanity-checked against the blob size before resizing so
+        // a corrupt file can't request a multi-gigabyte allocation
+        uint32_t count = 0;
+        if (!reader.ReadValue(count) || count > size)
+            return false;
+        outReflection.Uniforms.resize(count);
+        for (ShaderUniform& uniform : outReflection.Uniforms)
+        {
+            if (!ReadUniform(reader, uniform))
+                return false;
+        }
+
+        if (!reader.ReadValue(count) || count > size)
+            return false;
+        outReflection.Resources.resize(count);
+        for (ShaderResource& resource : outReflection.Resources)
+        {
+            uint32_t type = 0;
+            if (!reader.ReadString(resource.Name) || !reader.ReadValue(type)
+                || !reader.ReadValue(resource.Set) || !reader.ReadValue(resource.Binding)
+                || !reader.ReadValue(resource.ArraySize) || !reader.ReadValue(resource.Stages))
+            {
+                return false;
+            }
+            resource.Type = static_cast<ShaderResourceType>(type);
+        }
+
+        if (!reader.ReadValue(count) || count > size)
+            return false;
+        outReflection.VertexInputs.resize(count);
+        for (ShaderVertexInput& input : outReflection.VertexInputs)
+        {
+            uint32_t type = 0;
+            if (!reader.ReadString(input.Name) || !reader.ReadValue(input.Location)
+                || !reader.ReadValue(type) || !reader.ReadValue(input.Size))
+            {
+                return false;
+            }
+            input.Type = static_cast<ShaderDataType>(type);
+        }
+
+        if (!reader.ReadValue(count) || count > size)
+            return false;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t binding = 0;
+            uint32_t uniformCount = 0;
+            if (!reader.ReadValue(binding) || !reader.ReadValue(uniformCount) || uniformCount > size)
+                return false;
+            std::vector<ShaderUniform>& uniforms = outReflection.UniformBuffers[binding];
+            uniforms.resize(uniformCount);
+            for (ShaderUniform& uniform : uniforms)
+            {
+                if (!ReadUniform(reader, uniform))
+                    return false;
+            }
+        }
+
+        return reader.ReadValue(outReflection.LocalSize.x)
+            && reader.ReadValue(outReflection.LocalSize.y)
+            && reader.ReadValue(outReflection.LocalSize.z)
+            && reader.ReadValue(outReflection.InstructionCount)
+            && reader.ReadValue(outReflection.MemoryUsage);
+    }
+
+    // Open-addressed map for the compile-hash -> cache-entry shards.
+    // std::unordered_map chases a heap-allocated node per find, which is
+    // several dependent cache-line fetches once the table falls out of L2;
+    // here the whole probe sequence is one contiguous slot array, and since
+    // the keys are already FNV-mixed compile hashes the slot index is just a
+    // mask of the key (no re-hash). Deletes backward-shift the probe chain,
+    // so no tombstones accumulate. Grows at 3/4 load.
+    class ShaderHashMap
+    {
+    public:
+        std::shared_ptr<const CompiledShader> Find(uint64_t key) const
+        {
+            if (m_Slots.empty())
+                return nullptr;
+
+            const size_t mask = m_Slots.size() - 1;
+            size_t index = static_cast<size_t>(key) & mask;
+            while (m_Slots[index].Occupied)
+            {
+                if (m_Slots[index].Key == key)
+                    return m_Slots[index].Value;
+                index = (index + 1) & mask;
+            }
+            return nullptr;
+        }
+
+        void InsertOrAssign(uint64_t key, std::shared_ptr<const CompiledShader> value)
+        {
+            if (m_Slots.empty() || (m_Count + 1) * 4 > m_Slots.size() * 3)
+                Grow();
+            InsertNoGrow(key, std::move(value));
+        }
+
+        void Erase(uint64_t key)
+        {
+            if (m_Slots.empty())
+                return;
+
+            const size_t mask = m_Slots.size() - 1;
+            size_t index = static_cast<size_t>(key) & mask;
+            while (m_Slots[index].Occupied && m_Slots[index].Key != key)
+            {
+                index = (index + 1) & mask;
+            }
+            if (!m_Slots[index].Occupied)
+                return;
+
+            // Backward-shift: pull chain entries whose home position lies at
+            // or before the hole into the hole, so later finds never walk
+            // across a gap
+            size_t hole = index;
+            size_t next = (hole + 1) & mask;
+            while (m_Slots[next].Occupied)
+            {
+                const size_t home = static_cast<size_t>(m_Slots[next].Key) & mask;
+                if (((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    m_Slots[hole] = std::move(m_Slots[next]);
+                    m_Slots[next].Occupied = false;
+                    m_Slots[next].Value.reset();
+                    hole = next;
+                }
+                next = (next + 1) & mask;
+            }
+            m_Slots[hole].Occupied = false;
+            m_Slots[hole].Value.reset();
+            --m_Count;
+        }
+
+        void Clear()
+        {
+            m_Slots.clear();
+            m_Slots.shrink_to_fit();
+            m_Count = 0;
+        }
+
+    private:
+        struct Slot
+        {
+            uint64_t Key = 0;
+            bool Occupied = false;
+            std::shared_ptr<const CompiledShader> Value;
+        };
+
+        void InsertNoGrow(uint64_t key, std::shared_ptr<const CompiledShader>&& value)
+        {
+            const size_t mask = m_Slots.size() - 1;
+            size_t index = static_cast<size_t>(key) & mask;
+            while (m_Slots[index].Occupied)
+            {
+                if (m_Slots[index].Key == key)
+                {
+                    m_Slots[index].Value = std::move(value);
+                    return;
+                }
+                index = (index + 1) & mask;
+            }
+            m_Slots[index].Key = key;
+            m_Slots[index].Occupied = true;
+            m_Slots[index].Value = std::move(value);
+            ++m_Count;
+        }
+
+        void Grow()
+        {
+            constexpr size_t kInitialCapacity = 64; // power of two for the mask
+            std::vector<Slot> old = std::move(m_Slots);
+            m_Slots.clear();
+            m_Slots.resize(old.empty() ? kInitialCapacity : old.size() * 2);
+            m_Count = 0;
+            for (Slot& slot : old)
+            {
+                if (slot.Occupied)
+                    InsertNoGrow(slot.Key, std::move(slot.Value));
+            }
+        }
+
+        std::vector<Slot> m_Slots;
+        size_t m_Count = 0;
+    };
+
+    // Streaming FNV-1a-64 fed straight from the input buffers. Hashing the
+    // compile inputs used to build a stringstream and materialize a full
+    // copy of the shader source just to run std::hash over it; updating a
+    // running hash field-by-field moves no bytes at all.
+    class StreamingHash
+    {
+    public:
+        void Update(const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                m_Hash ^= bytes[i];
+                m_Hash *= 1099511628211ull;
+            }
+        }
+
+        void Update(std::string_view text) { Update(text.data(), text.size()); }
+
+        void UpdateByte(uint8_t value) { Update(&value, 1); }
+
+        template<typename T>
+        void UpdateValue(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "hash raw bytes of trivial types only");
+            Update(&value, sizeof(T));
+        }
+
+        uint64_t Finish() const { return m_Hash; }
+
+    private:
+        uint64_t m_Hash = 1469598103934665603ull;
+    };
+
+    // ShaderMacroSet keeps its parallel name/value arrays sorted by name,
+    // so a plain walk is already deterministic across runs and standard
+    // library builds - no per-call copy-and-sort needed to keep equivalent
+    // macro sets hashing identically.
+    static void HashMacros(StreamingHash& hash, const ShaderMacroSet& macros)
     {
-        std::hash<std::string> hasher;
-        return hasher(str);
+        const auto& names = macros.GetNames();
+        const auto& values = macros.GetValues();
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            hash.Update(names[i]);
+            hash.UpdateByte('=');
+            hash.Update(values[i]);
+            hash.UpdateByte(';');
+        }
     }
 
     // ============================================================================
@@ -89,8 +963,16 @@ namespace Vortex
     class ShaderCompiler::Impl
     {
     public:
-        // Compiler state
-        shaderc::Compiler m_Compiler;
+        // Compiler state. Each worker thread gets its own lazily constructed
+        // shaderc::Compiler so parallel compiles never serialize on shared
+        // compiler internals; the instance lives for the thread's lifetime
+        // and is reused across compiles.
+        static shaderc::Compiler& GetThreadCompiler()
+        {
+            static thread_local shaderc::Compiler t_Compiler;
+            return t_Compiler;
+        }
+
         ShaderReflection m_Reflection;
 
         // Settings
@@ -98,18 +980,635 @@ namespace Vortex
         std::string m_CacheDirectory;
         bool m_HotReloadEnabled = false;
         std::vector<std::string> m_WatchDirectories;
+
+        // Cap on concurrent compiles for the batch paths; 0 = no cap beyond
+        // the scheduler's worker count. Gameplay can lower it so background
+        // compiles stop starving frame work, loads can raise it again.
+        std::atomic<uint32_t> m_MaxCompileConcurrency{ 0 };
+
+        // Tag identifying the toolchain build that produced the cache files.
+        // It is folded into every compile hash and doubles as a subdirectory
+        // name on disk, so .spv files written by an older shaderc (or an
+        // older engine build) are simply never found rather than silently
+        // loaded. shaderc exposes no runtime version string, so the tag
+        // hashes the SPIR-V version it targets plus this translation unit's
+        // build timestamp (and the commit, when the build defines one).
+        uint64_t m_ToolchainTag = 0;
+        std::string m_ToolchainTagText;
         
-        // Cache
-        mutable std::unordered_map<uint64_t, CompiledShader> m_ShaderCache;
-        mutable std::shared_mutex m_CacheMutex;
-        // Map source-file+stage -> last stored hash to prune stale cache entries on edits
-        mutable std::unordered_map<std::string, uint64_t> m_SourceStageToHash;
+        // Cache, sharded so concurrent compiles don't serialize on one
+        // mutex: the compile hash is well mixed, so its low bits pick a
+        // shard and threads working on different shaders take different
+        // locks. Writers (SaveToCache) only ever stall readers of the same
+        // shard. Must be a power of two for the mask below.
+        static constexpr size_t kCacheShardCount = 16;
+
+        // Entries are shared_ptr so a hit hands out a reference instead of
+        // deep-copying the SPIR-V vector (tens of KB) while the lock is held;
+        // const contents keep concurrent readers safe
+        struct CacheShard
+        {
+            mutable std::shared_mutex Mutex;
+            ShaderHashMap Shaders;
+        };
+        mutable std::array<CacheShard, kCacheShardCount> m_CacheShards;
+
+        CacheShard& ShardFor(uint64_t hash) const
+        {
+            return m_CacheShards[hash & (kCacheShardCount - 1)];
+        }
+
+        // Map source-file+stage -> last stored hash to prune stale cache
+        // entries on edits; sharded the same way, keyed by a hash of the
+        // string key
+        struct SourceShard
+        {
+            mutable std::shared_mutex Mutex;
+            std::unordered_map<std::string, uint64_t> SourceStageToHash;
+        };
+        mutable std::array<SourceShard, kCacheShardCount> m_SourceShards;
+
+        SourceShard& SourceShardFor(const std::string& key) const
+        {
+            StreamingHash hash;
+            hash.Update(key);
+            return m_SourceShards[hash.Finish() & (kCacheShardCount - 1)];
+        }
+
+        // Per-thread micro-cache in front of the shards: repeat lookups of
+        // the same few shaders (the common case during variant compiles and
+        // hot reload) hit a small ring scanned without taking any lock.
+        // Entries hold shared_ptr references kept alive by the ring itself,
+        // so invalidation never has to worry about dangling pointers;
+        // instead every erase bumps m_CacheGeneration and entries tagged
+        // with an older generation are simply ignored.
+        struct LocalCacheEntry
+        {
+            uint64_t Hash = 0;
+            uint64_t Generation = 0;
+            std::shared_ptr<const CompiledShader> Shader;
+        };
+        static constexpr size_t kLocalCacheSize = 8;
+        static thread_local std::array<LocalCacheEntry, kLocalCacheSize> t_LocalCache;
+        static thread_local size_t t_LocalCacheNext;
+        mutable std::atomic<uint64_t> m_CacheGeneration{ 1 };
+
+        std::shared_ptr<const CompiledShader> TryLocalCache(uint64_t hash) const
+        {
+            const uint64_t generation = m_CacheGeneration.load(std::memory_order_acquire);
+            for (const LocalCacheEntry& entry : t_LocalCache)
+            {
+                if (entry.Hash == hash && entry.Generation == generation)
+                {
+                    return entry.Shader;
+                }
+            }
+            return nullptr;
+        }
+
+        void StoreInLocalCache(uint64_t hash, std::shared_ptr<const CompiledShader> shader) const
+        {
+            LocalCacheEntry& entry = t_LocalCache[t_LocalCacheNext];
+            t_LocalCacheNext = (t_LocalCacheNext + 1) % kLocalCacheSize;
+            entry.Hash = hash;
+            entry.Generation = m_CacheGeneration.load(std::memory_order_acquire);
+            entry.Shader = std::move(shader);
+        }
+
+        void InvalidateLocalCaches() const
+        {
+            m_CacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        // Name-keyed fast path in front of the content-hashed cache: steady
+        // state callers re-submit the same file over and over, and probing
+        // by content hash makes even a hit O(source size). The name key
+        // hashes only the filename, stage, options, and the file's write
+        // time - an edited file gets a new write time, misses here, and
+        // falls through to the content-hash path, which stays authoritative
+        // (entries are only added after it has produced the shader).
+        mutable std::shared_mutex m_NameCacheMutex;
+        mutable std::unordered_map<uint64_t, std::shared_ptr<const CompiledShader>, IdentityU64Hash> m_NameCache;
+
+        uint64_t ComputeNameHash(const std::string& filename, ShaderStage stage,
+                                 const ShaderCompileOptions& options, uint64_t writeTime) const
+        {
+            StreamingHash hash;
+            hash.Update(filename);
+            hash.UpdateValue(static_cast<int32_t>(stage));
+            hash.UpdateValue(static_cast<int32_t>(options.OptimizationLevel));
+            hash.Update(options.TargetProfile);
+            hash.UpdateByte(static_cast<uint8_t>((options.GenerateDebugInfo ? 1u : 0u) |
+                                                 (options.TreatWarningsAsErrors ? 2u : 0u)));
+            HashMacros(hash, options.Macros);
+            hash.UpdateValue(writeTime);
+            return hash.Finish();
+        }
+
+        // Same per-thread ring as the content-hash cache, so steady-state
+        // name probes touch no atomics or locks at all; invalidation rides
+        // the shared generation counter bumped by InvalidateLocalCaches()
+        static thread_local std::array<LocalCacheEntry, kLocalCacheSize> t_NameLocalCache;
+        static thread_local size_t t_NameLocalCacheNext;
+
+        std::shared_ptr<const CompiledShader> TryNameCache(uint64_t nameHash) const
+        {
+            const uint64_t generation = m_CacheGeneration.load(std::memory_order_acquire);
+            for (const LocalCacheEntry& entry : t_NameLocalCache)
+            {
+                if (entry.Hash == nameHash && entry.Generation == generation)
+                {
+                    return entry.Shader;
+                }
+            }
+
+            std::shared_ptr<const CompiledShader> found;
+            {
+                std::shared_lock<std::shared_mutex> lock(m_NameCacheMutex);
+                auto it = m_NameCache.find(nameHash);
+                if (it != m_NameCache.end())
+                    found = it->second;
+            }
+            if (found)
+            {
+                LocalCacheEntry& entry = t_NameLocalCache[t_NameLocalCacheNext];
+                t_NameLocalCacheNext = (t_NameLocalCacheNext + 1) % kLocalCacheSize;
+                entry.Hash = nameHash;
+                entry.Generation = generation;
+                entry.Shader = found;
+            }
+            return found;
+        }
+
+        void StoreInNameCache(uint64_t nameHash, std::shared_ptr<const CompiledShader> shader) const
+        {
+            if (nameHash == 0)
+                return;
+            std::unique_lock<std::shared_mutex> lock(m_NameCacheMutex);
+            m_NameCache[nameHash] = std::move(shader);
+        }
+
+        // Single-flight dedup: when several threads miss the cache on the
+        // same hash at once (typical during level load, where many materials
+        // reference the same shader), only the first one compiles; the rest
+        // park on the entry's condition variable and receive its result.
+        // Without this every caller ran shaderc in parallel on identical
+        // input and raced to write the same cache file.
+        struct InFlightEntry
+        {
+            std::mutex Mutex;
+            std::condition_variable CV;
+            bool Done = false;
+            std::shared_ptr<const CompiledShader> Shader; // null when the compile failed
+            ErrorCode Error = ErrorCode::Success;
+            std::string ErrorMessage;
+        };
+        mutable std::mutex m_InFlightMutex;
+        mutable std::unordered_map<uint64_t, std::shared_ptr<InFlightEntry>, IdentityU64Hash> m_InFlight;
+
+        // Publishes the leader's outcome and wakes every waiter. The entry
+        // is removed from the map first so late arrivals start a fresh
+        // compile (on success they'll hit the cache instead).
+        void FinishInFlight(uint64_t hash, const std::shared_ptr<InFlightEntry>& flight,
+                            std::shared_ptr<const CompiledShader> shader,
+                            ErrorCode error, std::string errorMessage) const
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_InFlightMutex);
+                m_InFlight.erase(hash);
+            }
+            {
+                std::lock_guard<std::mutex> lock(flight->Mutex);
+                flight->Shader = std::move(shader);
+                flight->Error = error;
+                flight->ErrorMessage = std::move(errorMessage);
+                flight->Done = true;
+            }
+            flight->CV.notify_all();
+        }
+
+        // Background cache writer: SaveToCache publishes to the in-memory
+        // cache and hands the file work to this thread, so the compile path
+        // never waits on create_directories/open/write. The thread is
+        // started lazily on the first queued write and drains its queue
+        // before the Impl is torn down.
+        struct CacheWriteJob
+        {
+            uint64_t Hash = 0;
+            ShaderStage Stage = ShaderStage::Vertex;
+            std::shared_ptr<const CompiledShader> Shader;
+        };
+        mutable std::deque<CacheWriteJob> m_WriteQueue;
+        mutable std::mutex m_WriteQueueMutex;
+        mutable std::condition_variable m_WriteQueueCV;
+        mutable std::thread m_WriteThread;
+        mutable bool m_StopWriter = false;
+
+        // Statistics: independent atomic counters instead of one mutex, so
+        // concurrent compiles bumping a counter never serialize on each
+        // other. Relaxed ordering is enough - the stats are an approximate
+        // snapshot, not a synchronization point.
+        // Lookup counters and compile-completion counters live on separate
+        // cache lines: hits/misses tick on every lookup from any worker,
+        // while the completion counters only move when a shader actually
+        // builds, so completion traffic does not invalidate the line the
+        // lookup fast path is hammering (and vice versa). The leading
+        // alignas also keeps unrelated neighboring Impl members off the
+        // lookup line.
+        struct AtomicStats
+        {
+            alignas(64) std::atomic<uint32_t> CacheHits{ 0 };
+            std::atomic<uint32_t> CacheMisses{ 0 };
+
+            alignas(64) std::atomic<uint32_t> ShadersCompiled{ 0 };
+            std::atomic<uint32_t> CompilationErrors{ 0 };
+            std::atomic<uint64_t> CompilationTime{ 0 }; // In microseconds
+        };
+        mutable AtomicStats m_Stats;
+
+        Impl()
+        {
+            StreamingHash tag;
+            unsigned int spvVersion = 0;
+            unsigned int spvRevision = 0;
+            shaderc_get_spv_version(&spvVersion, &spvRevision);
+            tag.UpdateValue(spvVersion);
+            tag.UpdateValue(spvRevision);
+            tag.Update(std::string_view(__DATE__ " " __TIME__));
+#ifdef VX_BUILD_COMMIT
+            tag.Update(std::string_view(VX_BUILD_COMMIT));
+#endif
+            m_ToolchainTag = tag.Finish();
+
+            char tagBuffer[20]; // uint64_t decimal max is 20 digits
+            auto [tagEnd, ec] = std::to_chars(tagBuffer, tagBuffer + sizeof(tagBuffer), m_ToolchainTag);
+            (void)ec;
+            m_ToolchainTagText.assign(tagBuffer, static_cast<size_t>(tagEnd - tagBuffer));
+        }
+
+        ~Impl()
+        {
+            // Watcher first: it may still push compile results through the
+            // cache, which the writer below then flushes
+            StopWatcher();
+
+            {
+                std::lock_guard<std::mutex> lock(m_WriteQueueMutex);
+                m_StopWriter = true;
+            }
+            m_WriteQueueCV.notify_all();
+            if (m_WriteThread.joinable())
+                m_WriteThread.join();
+        }
+
+        void EnqueueCacheWrite(CacheWriteJob job) const
+        {
+            std::lock_guard<std::mutex> lock(m_WriteQueueMutex);
+            if (!m_WriteThread.joinable())
+            {
+                m_WriteThread = std::thread([this] { WriterLoop(); });
+            }
+            m_WriteQueue.push_back(std::move(job));
+            m_WriteQueueCV.notify_one();
+        }
+
+        void WriterLoop() const
+        {
+            std::unique_lock<std::mutex> lock(m_WriteQueueMutex);
+            while (true)
+            {
+                m_WriteQueueCV.wait(lock, [this] { return m_StopWriter || !m_WriteQueue.empty(); });
+                if (m_WriteQueue.empty())
+                {
+                    // Only stop once every pending write has been flushed
+                    if (m_StopWriter)
+                        return;
+                    continue;
+                }
+
+                CacheWriteJob job = std::move(m_WriteQueue.front());
+                m_WriteQueue.pop_front();
+                lock.unlock();
+                AppendCacheRecord(job);
+                lock.lock();
+            }
+        }
+
+        // Hot reload: one watcher thread, woken every tick, asks the kernel
+        // (change notifications / inotify) whether anything under the watch
+        // directories was written and only then scans for shader files whose
+        // write time moved - idle ticks cost a zero-timeout poll instead of
+        // a recursive walk. A change is not recompiled on the tick that
+        // detects it; it sits in the pending set until its write time holds
+        // still for a full poll interval, which coalesces the burst of
+        // events an editor save produces (and skips files a tool is still
+        // streaming out) into one recompile per file.
+        static constexpr int kHotReloadPollMillis = 250;
+
+        ShaderCompiler* m_Owner = nullptr;
+
+        std::mutex m_WatchMutex;
+        std::condition_variable m_WatchCV;
+        std::thread m_WatchThread;
+        bool m_StopWatcher = false;
+        std::unordered_map<std::string, uint64_t> m_WatchedWriteTimes; // baseline per file
+        std::unordered_map<std::string, uint64_t> m_PendingChanges;    // changed, awaiting a quiet interval
+        DirectoryChangeNotifier m_WatchNotifier;                       // watcher thread only
+
+        // Options last used to compile each (normalized) source file, so a
+        // reload replays the same macros/optimization instead of defaults
+        mutable std::mutex m_SourceOptionsMutex;
+        mutable std::unordered_map<std::string, ShaderCompileOptions> m_SourceOptions;
+
+        ShaderLoadedCallback m_ReloadCallback;
+        ShaderErrorCallback m_ErrorCallback;
+        std::mutex m_CallbackMutex;
+
+        // Include processing: #include is resolved against the registered
+        // directories and file contents are cached keyed by write time, so a
+        // utility header shared by every variant of an uber-shader is read
+        // from disk once per edit instead of variants-times-stages times
+        mutable std::shared_mutex m_IncludeMutex;
+        std::vector<std::string> m_IncludeDirectories;
+
+        struct IncludeEntry
+        {
+            uint64_t WriteTime = 0;
+            std::shared_ptr<const std::string> Contents;
+        };
+        mutable std::unordered_map<std::string, IncludeEntry> m_IncludeCache;
+
+        // Contents of one include file, re-read only when its write time
+        // moved since the cached copy was taken; null when unreadable
+        std::shared_ptr<const std::string> GetIncludeContents(const std::string& path) const
+        {
+            const uint64_t writeTime = GetFileWriteTime(path);
+            if (writeTime == 0)
+                return nullptr;
+
+            {
+                std::shared_lock<std::shared_mutex> lock(m_IncludeMutex);
+                auto it = m_IncludeCache.find(path);
+                if (it != m_IncludeCache.end() && it->second.WriteTime == writeTime)
+                    return it->second.Contents;
+            }
+
+            auto contents = std::make_shared<const std::string>(ReadFileToString(path));
+            if (contents->empty())
+                return nullptr;
+
+            std::unique_lock<std::shared_mutex> lock(m_IncludeMutex);
+            IncludeEntry& entry = m_IncludeCache[path];
+            entry.WriteTime = writeTime;
+            entry.Contents = contents;
+            return contents;
+        }
+
+        // Quoted includes look next to the including file first, then fall
+        // through to the registered directories like bracketed ones; returns
+        // empty when nothing matched
+        std::string ResolveIncludePath(const std::string& requested, const std::string& requesting,
+                                       bool relativeFirst) const
+        {
+            namespace fs = std::filesystem;
+            std::error_code ec;
+
+            if (relativeFirst && !requesting.empty())
+            {
+                fs::path candidate = fs::path(requesting).parent_path() / requested;
+                if (fs::exists(candidate, ec))
+                    return candidate.string();
+            }
+
+            {
+                std::shared_lock<std::shared_mutex> lock(m_IncludeMutex);
+                for (const auto& dir : m_IncludeDirectories)
+                {
+                    fs::path candidate = fs::path(dir) / requested;
+                    if (fs::exists(candidate, ec))
+                        return candidate.string();
+                }
+            }
+
+            // Absolute or working-directory-relative paths as written
+            if (fs::exists(requested, ec))
+                return requested;
+            return {};
+        }
+
+        // shaderc includer backed by the cache above. One instance is owned
+        // by each materialized options object in the thread-local ring; the
+        // Impl it points at outlives every synchronous compile.
+        class Includer : public shaderc::CompileOptions::IncluderInterface
+        {
+        public:
+            explicit Includer(const Impl* impl) : m_Impl(impl) {}
+
+            shaderc_include_result* GetInclude(const char* requestedSource, shaderc_include_type type,
+                                               const char* requestingSource, size_t /*includeDepth*/) override
+            {
+                auto* holder = new IncludeHolder();
+
+                std::string resolved = m_Impl->ResolveIncludePath(
+                    requestedSource ? requestedSource : "",
+                    requestingSource ? requestingSource : "",
+                    type == shaderc_include_type_relative);
+
+                std::shared_ptr<const std::string> contents;
+                if (!resolved.empty())
+                    contents = m_Impl->GetIncludeContents(resolved);
+
+                if (contents)
+                {
+                    // The holder pins the cached contents; the cache handing
+                    // out shared_ptrs means an edit mid-compile swaps the
+                    // entry without invalidating text already in use
+                    holder->Name = std::move(resolved);
+                    holder->Contents = std::move(contents);
+                    holder->Result.source_name = holder->Name.c_str();
+                    holder->Result.source_name_length = holder->Name.size();
+                    holder->Result.content = holder->Contents->c_str();
+                    holder->Result.content_length = holder->Contents->size();
+                }
+                else
+                {
+                    // shaderc convention: empty source name marks failure and
+                    // the content carries the error message
+                    holder->Error = "Cannot open include file: ";
+                    holder->Error += requestedSource ? requestedSource : "";
+                    holder->Result.source_name = "";
+                    holder->Result.source_name_length = 0;
+                    holder->Result.content = holder->Error.c_str();
+                    holder->Result.content_length = holder->Error.size();
+                }
+
+                holder->Result.user_data = holder;
+                return &holder->Result;
+            }
+
+            void ReleaseInclude(shaderc_include_result* result) override
+            {
+                delete static_cast<IncludeHolder*>(result->user_data);
+            }
+
+        private:
+            struct IncludeHolder
+            {
+                shaderc_include_result Result{};
+                std::string Name;
+                std::string Error;
+                std::shared_ptr<const std::string> Contents;
+            };
+
+            const Impl* m_Impl;
+        };
+
+        void WatcherLoop()
+        {
+            std::unique_lock<std::mutex> lock(m_WatchMutex);
+            std::vector<std::string> dirs = m_WatchDirectories;
+            lock.unlock();
+
+            // Register kernel watches and take the write-time baseline once
+            // up front, so the loop below can skip quiet ticks outright
+            m_WatchNotifier.Watch(dirs);
+            ScanForChanges(dirs);
+
+            lock.lock();
+            while (!m_StopWatcher)
+            {
+                m_WatchCV.wait_for(lock, std::chrono::milliseconds(kHotReloadPollMillis));
+                if (m_StopWatcher)
+                    return;
+
+                dirs = m_WatchDirectories;
+                lock.unlock();
+                // Walk the directories only when the kernel saw write
+                // activity or a pending change is still debouncing
+                if (m_WatchNotifier.Wait(0) || !m_PendingChanges.empty())
+                    ScanForChanges(dirs);
+                lock.lock();
+            }
+        }
+
+        void ScanForChanges(const std::vector<std::string>& dirs)
+        {
+            namespace fs = std::filesystem;
+
+            for (const auto& dir : dirs)
+            {
+                std::error_code ec;
+                for (const auto& entry : fs::recursive_directory_iterator(dir, ec))
+                {
+                    if (!entry.is_regular_file(ec))
+                        continue;
+
+                    // Only watch files with a shader extension; editors drop
+                    // temp/backup files next to the real one on save
+                    ShaderStage stage;
+                    if (!ShaderStageFromExtension(entry.path().extension().string(), stage))
+                        continue;
+
+                    std::string path = entry.path().string();
+                    const uint64_t writeTime = GetFileWriteTime(path);
+                    if (writeTime == 0)
+                        continue;
+
+                    auto it = m_WatchedWriteTimes.find(path);
+                    if (it == m_WatchedWriteTimes.end())
+                    {
+                        // First sighting is the baseline, not a change
+                        m_WatchedWriteTimes.emplace(std::move(path), writeTime);
+                    }
+                    else if (it->second != writeTime)
+                    {
+                        it->second = writeTime;
+                        m_PendingChanges[std::move(path)] = writeTime;
+                    }
+                }
+            }
+
+            // Emit entries whose write time held still since last tick
+            std::vector<std::string> ready;
+            for (auto it = m_PendingChanges.begin(); it != m_PendingChanges.end();)
+            {
+                const uint64_t writeTime = GetFileWriteTime(it->first);
+                if (writeTime == it->second)
+                {
+                    ready.push_back(it->first);
+                    it = m_PendingChanges.erase(it);
+                }
+                else if (writeTime == 0)
+                {
+                    // Deleted between ticks (editor temp file)
+                    it = m_PendingChanges.erase(it);
+                }
+                else
+                {
+                    // Still being written; wait another interval
+                    it->second = writeTime;
+                    ++it;
+                }
+            }
+
+            for (const auto& path : ready)
+                RecompileOne(path);
+        }
+
+        void RecompileOne(const std::string& filePath)
+        {
+            ShaderCompileOptions options;
+            {
+                std::lock_guard<std::mutex> lock(m_SourceOptionsMutex);
+                auto it = m_SourceOptions.find(NormalizePathKey(filePath));
+                if (it != m_SourceOptions.end())
+                    options = it->second;
+            }
+
+            VX_CORE_INFO("Hot-reloading shader: {0}", filePath);
+            auto result = m_Owner->CompileFromFileShared(filePath, options);
 
-        // Statistics
-        mutable std::mutex m_StatsMutex;
-        Stats m_Stats;
+            ShaderLoadedCallback reloadCallback;
+            ShaderErrorCallback errorCallback;
+            {
+                std::lock_guard<std::mutex> lock(m_CallbackMutex);
+                reloadCallback = m_ReloadCallback;
+                errorCallback = m_ErrorCallback;
+            }
+
+            if (result.IsSuccess())
+            {
+                if (reloadCallback)
+                    reloadCallback(filePath, *result.GetValue());
+            }
+            else
+            {
+                VX_CORE_ERROR("Hot-reload compile failed for {0}: {1}", filePath, result.GetErrorMessage());
+                if (errorCallback)
+                {
+                    ShaderCompileError error;
+                    error.Message = result.GetErrorMessage();
+                    error.File = filePath;
+                    errorCallback(filePath, { error });
+                }
+            }
+        }
 
-        Impl() = default;
+        void StopWatcher()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_WatchMutex);
+                m_StopWatcher = true;
+            }
+            m_WatchCV.notify_all();
+            if (m_WatchThread.joinable())
+                m_WatchThread.join();
+            m_WatchThread = std::thread();
+            m_StopWatcher = false;
+            m_WatchedWriteTimes.clear();
+            m_PendingChanges.clear();
+            m_WatchNotifier.Close();
+        }
 
         // Normalize a path for use as a stable cache key across reloads (absolute, generic separators, lowercased)
         std::string NormalizePathKey(const std::string& path) const
@@ -136,7 +1635,98 @@ namespace Vortex
             }
         }
 
-        shaderc::CompileOptions CreateCompileOptions(const ShaderCompileOptions& options) const
+        // Key for the source→hash map: normalized path, '|', stage value.
+        // The stage is appended in place off a stack buffer, so building a
+        // key costs the one allocation NormalizePathKey already pays rather
+        // than the two extra temporaries an operator+ chain would make.
+        std::string MakeSourceKey(const std::string& sourceFile, ShaderStage stage) const
+        {
+            std::string key = NormalizePathKey(sourceFile);
+
+            char buffer[12];
+            auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int>(stage));
+            (void)ec;
+
+            key.reserve(key.size() + 1 + static_cast<size_t>(end - buffer));
+            key += '|';
+            key.append(buffer, end);
+            return key;
+        }
+
+        // Base (macro-free) shaderc option sets, cached by a fingerprint of
+        // the non-macro fields. Variants in a batch share one base, so the
+        // switch/branch setup below runs once per distinct configuration
+        // instead of once per compile; each compile gets a native shaderc
+        // clone of the base and adds only its own macros.
+        mutable std::mutex m_OptionsCacheMutex;
+        mutable std::unordered_map<uint64_t, shaderc::CompileOptions, IdentityU64Hash> m_OptionsCache;
+
+        // Fully materialized option sets (macros included), cached in a
+        // small per-thread ring. Compiles in a frame reuse a handful of
+        // distinct configurations, so the common path is a four-entry scan
+        // returning a reference - no mutex, no clone, no macro loop. The
+        // returned reference stays valid until this thread materializes
+        // kLocalOptionsCacheSize further distinct configurations.
+        struct LocalOptionsEntry
+        {
+            uint64_t Hash = 0;
+            std::optional<shaderc::CompileOptions> Options;
+        };
+        static constexpr size_t kLocalOptionsCacheSize = 4;
+        static thread_local std::array<LocalOptionsEntry, kLocalOptionsCacheSize> t_OptionsCache;
+        static thread_local size_t t_OptionsCacheNext;
+
+        const shaderc::CompileOptions& GetCompileOptions(const ShaderCompileOptions& options) const
+        {
+            StreamingHash fingerprint;
+            fingerprint.UpdateValue(static_cast<int32_t>(options.OptimizationLevel));
+            fingerprint.Update(options.TargetProfile);
+            fingerprint.UpdateByte(static_cast<uint8_t>((options.GenerateDebugInfo ? 1u : 0u) |
+                                                        (options.TreatWarningsAsErrors ? 2u : 0u)));
+            const uint64_t baseKey = fingerprint.Finish();
+
+            HashMacros(fingerprint, options.Macros);
+            const uint64_t fullKey = fingerprint.Finish();
+
+            for (auto& entry : t_OptionsCache)
+            {
+                if (entry.Hash == fullKey && entry.Options)
+                    return *entry.Options;
+            }
+
+            // Miss: clone the shared macro-free base and add this compile's
+            // macros, then park the result in the ring
+            shaderc::CompileOptions built = CloneBaseCompileOptions(baseKey, options);
+            const auto& macroNames = options.Macros.GetNames();
+            const auto& macroValues = options.Macros.GetValues();
+            for (size_t i = 0; i < macroNames.size(); ++i)
+            {
+                built.AddMacroDefinition(macroNames[i], macroValues[i]);
+            }
+
+            LocalOptionsEntry& slot = t_OptionsCache[t_OptionsCacheNext];
+            t_OptionsCacheNext = (t_OptionsCacheNext + 1) % kLocalOptionsCacheSize;
+            slot.Hash = fullKey;
+            slot.Options.emplace(built); // copy constructor wraps the native clone
+            // Set after the emplace so the includer's address is owned by
+            // the ring slot the compile actually uses, not the temporary
+            slot.Options->SetIncluder(std::make_unique<Includer>(this));
+            return *slot.Options;
+        }
+
+        shaderc::CompileOptions CloneBaseCompileOptions(uint64_t key, const ShaderCompileOptions& options) const
+        {
+            std::lock_guard<std::mutex> lock(m_OptionsCacheMutex);
+            auto it = m_OptionsCache.find(key);
+            if (it == m_OptionsCache.end())
+            {
+                it = m_OptionsCache.emplace(key, CreateBaseCompileOptions(options)).first;
+            }
+            // The copy constructor wraps shaderc_compile_options_clone
+            return it->second;
+        }
+
+        shaderc::CompileOptions CreateBaseCompileOptions(const ShaderCompileOptions& options) const
         {
             shaderc::CompileOptions shadercOptions;
 
@@ -184,257 +1774,483 @@ namespace Vortex
                 shadercOptions.SetWarningsAsErrors();
             }
 
-            // Macros
-            for (const auto& [name, value] : options.Macros)
-            {
-                shadercOptions.AddMacroDefinition(name, value);
-            }
-
-            // Include directories
-            // Note: shaderc doesn't support include directories directly,
-            // we'd need to implement a custom includer
+            // Include resolution is installed by GetCompileOptions on the
+            // final ring-slot options (the includer cannot survive the
+            // clone this base goes through)
 
             return shadercOptions;
         }
 
-        uint64_t ComputeShaderHash(const std::string& source, ShaderStage stage, const ShaderCompileOptions& options) const
+        uint64_t ComputeShaderHash(std::string_view source, ShaderStage stage, const ShaderCompileOptions& options) const
         {
-            std::stringstream ss;
-            ss << source;
-            ss << static_cast<int>(stage);
-            ss << static_cast<int>(options.OptimizationLevel);
-            ss << options.TargetProfile;
-            ss << options.GenerateDebugInfo;
-            ss << options.TreatWarningsAsErrors;
-            
-            for (const auto& [name, value] : options.Macros)
-            {
-                ss << name << "=" << value << ";";
-            }
-
-            return HashString(ss.str());
+            StreamingHash hash;
+            hash.Update(source);
+            hash.UpdateValue(static_cast<int32_t>(stage));
+            hash.UpdateValue(static_cast<int32_t>(options.OptimizationLevel));
+            hash.Update(options.TargetProfile);
+            hash.UpdateByte(static_cast<uint8_t>((options.GenerateDebugInfo ? 1u : 0u) |
+                                                 (options.TreatWarningsAsErrors ? 2u : 0u)));
+            HashMacros(hash, options.Macros);
+            // Same source+options compiled by a different toolchain build
+            // must hash differently, or its cache entries would look current
+            hash.UpdateValue(m_ToolchainTag);
+            return hash.Finish();
         }
 
-        std::string GetCacheFilePath(uint64_t hash, ShaderStage stage) const
+        // The per-toolchain subdirectory keeps caches from different builds
+        // side by side instead of overwriting each other. The three paths
+        // only change when SetCachingEnabled picks a directory, so they are
+        // formatted once there instead of concatenated on every probe.
+        std::string m_ToolchainCacheDirectory;
+        std::string m_PackDataPath;
+        std::string m_PackIndexPath;
+
+        void RebuildCachePaths()
         {
-            return m_CacheDirectory + "/" + std::to_string(hash) + "_" + GetShaderStageString(stage) + ".spv";
+            m_ToolchainCacheDirectory = m_CacheDirectory + "/" + m_ToolchainTagText;
+            m_PackDataPath = m_ToolchainCacheDirectory + "/" + kShaderPackDataFileName;
+            m_PackIndexPath = m_ToolchainCacheDirectory + "/" + kShaderPackIndexFileName;
         }
-        
-        std::string GetCacheInfoPath(uint64_t hash, ShaderStage stage) const
+
+        const std::string& GetToolchainCacheDirectory() const { return m_ToolchainCacheDirectory; }
+        const std::string& GetPackDataPath() const { return m_PackDataPath; }
+        const std::string& GetPackIndexPath() const { return m_PackIndexPath; }
+
+        // Subdirectories written by other toolchain builds are left alone at
+        // first - switching branches back and forth should not rebuild every
+        // shader - but once one has sat untouched this long it is almost
+        // certainly from a discarded build and gets removed.
+        static constexpr int kStaleToolchainCacheDays = 7;
+
+        void SweepStaleToolchainCaches() const
         {
-            return m_CacheDirectory + "/" + std::to_string(hash) + "_" + GetShaderStageString(stage) + ".info";
+            std::error_code ec;
+            const auto now = std::filesystem::file_time_type::clock::now();
+            for (const auto& entry : std::filesystem::directory_iterator(m_CacheDirectory, ec))
+            {
+                if (!entry.is_directory(ec) || entry.path().filename() == m_ToolchainTagText)
+                    continue;
+
+                const auto lastWrite = std::filesystem::last_write_time(entry.path(), ec);
+                if (ec)
+                    continue;
+
+                const auto age = std::chrono::duration_cast<std::chrono::hours>(now - lastWrite);
+                if (age.count() >= kStaleToolchainCacheDays * 24)
+                {
+                    std::filesystem::remove_all(entry.path(), ec);
+                    if (!ec)
+                        VX_CORE_INFO("Removed stale shader cache from old toolchain build: {0}", entry.path().string());
+                }
+            }
         }
         
-        bool IsSourceFileNewer(const std::string& sourceFile, const std::string& cacheFile) const
+        // In-memory directory over the packed cache files, built once per
+        // run by EnsurePackLoaded. The data mapping is taken at load time
+        // and never remapped: records appended during this run are served
+        // by the in-memory cache anyway, and a positioned read covers the
+        // rare case of reading one back after a memory-only ClearCache.
+        struct PackDirEntry
         {
-            if (sourceFile.empty() || !std::filesystem::exists(sourceFile))
-                return false;
-                
-            if (!std::filesystem::exists(cacheFile))
-                return true;
-                
-            try
+            uint64_t DataOffset = 0;
+            uint64_t WriteTime = 0;
+            uint32_t Stage = 0;
+            uint32_t SpirvWords = 0;
+            uint32_t ReflectionBytes = 0;
+        };
+        mutable std::mutex m_PackMutex;
+        mutable std::atomic<bool> m_PackLoaded{ false };
+        mutable std::unordered_map<uint64_t, PackDirEntry, IdentityU64Hash> m_PackDirectory;
+        mutable std::unique_ptr<MappedFile> m_PackData;
+        mutable uint64_t m_PackDataSize = 0;       // includes this run's appends
+        mutable bool m_PackIndexHasHeader = false; // first append must write the header
+
+        void EnsurePackLoaded() const
+        {
+            if (m_PackLoaded.load(std::memory_order_acquire))
+                return;
+
+            std::lock_guard<std::mutex> lock(m_PackMutex);
+            if (m_PackLoaded.load(std::memory_order_relaxed))
+                return;
+
+            m_PackData = std::make_unique<MappedFile>(GetPackDataPath(), 1);
+            if (m_PackData->IsMapped())
             {
-                auto sourceTime = std::filesystem::last_write_time(sourceFile);
-                auto cacheTime = std::filesystem::last_write_time(cacheFile);
-                return sourceTime > cacheTime;
+                m_PackDataSize = m_PackData->GetSize();
             }
-            catch (const std::exception& e)
+            else
+            {
+                std::error_code ec;
+                const auto size = std::filesystem::file_size(GetPackDataPath(), ec);
+                m_PackDataSize = ec ? 0 : static_cast<uint64_t>(size);
+            }
+
+            // One buffered read pulls in the whole index; a header mismatch
+            // discards it and the cache rebuilds through recompiles
+            const std::string index = ReadFileToString(GetPackIndexPath());
+            if (index.size() >= sizeof(ShaderPackHeader) &&
+                (index.size() - sizeof(ShaderPackHeader)) % sizeof(ShaderPackRecord) == 0)
             {
-                VX_CORE_WARN("Failed to compare file timestamps: {0}", e.what());
-                return true; // Assume source is newer on error
+                ShaderPackHeader header{};
+                std::memcpy(&header, index.data(), sizeof(header));
+                if (header.Magic == kShaderPackMagic && header.Version == kShaderPackVersion)
+                {
+                    m_PackIndexHasHeader = true;
+                    const size_t recordCount = (index.size() - sizeof(header)) / sizeof(ShaderPackRecord);
+                    m_PackDirectory.reserve(recordCount);
+                    for (size_t i = 0; i < recordCount; ++i)
+                    {
+                        ShaderPackRecord record{};
+                        std::memcpy(&record, index.data() + sizeof(header) + i * sizeof(record), sizeof(record));
+
+                        const uint64_t totalBytes = static_cast<uint64_t>(record.SpirvWords) * sizeof(uint32_t) + record.ReflectionBytes;
+                        if (record.DataOffset + totalBytes > m_PackDataSize)
+                            continue; // truncated data file: drop the orphan record
+
+                        // Later records win, so a recompiled shader shadows
+                        // its superseded entry
+                        m_PackDirectory[record.Hash] = { record.DataOffset, record.WriteTime,
+                                                         record.Stage, record.SpirvWords, record.ReflectionBytes };
+                    }
+                    VX_CORE_TRACE("Loaded shader pack index: {0} entries", m_PackDirectory.size());
+                }
             }
+
+            m_PackLoaded.store(true, std::memory_order_release);
         }
 
-        bool LoadFromCache(uint64_t hash, ShaderStage stage, CompiledShader& outShader, const std::string& sourceFile = "") const
+        // Record-based staleness: the append stamped its record with the
+        // write time, so no cache-side stat is needed. A hash with no
+        // record was compiled from the caller's current source this run
+        // and cannot be stale.
+        bool IsSourceNewerThanRecord(const std::string& sourceFile, uint64_t hash) const
         {
-            if (!m_CachingEnabled)
+            if (sourceFile.empty())
+                return false;
+
+            const uint64_t sourceTime = GetFileWriteTime(sourceFile);
+            if (sourceTime == 0)
+                return false; // Missing/unreadable source: keep using the cache
+
+            std::lock_guard<std::mutex> lock(m_PackMutex);
+            auto it = m_PackDirectory.find(hash);
+            if (it == m_PackDirectory.end())
                 return false;
+            return sourceTime > it->second.WriteTime;
+        }
+
+        // Memory-only probe: no stat, no disk. Safe without a staleness
+        // check because the hash covers the full source text and options —
+        // an edited source hashes differently and simply misses here
+        std::shared_ptr<const CompiledShader> TryLoadFromMemory(uint64_t hash) const
+        {
+            if (!m_CachingEnabled)
+                return nullptr;
+
+            if (auto local = TryLocalCache(hash))
+                return local;
+
+            CacheShard& shard = ShardFor(hash);
+            std::shared_ptr<const CompiledShader> found;
+            {
+                std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+                found = shard.Shaders.Find(hash);
+            }
+            if (found)
+                StoreInLocalCache(hash, found);
+            return found;
+        }
+
+        std::shared_ptr<const CompiledShader> LoadFromCache(uint64_t hash, ShaderStage stage, const std::string& sourceFile = "") const
+        {
+            if (!m_CachingEnabled)
+                return nullptr;
 
-            // Check memory cache first
+            // Per-thread fast path: repeat lookups skip the shard lock entirely
+            if (auto local = TryLocalCache(hash))
+                return local;
+
+            // First call per run maps the pack and reads the index; every
+            // call after that is a relaxed atomic load
+            EnsurePackLoaded();
+
+            // Check memory cache first; staleness is only checked after a
+            // hit, so a memory miss costs zero stat syscalls here. A hit
+            // only bumps the refcount instead of deep-copying the SPIR-V
+            // under the lock.
             {
-                std::shared_lock<std::shared_mutex> lock(m_CacheMutex);
-                auto it = m_ShaderCache.find(hash);
-                if (it != m_ShaderCache.end())
+                CacheShard& shard = ShardFor(hash);
+                std::shared_ptr<const CompiledShader> found;
+                {
+                    std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+                    found = shard.Shaders.Find(hash);
+                }
+                if (found)
                 {
-                    // Check if source file is newer than cached version
-                    if (!sourceFile.empty() && IsSourceFileNewer(sourceFile, GetCacheFilePath(hash, stage)))
+                    if (!IsSourceNewerThanRecord(sourceFile, hash))
                     {
-                        // Invalidate memory cache
-                        const_cast<std::unordered_map<uint64_t, CompiledShader>&>(m_ShaderCache).erase(hash);
+                        StoreInLocalCache(hash, found);
+                        return found;
                     }
-                    else
+
+                    // Invalidate memory cache (acquired exclusively; erasing
+                    // under the shared lock would race other readers)
                     {
-                        outShader = it->second;
-                        return true;
+                        std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                        shard.Shaders.Erase(hash);
                     }
+                    InvalidateLocalCaches();
+                    VX_CORE_TRACE("Source file is newer than cache, recompiling shader");
+                    return nullptr;
                 }
             }
 
-            // Check disk cache
-            std::string cacheFile = GetCacheFilePath(hash, stage);
-            std::string infoFile = GetCacheInfoPath(hash, stage);
-            
-            if (!std::filesystem::exists(cacheFile) || !std::filesystem::exists(infoFile))
-                return false;
-                
-            // Check if source file is newer than cache
-            if (!sourceFile.empty() && IsSourceFileNewer(sourceFile, cacheFile))
+            // Disk cache: a map lookup against the pack directory instead of
+            // a per-shader open; a hit memcpys straight out of the mapping
+            PackDirEntry record;
             {
-                VX_CORE_TRACE("Source file is newer than cache, recompiling shader");
-                return false;
+                std::lock_guard<std::mutex> lock(m_PackMutex);
+                auto it = m_PackDirectory.find(hash);
+                if (it == m_PackDirectory.end())
+                    return nullptr;
+                record = it->second;
+            }
+
+            if (record.Stage != static_cast<uint32_t>(stage))
+                return nullptr; // hash collision across stages; treat as a miss
+
+            // Source edited since the record was appended? One stat, paid
+            // only on the first touch of an entry per run
+            if (!sourceFile.empty())
+            {
+                const uint64_t sourceTime = GetFileWriteTime(sourceFile);
+                if (sourceTime != 0 && sourceTime > record.WriteTime)
+                {
+                    VX_CORE_TRACE("Source file is newer than cache, recompiling shader");
+                    return nullptr;
+                }
             }
 
             try
             {
-                // Load SPIR-V from .spv file
-                std::ifstream spirvFile(cacheFile, std::ios::binary);
-                if (!spirvFile.is_open())
-                    return false;
+                const size_t spirvBytes = static_cast<size_t>(record.SpirvWords) * sizeof(uint32_t);
+                const size_t totalBytes = spirvBytes + record.ReflectionBytes;
 
-                // Get file size
-                spirvFile.seekg(0, std::ios::end);
-                size_t fileSize = spirvFile.tellg();
-                spirvFile.seekg(0, std::ios::beg);
-                
-                // Read SPIR-V data directly
-                outShader.SpirV.resize(fileSize / sizeof(uint32_t));
-                spirvFile.read(reinterpret_cast<char*>(outShader.SpirV.data()), fileSize);
-                spirvFile.close();
-
-                // Load reflection data from .info file
-                std::ifstream infoFileStream(infoFile, std::ios::binary);
-                if (infoFileStream.is_open())
-                {
-                    // Read reflection data size and content
-                    uint32_t reflectionSize;
-                    infoFileStream.read(reinterpret_cast<char*>(&reflectionSize), sizeof(reflectionSize));
-                    
-                    if (reflectionSize > 0)
-                    {
-                        std::string reflectionJson(reflectionSize, '\0');
-                        infoFileStream.read(&reflectionJson[0], reflectionSize);
-                        
-                        // Parse reflection data from JSON (simplified - in real implementation use proper JSON)
-                        // For now, just mark as valid but empty reflection
-                        outShader.Reflection = {};
-                    }
-                    infoFileStream.close();
+                std::vector<uint8_t> fileBuffer;
+                const uint8_t* data = nullptr;
+                if (m_PackData && m_PackData->IsMapped() &&
+                    record.DataOffset + totalBytes <= m_PackData->GetSize())
+                {
+                    data = reinterpret_cast<const uint8_t*>(m_PackData->GetData()) + record.DataOffset;
+                }
+                else
+                {
+                    // Appended after the mapping was taken (reachable only
+                    // after a memory-only ClearCache): one positioned read
+                    std::ifstream file(GetPackDataPath(), std::ios::binary);
+                    if (!file.is_open())
+                        return nullptr;
+
+                    file.seekg(static_cast<std::streamoff>(record.DataOffset));
+                    fileBuffer.resize(totalBytes);
+                    file.read(reinterpret_cast<char*>(fileBuffer.data()), static_cast<std::streamsize>(totalBytes));
+                    if (!file)
+                        return nullptr;
+                    data = fileBuffer.data();
+                }
+
+                CompiledShader loaded;
+                loaded.SpirV.resize(record.SpirvWords);
+                std::memcpy(loaded.SpirV.data(), data, spirvBytes);
+
+                if (!DeserializeReflection(data + spirvBytes, record.ReflectionBytes, loaded.Reflection))
+                {
+                    VX_CORE_WARN("Corrupt reflection blob in shader pack (hash: {0})", hash);
+                    return nullptr;
                 }
 
-                outShader.Stage = stage;
-                outShader.Status = ShaderCompileStatus::Success;
-                outShader.SourceHash = hash;
-                outShader.SourceFile = sourceFile;
+                loaded.Stage = stage;
+                loaded.Status = ShaderCompileStatus::Success;
+                loaded.SourceHash = hash;
+                loaded.SourceFile = sourceFile;
+
+                auto entry = std::make_shared<const CompiledShader>(std::move(loaded));
 
                 // Store in memory cache and update source mapping
                 {
-                    std::unique_lock<std::shared_mutex> lock(m_CacheMutex);
-                    m_ShaderCache[hash] = outShader;
-                    if (!outShader.SourceFile.empty())
-                    {
-                        std::string sourceKey = NormalizePathKey(outShader.SourceFile) + "|" + std::to_string(static_cast<int>(outShader.Stage));
-                        m_SourceStageToHash[sourceKey] = hash;
-                    }
+                    CacheShard& shard = ShardFor(hash);
+                    std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                    shard.Shaders.InsertOrAssign(hash, entry);
+                }
+                if (!entry->SourceFile.empty())
+                {
+                    std::string sourceKey = MakeSourceKey(entry->SourceFile, entry->Stage);
+                    SourceShard& shard = SourceShardFor(sourceKey);
+                    std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                    shard.SourceStageToHash[sourceKey] = hash;
                 }
 
-                VX_CORE_TRACE("Loaded SPIR-V shader from cache: {0}", cacheFile);
-                return true;
+                StoreInLocalCache(hash, entry);
+
+                VX_CORE_TRACE("Loaded SPIR-V shader from pack cache (hash: {0})", hash);
+                return entry;
             }
             catch (const std::exception& e)
             {
                 VX_CORE_ERROR("Failed to load shader from cache: {0}", e.what());
-                return false;
+                return nullptr;
             }
         }
 
-        void SaveToCache(uint64_t hash, const CompiledShader& shader) const
+        // Takes the entry by shared_ptr so the compile path can build the
+        // shader once and share that one allocation between the cache, the
+        // name cache, in-flight waiters, and the writer thread - instead of
+        // deep-copying the SPIR-V payload for each of them
+        void SaveToCache(uint64_t hash, std::shared_ptr<const CompiledShader> entry) const
         {
             if (!m_CachingEnabled)
                 return;
 
+            const CompiledShader& shader = *entry;
+
             // Save to memory cache and update source mapping
             uint64_t prevHashForSource = 0;
-            std::string sourceKey;
             {
-                std::unique_lock<std::shared_mutex> lock(m_CacheMutex);
-                m_ShaderCache[hash] = shader;
-                if (!shader.SourceFile.empty())
+                CacheShard& shard = ShardFor(hash);
+                std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                shard.Shaders.InsertOrAssign(hash, entry);
+            }
+            if (!shader.SourceFile.empty())
+            {
+                // Normalized so it lands in the same shard (and map slot) as
+                // the key LoadFromCache builds for the same file
+                std::string sourceKey = MakeSourceKey(shader.SourceFile, shader.Stage);
+                SourceShard& shard = SourceShardFor(sourceKey);
+                std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                auto it = shard.SourceStageToHash.find(sourceKey);
+                if (it != shard.SourceStageToHash.end()) prevHashForSource = it->second;
+                shard.SourceStageToHash[sourceKey] = hash;
+            }
+
+            // Drop the stale memory entry synchronously so lookups in this
+            // process can't see it; the file work rides the writer thread
+            if (prevHashForSource != 0 && prevHashForSource != hash)
+            {
                 {
-                    sourceKey = shader.SourceFile + "|" + std::to_string(static_cast<int>(shader.Stage));
-                    auto it = m_SourceStageToHash.find(sourceKey);
-                    if (it != m_SourceStageToHash.end()) prevHashForSource = it->second;
-                    m_SourceStageToHash[sourceKey] = hash;
+                    CacheShard& shard = ShardFor(prevHashForSource);
+                    std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+                    shard.Shaders.Erase(prevHashForSource);
                 }
+                InvalidateLocalCaches();
             }
 
-            // Save to disk cache
+            // The disk write is not needed by anything in this process — the
+            // memory cache is already current — so it happens fire-and-forget
+            // on the IO thread. A superseded pack record just stops being
+            // referenced once the new one lands; the dead bytes stay in the
+            // data file until ClearCache(true) rebuilds it.
+            CacheWriteJob job;
+            job.Hash = hash;
+            job.Stage = shader.Stage;
+            job.Shader = std::move(entry);
+            EnqueueCacheWrite(std::move(job));
+        }
+
+        // Append one compiled shader to the pack: payload bytes onto the data
+        // file, then the fixed-size record onto the index. Only the writer
+        // thread calls this, so the end-of-data offset read here is the one
+        // the append lands at.
+        void AppendCacheRecord(const CacheWriteJob& job) const
+        {
+            const CompiledShader& shader = *job.Shader;
+
             try
             {
-                std::filesystem::create_directories(m_CacheDirectory);
-                std::string cacheFile = GetCacheFilePath(hash, shader.Stage);
-                std::string infoFile = GetCacheInfoPath(hash, shader.Stage);
-                
-                // Write SPIR-V data to .spv file
-                std::ofstream spirvFileStream(cacheFile, std::ios::binary);
-                if (!spirvFileStream.is_open())
+                std::filesystem::create_directories(GetToolchainCacheDirectory());
+                EnsurePackLoaded();
+
+                std::vector<uint8_t> reflectionBlob = SerializeReflection(shader.Reflection);
+                const size_t spirvBytes = shader.SpirV.size() * sizeof(uint32_t);
+                const size_t totalBytes = spirvBytes + reflectionBlob.size();
+
+                uint64_t offset = 0;
                 {
-                    VX_CORE_ERROR("Failed to open SPIR-V cache file for writing: {0}", cacheFile);
+                    std::lock_guard<std::mutex> lock(m_PackMutex);
+                    offset = m_PackDataSize;
+                }
+
+                const FileWriteSpan dataSpans[] = {
+                    { shader.SpirV.data(), spirvBytes },
+                    { reflectionBlob.data(), reflectionBlob.size() },
+                };
+                if (!WriteFileSpans(GetPackDataPath(), dataSpans, 2, /*append*/ true))
+                {
+                    VX_CORE_ERROR("Failed to append to shader pack data file: {0}", GetPackDataPath());
                     return;
                 }
 
-                // Write raw SPIR-V data
-                spirvFileStream.write(reinterpret_cast<const char*>(shader.SpirV.data()), 
-                                    shader.SpirV.size() * sizeof(uint32_t));
-                spirvFileStream.close();
+                ShaderPackRecord record;
+                record.Hash = job.Hash;
+                record.DataOffset = offset;
+                record.WriteTime = GetCurrentFileTime();
+                record.Stage = static_cast<uint32_t>(job.Stage);
+                record.SpirvWords = static_cast<uint32_t>(shader.SpirV.size());
+                record.ReflectionBytes = static_cast<uint32_t>(reflectionBlob.size());
+
+                // First record of a fresh index carries the header in the
+                // same append, so the file is never headerless on disk
+                bool wroteIndex = false;
+                if (!m_PackIndexHasHeader)
+                {
+                    ShaderPackHeader header;
+                    header.Magic = kShaderPackMagic;
+                    header.Version = kShaderPackVersion;
+                    const FileWriteSpan indexSpans[] = {
+                        { &header, sizeof(header) },
+                        { &record, sizeof(record) },
+                    };
+                    wroteIndex = WriteFileSpans(GetPackIndexPath(), indexSpans, 2, /*append*/ true);
+                }
+                else
+                {
+                    const FileWriteSpan indexSpans[] = { { &record, sizeof(record) } };
+                    wroteIndex = WriteFileSpans(GetPackIndexPath(), indexSpans, 1, /*append*/ true);
+                }
+                if (!wroteIndex)
+                {
+                    VX_CORE_ERROR("Failed to append to shader pack index file: {0}", GetPackIndexPath());
+                    return;
+                }
 
-                // Write reflection data to .info file
-                std::ofstream infoFileStream(infoFile, std::ios::binary);
-                if (infoFileStream.is_open())
                 {
-                    // For now, write a placeholder for reflection data
-                    // In a real implementation, serialize the reflection data to JSON or binary format
-                    std::string reflectionPlaceholder = "{}";
-                    uint32_t reflectionSize = static_cast<uint32_t>(reflectionPlaceholder.size());
-                    
-                    infoFileStream.write(reinterpret_cast<const char*>(&reflectionSize), sizeof(reflectionSize));
-                    infoFileStream.write(reflectionPlaceholder.c_str(), reflectionSize);
-                    infoFileStream.close();
+                    std::lock_guard<std::mutex> lock(m_PackMutex);
+                    m_PackDataSize = offset + totalBytes;
+                    PackDirEntry& entry = m_PackDirectory[job.Hash];
+                    entry.DataOffset = record.DataOffset;
+                    entry.WriteTime = record.WriteTime;
+                    entry.Stage = record.Stage;
+                    entry.SpirvWords = record.SpirvWords;
+                    entry.ReflectionBytes = record.ReflectionBytes;
+                    m_PackIndexHasHeader = true;
                 }
-                
-                VX_CORE_TRACE("Saved SPIR-V shader to cache: {0}", cacheFile);
+
+                VX_CORE_TRACE("Appended SPIR-V shader to pack cache (hash: {0}, {1} bytes)", job.Hash, totalBytes);
             }
             catch (const std::exception& e)
             {
                 VX_CORE_ERROR("Failed to save shader to cache: {0}", e.what());
             }
-
-            // Prune stale cache entry for the same source+stage (if any and different hash)
-            if (prevHashForSource != 0 && prevHashForSource != hash)
-            {
-                try
-                {
-                    std::string oldCache = GetCacheFilePath(prevHashForSource, shader.Stage);
-                    std::string oldInfo = GetCacheInfoPath(prevHashForSource, shader.Stage);
-                    std::error_code ec;
-                    if (std::filesystem::exists(oldCache, ec)) std::filesystem::remove(oldCache, ec);
-                    if (std::filesystem::exists(oldInfo, ec)) std::filesystem::remove(oldInfo, ec);
-
-                    // Also drop old entry from memory cache
-                    {
-                        std::unique_lock<std::shared_mutex> lock(m_CacheMutex);
-                        m_ShaderCache.erase(prevHashForSource);
-                    }
-                    VX_CORE_TRACE("Pruned stale shader cache for source '{0}' (old hash {1})", shader.SourceFile, prevHashForSource);
-                }
-                catch (const std::exception& e)
-                {
-                    VX_CORE_WARN("Failed to prune old shader cache entries: {0}", e.what());
-                }
-            }
         }
     };
 
+    thread_local std::array<ShaderCompiler::Impl::LocalCacheEntry, ShaderCompiler::Impl::kLocalCacheSize> ShaderCompiler::Impl::t_LocalCache;
+    thread_local size_t ShaderCompiler::Impl::t_LocalCacheNext = 0;
+    thread_local std::array<ShaderCompiler::Impl::LocalCacheEntry, ShaderCompiler::Impl::kLocalCacheSize> ShaderCompiler::Impl::t_NameLocalCache;
+    thread_local size_t ShaderCompiler::Impl::t_NameLocalCacheNext = 0;
+    thread_local std::array<ShaderCompiler::Impl::LocalOptionsEntry, ShaderCompiler::Impl::kLocalOptionsCacheSize> ShaderCompiler::Impl::t_OptionsCache;
+    thread_local size_t ShaderCompiler::Impl::t_OptionsCacheNext = 0;
+
     // ============================================================================
     // ShaderCompiler Implementation
     // ============================================================================
@@ -442,6 +2258,7 @@ namespace Vortex
     ShaderCompiler::ShaderCompiler()
         : m_Impl(std::make_unique<Impl>())
     {
+        m_Impl->m_Owner = this;
         VX_CORE_INFO("ShaderCompiler created");
     }
 
@@ -450,39 +2267,92 @@ namespace Vortex
         VX_CORE_INFO("ShaderCompiler destroyed");
     }
 
-    Result<CompiledShader> ShaderCompiler::CompileFromSource(const std::string& source, 
-                                                             ShaderStage stage, 
-                                                             const ShaderCompileOptions& options,
-                                                             const std::string& filename)
+    Result<std::shared_ptr<const CompiledShader>> ShaderCompiler::CompileFromSourceShared(std::string_view source,
+                                                                                          ShaderStage stage,
+                                                                                          const ShaderCompileOptions& options,
+                                                                                          const std::string& filename)
     {
-        if (source.empty())
+        using SharedResult = Result<std::shared_ptr<const CompiledShader>>;
+
+        if (source.empty()) [[unlikely]]
+        {
+            return SharedResult(ErrorCode::InvalidParameter, "Empty shader source code");
+        }
+
+        // Name-keyed probe first: one stat and an O(options) hash instead of
+        // hashing the whole source. Only possible when a filename is given.
+        uint64_t nameHash = 0;
+        if (!filename.empty() && m_Impl->m_CachingEnabled)
         {
-            return Result<CompiledShader>(ErrorCode::InvalidParameter, "Empty shader source code");
+            const uint64_t writeTime = GetFileWriteTime(filename);
+            if (writeTime != 0)
+            {
+                nameHash = m_Impl->ComputeNameHash(filename, stage, options, writeTime);
+                if (auto byName = m_Impl->TryNameCache(nameHash)) [[likely]]
+                {
+                    m_Impl->m_Stats.CacheHits.fetch_add(1, std::memory_order_relaxed);
+                    VX_CORE_TRACE("Loaded shader from name cache: {0}", filename);
+                    return SharedResult(std::move(byName));
+                }
+            }
         }
 
         // Compute hash for caching
         uint64_t hash = m_Impl->ComputeShaderHash(source, stage, options);
 
         // Try loading from cache first (pass filename for timestamp checking)
-        CompiledShader cachedShader;
-        if (m_Impl->LoadFromCache(hash, stage, cachedShader, filename))
+        // In a warmed-up session almost every request resolves here; steer
+        // codegen so the compile-and-cache tail stays off the hot path
+        if (auto cachedShader = m_Impl->LoadFromCache(hash, stage, filename)) [[likely]]
         {
-            std::lock_guard<std::mutex> lock(m_Impl->m_StatsMutex);
-            m_Impl->m_Stats.CacheHits++;
+            m_Impl->m_Stats.CacheHits.fetch_add(1, std::memory_order_relaxed);
+            m_Impl->StoreInNameCache(nameHash, cachedShader);
             VX_CORE_TRACE("Loaded shader from cache (hash: {0})", hash);
-            return Result<CompiledShader>(std::move(cachedShader));
+            return SharedResult(std::move(cachedShader));
+        }
+
+        // Single-flight: if another thread is already compiling this exact
+        // hash, wait for its result instead of duplicating the work
+        bool isLeader = false;
+        std::shared_ptr<Impl::InFlightEntry> flight;
+        {
+            std::lock_guard<std::mutex> lock(m_Impl->m_InFlightMutex);
+            auto it = m_Impl->m_InFlight.find(hash);
+            if (it != m_Impl->m_InFlight.end())
+            {
+                flight = it->second;
+            }
+            else
+            {
+                flight = std::make_shared<Impl::InFlightEntry>();
+                m_Impl->m_InFlight.emplace(hash, flight);
+                isLeader = true;
+            }
+        }
+
+        if (!isLeader)
+        {
+            std::unique_lock<std::mutex> lock(flight->Mutex);
+            flight->CV.wait(lock, [&] { return flight->Done; });
+            if (flight->Shader)
+            {
+                VX_CORE_TRACE("Joined in-flight shader compilation (hash: {0})", hash);
+                return SharedResult(flight->Shader);
+            }
+            return SharedResult(flight->Error, flight->ErrorMessage);
         }
 
         // Compile shader
-        auto shadercOptions = m_Impl->CreateCompileOptions(options);
+        const shaderc::CompileOptions& shadercOptions = m_Impl->GetCompileOptions(options);
         shaderc_shader_kind shadercKind = GetShadercKind(stage);
 
         std::string actualFilename = filename.empty() ? "shader" : m_Impl->NormalizePathKey(filename);
 
-        auto compilationResult = m_Impl->m_Compiler.CompileGlslToSpv(
-            source, 
-            shadercKind, 
-            actualFilename.c_str(), 
+        auto compilationResult = Impl::GetThreadCompiler().CompileGlslToSpv(
+            source.data(),
+            source.size(),
+            shadercKind,
+            actualFilename.c_str(),
             shadercOptions
         );
 
@@ -490,11 +2360,26 @@ namespace Vortex
         {
             std::string errorMsg = compilationResult.GetErrorMessage();
             VX_CORE_ERROR("Shader compilation failed: {0}", errorMsg);
-            
-            std::lock_guard<std::mutex> lock(m_Impl->m_StatsMutex);
-            m_Impl->m_Stats.CompilationErrors++;
-            
-            return Result<CompiledShader>(ErrorCode::ShaderCompilationFailed, "Shader compilation failed: " + errorMsg);
+
+            m_Impl->m_Stats.CompilationErrors.fetch_add(1, std::memory_order_relaxed);
+
+            std::string fullError = "Shader compilation failed: " + errorMsg;
+            m_Impl->FinishInFlight(hash, flight, nullptr, ErrorCode::ShaderCompilationFailed, fullError);
+            return SharedResult(ErrorCode::ShaderCompilationFailed, std::move(fullError));
+        }
+
+        // Validate straight off shaderc's output buffer, while the words
+        // are still cache-resident; the copy below then re-reads the same
+        // hot buffer instead of paying a separate cold pass later
+        const size_t spirvWordCount = static_cast<size_t>(compilationResult.cend() - compilationResult.cbegin());
+        if (options.EnableValidation && !ValidateSpirV(compilationResult.cbegin(), spirvWordCount))
+        {
+            m_Impl->m_Stats.CompilationErrors.fetch_add(1, std::memory_order_relaxed);
+
+            std::string fullError = "Shader compilation produced malformed SPIR-V: " + actualFilename;
+            VX_CORE_ERROR("{0}", fullError);
+            m_Impl->FinishInFlight(hash, flight, nullptr, ErrorCode::ShaderCompilationFailed, fullError);
+            return SharedResult(ErrorCode::ShaderCompilationFailed, std::move(fullError));
         }
 
         // Create compiled shader
@@ -517,83 +2402,125 @@ namespace Vortex
             VX_CORE_WARN("Shader reflection failed: {0}", reflectionResult.GetErrorMessage());
         }
 
-        // Cache the compiled shader (also updates mapping and prunes previous cache for this source)
-        m_Impl->SaveToCache(hash, compiledShader);
+        // One shared allocation serves every consumer: the memory cache, the
+        // name cache, in-flight waiters, and the background disk write all
+        // take references to this entry instead of their own SPIR-V copies
+        auto sharedResult = std::make_shared<const CompiledShader>(std::move(compiledShader));
+        m_Impl->SaveToCache(hash, sharedResult);
+        m_Impl->StoreInNameCache(nameHash, sharedResult);
+        m_Impl->FinishInFlight(hash, flight, sharedResult, ErrorCode::Success, "");
 
         // Update statistics
-        {
-            std::lock_guard<std::mutex> lock(m_Impl->m_StatsMutex);
-            m_Impl->m_Stats.ShadersCompiled++;
-            m_Impl->m_Stats.CacheMisses++;
-        }
+        m_Impl->m_Stats.ShadersCompiled.fetch_add(1, std::memory_order_relaxed);
+        m_Impl->m_Stats.CacheMisses.fetch_add(1, std::memory_order_relaxed);
 
         VX_CORE_INFO("Compiled {0} shader successfully (hash: {1})", GetShaderStageString(stage), hash);
 
-        return Result<CompiledShader>(std::move(compiledShader));
+        return SharedResult(std::move(sharedResult));
     }
 
-    Result<CompiledShader> ShaderCompiler::CompileFromFile(const std::string& filePath, 
-                                                          const ShaderCompileOptions& options)
+    Result<CompiledShader> ShaderCompiler::CompileFromSource(std::string_view source,
+                                                             ShaderStage stage,
+                                                             const ShaderCompileOptions& options,
+                                                             const std::string& filename)
     {
-        if (!std::filesystem::exists(filePath))
+        // The by-value result API forces one copy; it happens here, at the
+        // boundary, so every internal consumer shares the one allocation
+        auto shared = CompileFromSourceShared(source, stage, options, filename);
+        if (!shared.IsSuccess())
         {
-            return Result<CompiledShader>(ErrorCode::FileNotFound, "Shader file not found: " + filePath);
+            return Result<CompiledShader>(shared.GetErrorCode(), shared.GetErrorMessage());
         }
+        return Result<CompiledShader>(CompiledShader(*shared.GetValue()));
+    }
 
-        std::string source = ReadFileToString(filePath);
-        if (source.empty())
+    Result<std::shared_ptr<const CompiledShader>> ShaderCompiler::CompileFromFileShared(const std::string& filePath,
+                                                                                        const ShaderCompileOptions& options)
+    {
+        using SharedResult = Result<std::shared_ptr<const CompiledShader>>;
+
+        // Compile straight out of the mapping - string_view flows through
+        // the whole pipeline (hashing and shaderc both take pointer+size),
+        // so large sources are never copied into an owned string. Small or
+        // unmappable files fall back to one buffered read. The mapping
+        // outlives the synchronous CompileFromSource call below.
+        MappedFile mapped(filePath, kMappedReadThreshold);
+        std::string fallback;
+        std::string_view source;
+        if (mapped.IsMapped())
+        {
+            source = std::string_view(mapped.GetData(), mapped.GetSize());
+        }
+        else
         {
-            return Result<CompiledShader>(ErrorCode::FileCorrupted, "Failed to read shader file or file is empty: " + filePath);
+            fallback = ReadFileToString(filePath);
+            source = fallback;
         }
 
-        // Determine stage from file extension
-        ShaderStage stage;
+        if (source.empty())
         {
-            std::string extension = std::filesystem::path(filePath).extension().string();
-            std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-
-            if (extension == ".vert" || extension == ".vs")
-                stage = ShaderStage::Vertex;
-            else if (extension == ".frag" || extension == ".fs")
-                stage = ShaderStage::Fragment;
-            else if (extension == ".geom" || extension == ".gs")
-                stage = ShaderStage::Geometry;
-            else if (extension == ".tesc" || extension == ".tcs")
-                stage = ShaderStage::TessellationControl;
-            else if (extension == ".tese" || extension == ".tes")
-                stage = ShaderStage::TessellationEvaluation;
-            else if (extension == ".comp" || extension == ".cs")
-                stage = ShaderStage::Compute;
-            else
+            // Cold path: only now is it worth a stat to tell the two apart
+            if (!std::filesystem::exists(filePath))
             {
-return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine shader stage from file extension: " + extension);
+                return SharedResult(ErrorCode::FileNotFound, "Shader file not found: " + filePath);
             }
+            return SharedResult(ErrorCode::FileCorrupted, "Failed to read shader file or file is empty: " + filePath);
         }
 
-        auto result = CompileFromSource(source, stage, options, m_Impl->NormalizePathKey(filePath));
-        if (result.IsSuccess())
+        // Determine stage from file extension; the view slices the path in
+        // place, so no std::filesystem::path or string is materialized
+        ShaderStage stage;
         {
-            // Store file path for hot-reload
-            CompiledShader& shader = const_cast<CompiledShader&>(result.GetValue());
-            shader.SourceFile = m_Impl->NormalizePathKey(filePath);
-            // Ensure cache mapping is updated as soon as we have a compiled shader
-            if (m_Impl->m_CachingEnabled)
+            std::string_view extension;
+            const size_t mark = filePath.find_last_of("./\\");
+            if (mark != std::string::npos && filePath[mark] == '.')
             {
-                m_Impl->SaveToCache(shader.SourceHash, shader);
+                extension = std::string_view(filePath).substr(mark);
+            }
+
+            if (!ShaderStageFromExtension(extension, stage))
+            {
+                return SharedResult(ErrorCode::InvalidParameter, "Could not determine shader stage from file extension: " + std::string(extension));
             }
         }
 
-        return result;
+        std::string normalizedPath = m_Impl->NormalizePathKey(filePath);
+
+        // Remember the options used for this file so a hot-reload
+        // recompile replays the same macros/optimization, not defaults
+        {
+            std::lock_guard<std::mutex> lock(m_Impl->m_SourceOptionsMutex);
+            m_Impl->m_SourceOptions[normalizedPath] = options;
+        }
+
+        // CompileFromSourceShared records the normalized path as SourceFile
+        // before its internal SaveToCache, so the result already carries the
+        // hot-reload mapping; saving again here would repeat the map insert
+        // and rewrite the cache file
+        return CompileFromSourceShared(source, stage, options, std::move(normalizedPath));
+    }
+
+    Result<CompiledShader> ShaderCompiler::CompileFromFile(const std::string& filePath,
+                                                          const ShaderCompileOptions& options)
+    {
+        auto shared = CompileFromFileShared(filePath, options);
+        if (!shared.IsSuccess())
+        {
+            return Result<CompiledShader>(shared.GetErrorCode(), shared.GetErrorMessage());
+        }
+        return Result<CompiledShader>(CompiledShader(*shared.GetValue()));
     }
 
     void ShaderCompiler::SetCachingEnabled(bool enabled, const std::string& cacheDirectory)
     {
         m_Impl->m_CachingEnabled = enabled;
         m_Impl->m_CacheDirectory = cacheDirectory;
+        m_Impl->RebuildCachePaths();
 
         if (enabled)
         {
-            std::filesystem::create_directories(cacheDirectory);
+            std::filesystem::create_directories(m_Impl->GetToolchainCacheDirectory());
+            m_Impl->SweepStaleToolchainCaches();
             VX_CORE_INFO("Shader caching enabled: {0}", cacheDirectory);
         }
         else
@@ -604,24 +2531,50 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
 
     void ShaderCompiler::ClearCache(bool deleteFiles)
     {
-        // Clear memory cache
+        // Drop queued background writes first so a pending job doesn't
+        // repopulate the directory right after it is cleared
+        {
+            std::lock_guard<std::mutex> lock(m_Impl->m_WriteQueueMutex);
+            m_Impl->m_WriteQueue.clear();
+        }
+
+        // Clear memory cache, one shard at a time
+        for (auto& shard : m_Impl->m_CacheShards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+            shard.Shaders.Clear();
+        }
+        {
+            std::unique_lock<std::shared_mutex> lock(m_Impl->m_NameCacheMutex);
+            m_Impl->m_NameCache.clear();
+        }
         {
-            std::unique_lock<std::shared_mutex> lock(m_Impl->m_CacheMutex);
-            m_Impl->m_ShaderCache.clear();
+            std::unique_lock<std::shared_mutex> lock(m_Impl->m_IncludeMutex);
+            m_Impl->m_IncludeCache.clear();
         }
+        m_Impl->InvalidateLocalCaches();
 
         // Clear disk cache
         if (deleteFiles && m_Impl->m_CachingEnabled && std::filesystem::exists(m_Impl->m_CacheDirectory))
         {
+            // Release the mapping before deleting so the files can go away
+            // on platforms that refuse to remove a mapped file
+            {
+                std::lock_guard<std::mutex> lock(m_Impl->m_PackMutex);
+                m_Impl->m_PackData.reset();
+                m_Impl->m_PackDirectory.clear();
+                m_Impl->m_PackDataSize = 0;
+                m_Impl->m_PackIndexHasHeader = false;
+            }
+
             try
             {
-                for (const auto& entry : std::filesystem::directory_iterator(m_Impl->m_CacheDirectory))
-                {
-                    if (entry.path().extension() == ".spv" || entry.path().extension() == ".info")
-                    {
-                        std::filesystem::remove(entry.path());
-                    }
-                }
+                // The cache directory is dedicated to shader cache output
+                // (per-toolchain pack subdirectories plus any loose files
+                // from older layouts), so one bulk remove_all beats
+                // iterating, filtering, and unlinking entries one by one
+                std::filesystem::remove_all(m_Impl->m_CacheDirectory);
+                std::filesystem::create_directories(m_Impl->GetToolchainCacheDirectory());
                 VX_CORE_INFO("Shader cache cleared");
             }
             catch (const std::exception& e)
@@ -633,35 +2586,49 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
 
     void ShaderCompiler::SetHotReloadEnabled(bool enabled, const std::vector<std::string>& watchDirectories)
     {
-        m_Impl->m_HotReloadEnabled = enabled;
-        m_Impl->m_WatchDirectories = watchDirectories;
+        if (!enabled)
+        {
+            m_Impl->StopWatcher();
+            m_Impl->m_HotReloadEnabled = false;
+            VX_CORE_INFO("Shader hot-reload disabled");
+            return;
+        }
 
-        if (enabled)
         {
-            VX_CORE_INFO("Shader hot-reload enabled");
-            for (const auto& dir : watchDirectories)
+            std::lock_guard<std::mutex> lock(m_Impl->m_WatchMutex);
+            m_Impl->m_HotReloadEnabled = true;
+            m_Impl->m_WatchDirectories = watchDirectories;
+            if (!m_Impl->m_WatchThread.joinable())
             {
-                VX_CORE_INFO("  Watching directory: {0}", dir);
+                m_Impl->m_WatchThread = std::thread([impl = m_Impl.get()] { impl->WatcherLoop(); });
             }
         }
-        else
+
+        VX_CORE_INFO("Shader hot-reload enabled");
+        for (const auto& dir : watchDirectories)
         {
-            VX_CORE_INFO("Shader hot-reload disabled");
+            VX_CORE_INFO("  Watching directory: {0}", dir);
         }
-
-        // TODO: Implement file system watching
     }
 
     ShaderCompiler::Stats ShaderCompiler::GetStats() const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_StatsMutex);
-        return m_Impl->m_Stats;
+        Stats stats;
+        stats.ShadersCompiled = m_Impl->m_Stats.ShadersCompiled.load(std::memory_order_relaxed);
+        stats.CacheHits = m_Impl->m_Stats.CacheHits.load(std::memory_order_relaxed);
+        stats.CacheMisses = m_Impl->m_Stats.CacheMisses.load(std::memory_order_relaxed);
+        stats.CompilationErrors = m_Impl->m_Stats.CompilationErrors.load(std::memory_order_relaxed);
+        stats.CompilationTime = m_Impl->m_Stats.CompilationTime.load(std::memory_order_relaxed);
+        return stats;
     }
 
     void ShaderCompiler::ResetStats()
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_StatsMutex);
-        m_Impl->m_Stats = {};
+        m_Impl->m_Stats.ShadersCompiled.store(0, std::memory_order_relaxed);
+        m_Impl->m_Stats.CacheHits.store(0, std::memory_order_relaxed);
+        m_Impl->m_Stats.CacheMisses.store(0, std::memory_order_relaxed);
+        m_Impl->m_Stats.CompilationErrors.store(0, std::memory_order_relaxed);
+        m_Impl->m_Stats.CompilationTime.store(0, std::memory_order_relaxed);
         VX_CORE_INFO("Shader compiler statistics reset");
     }
 
@@ -669,16 +2636,19 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
     // Shader Program Compilation (stub implementations)
     // ============================================================================
 
-    Result<std::unordered_map<uint64_t, CompiledShader>> ShaderCompiler::CompileVariants(
-        const std::string& source,
-        ShaderStage stage, 
+    Result<ShaderVariantMap> ShaderCompiler::CompileVariants(
+        std::string_view source,
+        ShaderStage stage,
         const std::vector<ShaderMacros>& variants,
         const ShaderCompileOptions& baseOptions)
     {
-        return Result<std::unordered_map<uint64_t, CompiledShader>>(ErrorCode::NotImplemented, "CompileVariants not yet implemented");
+        // Same fan-out as the async path - variants compile in parallel on
+        // the scheduler workers - with this thread blocking on the join
+        // instead of suspending
+        return RunSync(CompileVariantsAsync(std::string(source), stage, variants, baseOptions));
     }
 
-    Result<ShaderProgram> ShaderCompiler::CompileProgram(const std::unordered_map<ShaderStage, std::string>& shaderFiles,
+    Result<ShaderProgram> ShaderCompiler::CompileProgram(const std::vector<std::pair<ShaderStage, std::string>>& shaderFiles,
                                                         const ShaderCompileOptions& options)
     {
         return Result<ShaderProgram>(ErrorCode::NotImplemented, "CompileProgram not yet implemented");
@@ -695,11 +2665,33 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
         CoroutinePriority priority,
         std::string filename)
     {
+        // A hot cache entry costs a few microseconds — not worth two
+        // scheduler round trips — so probe the memory cache before any
+        // yield. Long hit streaks still yield once in a while so a
+        // cache-hot loop doesn't starve other coroutines.
+        static constexpr uint32_t kYieldEveryNCacheHits = 64;
+        static thread_local uint32_t t_CacheHitStreak = 0;
+
+        {
+            uint64_t hash = m_Impl->ComputeShaderHash(source, stage, options);
+            if (auto cached = m_Impl->TryLoadFromMemory(hash))
+            {
+                m_Impl->m_Stats.CacheHits.fetch_add(1, std::memory_order_relaxed);
+                if (++t_CacheHitStreak >= kYieldEveryNCacheHits)
+                {
+                    t_CacheHitStreak = 0;
+                    co_await YieldExecution(priority);
+                }
+                co_return Result<CompiledShader>(CompiledShader(*cached));
+            }
+        }
+        t_CacheHitStreak = 0;
+
         // Yield control with specified priority to allow scheduler to manage workload
         co_await YieldExecution(priority);
 
         // Log compilation start for debugging
-        VX_CORE_TRACE("Starting async shader compilation: {0} (priority: {1})", 
+        VX_CORE_TRACE("Starting async shader compilation: {0} (priority: {1})",
                      filename.empty() ? "<source>" : filename, static_cast<int>(priority));
 
         // Perform the compilation (this is the expensive operation)
@@ -708,7 +2700,7 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
         // Yield again after compilation to allow other coroutines to run
         co_await YieldExecution();
 
-        VX_CORE_TRACE("Completed async shader compilation: {0}", 
+        VX_CORE_TRACE("Completed async shader compilation: {0}",
                      filename.empty() ? "<source>" : filename);
 
         co_return result;
@@ -736,64 +2728,160 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
         co_return result;
     }
 
-    Task<Result<std::unordered_map<uint64_t, CompiledShader>>> ShaderCompiler::CompileVariantsAsync(
+    Task<Result<CompiledShader>> ShaderCompiler::CompileVariantTask(std::string_view source,
+                                                                    ShaderStage stage,
+                                                                    ShaderCompileOptions options,
+                                                                    CoroutinePriority priority,
+                                                                    std::string name)
+    {
+        // Hop onto a scheduler worker before the CPU-heavy compile
+        co_await YieldExecution(priority);
+
+        // Preprocess with this variant's macros applied, then compile the
+        // expanded text with the macros cleared - they are baked into the
+        // text now. Variants whose keyword flips do not actually change the
+        // preprocessed source (dead #ifdef toggles) produce byte-identical
+        // text, hash to the same content key, and collapse onto one backend
+        // run through the shared cache and single-flight machinery; the
+        // macro-hash dedup in CompileVariantsAsync only catches variants
+        // whose option lists are equal.
+        const shaderc::CompileOptions& shadercOptions = m_Impl->GetCompileOptions(options);
+        auto preprocessed = Impl::GetThreadCompiler().PreprocessGlsl(
+            source.data(), source.size(), GetShadercKind(stage), name.c_str(), shadercOptions);
+        if (preprocessed.GetCompilationStatus() == shaderc_compilation_status_success)
+        {
+            const std::string_view text(preprocessed.cbegin(),
+                                        static_cast<size_t>(preprocessed.cend() - preprocessed.cbegin()));
+            ShaderCompileOptions strippedOptions = options;
+            strippedOptions.Macros.Clear();
+            co_return CompileFromSource(text, stage, strippedOptions, name);
+        }
+
+        // Preprocessing failed (bad directive, missing include): run the
+        // full compile on the raw source so the caller gets shaderc's
+        // complete error list with original line numbers
+        co_return CompileFromSource(source, stage, options, name);
+    }
+
+    Task<Result<ShaderVariantMap>> ShaderCompiler::CompileVariantsAsync(
         std::string source,
-        ShaderStage stage, 
+        ShaderStage stage,
         std::vector<ShaderMacros> variants,
         ShaderCompileOptions options,
         CoroutinePriority priority)
     {
         co_await YieldExecution(priority);
 
-        VX_CORE_TRACE("Starting async variant compilation: {0} variants (priority: {1})", 
+        VX_CORE_TRACE("Starting async variant compilation: {0} variants (priority: {1})",
                      variants.size(), static_cast<int>(priority));
 
-        std::unordered_map<uint64_t, CompiledShader> results;
-        
-        // Compile each variant, yielding between compilations to prevent blocking
+        // Variant compiles are independent, so fan them out as child tasks:
+        // each one suspends at its first yield and resumes on a scheduler
+        // worker, bringing total latency down from the sum of the variants
+        // to roughly the slowest one. Every child borrows a view of this
+        // coroutine's single copy of the source.
+        //
+        // Variants whose full compile hash comes out equal (macro lists that
+        // differ only in order, or duplicates in the caller's permutation
+        // table) share one task instead of dispatching twice; each still
+        // gets its own slot in the result map.
+        std::vector<uint64_t> variantHashes;
+        variantHashes.reserve(variants.size());
+        std::vector<size_t> taskForVariant(variants.size());
+        std::vector<Task<Result<CompiledShader>>> tasks;
+        tasks.reserve(variants.size());
+        std::unordered_map<uint64_t, size_t, IdentityU64Hash> taskByContentHash;
+        taskByContentHash.reserve(variants.size());
+
         for (size_t i = 0; i < variants.size(); ++i)
         {
             const auto& variantMacros = variants[i];
-            
+
             // Create options for this variant
             ShaderCompileOptions variantOptions = options;
             for (const auto& macro : variantMacros)
             {
-                variantOptions.Macros[macro.Name] = macro.Value;
+                variantOptions.Macros.Set(macro.Name, macro.Value);
+            }
+
+            variantHashes.push_back(ShaderVariantManager::GenerateVariantHash(variantMacros));
+
+            const uint64_t contentHash = m_Impl->ComputeShaderHash(source, stage, variantOptions);
+            auto [it, inserted] = taskByContentHash.emplace(contentHash, tasks.size());
+            taskForVariant[i] = it->second;
+            if (inserted)
+            {
+                tasks.push_back(CompileVariantTask(source, stage, std::move(variantOptions), priority,
+                                                   MakeIndexedName("variant_", i)));
             }
-            
-            // Generate hash for this variant
-            uint64_t variantHash = ShaderVariantManager::GenerateVariantHash(variantMacros);
-            
-            // Compile this variant
-            auto result = CompileFromSource(source, stage, variantOptions, "variant_" + std::to_string(i));
-            
+        }
+
+        if (tasks.size() < variants.size())
+        {
+            VX_CORE_TRACE("Deduplicated {0} shader variants down to {1} unique compiles",
+                         variants.size(), tasks.size());
+        }
+
+        // Collect results; on failure keep draining the remaining tasks
+        // (they may already be running on workers) and report the first error
+        std::vector<Result<CompiledShader>> taskResults;
+        taskResults.reserve(tasks.size());
+        bool failed = false;
+        ErrorCode firstErrorCode = ErrorCode::Success;
+        std::string firstErrorMessage;
+
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            taskResults.push_back(co_await tasks[i]);
+            const auto& result = taskResults.back();
             if (result.IsSuccess())
             {
-                results[variantHash] = std::move(const_cast<CompiledShader&>(result.GetValue()));
-                VX_CORE_TRACE("Compiled shader variant {0}/{1} successfully (hash: {2})", 
-                             i + 1, variants.size(), variantHash);
+                VX_CORE_TRACE("Compiled shader variant {0}/{1} successfully",
+                             i + 1, tasks.size());
             }
             else
             {
-                VX_CORE_ERROR("Failed to compile shader variant {0}/{1}: {2}", 
-                             i + 1, variants.size(), result.GetErrorMessage());
-                // Return early on first error
-                co_return Result<std::unordered_map<uint64_t, CompiledShader>>(
-                    result.GetErrorCode(), 
-                    "Variant compilation failed: " + result.GetErrorMessage());
+                VX_CORE_ERROR("Failed to compile shader variant {0}/{1}: {2}",
+                             i + 1, tasks.size(), result.GetErrorMessage());
+                if (!failed)
+                {
+                    failed = true;
+                    firstErrorCode = result.GetErrorCode();
+                    firstErrorMessage = result.GetErrorMessage();
+                }
             }
-            
-            // Yield between variants to allow other work
-            if (i < variants.size() - 1)
+        }
+
+        ShaderVariantMap results;
+        results.reserve(variants.size());
+        if (!failed)
+        {
+            // Count how many variants reference each task so the last
+            // consumer can move instead of copy
+            std::vector<uint32_t> remainingUses(tasks.size(), 0);
+            for (size_t i = 0; i < variants.size(); ++i)
+                ++remainingUses[taskForVariant[i]];
+
+            for (size_t i = 0; i < variants.size(); ++i)
             {
-                co_await YieldExecution();
+                auto& compiled = const_cast<CompiledShader&>(taskResults[taskForVariant[i]].GetValue());
+                if (--remainingUses[taskForVariant[i]] == 0)
+                    results[variantHashes[i]] = std::move(compiled);
+                else
+                    results[variantHashes[i]] = compiled;
             }
         }
 
+        if (failed)
+        {
+            co_return Result<ShaderVariantMap>(
+                firstErrorCode,
+                "Variant compilation failed: " + firstErrorMessage);
+        }
+
         VX_CORE_INFO("Completed async variant compilation: {0} variants compiled", results.size());
-        
-        co_return Result<std::unordered_map<uint64_t, CompiledShader>>(std::move(results));
+
+        co_return Result<ShaderVariantMap>(std::move(results));
     }
 
     Task<std::vector<Result<CompiledShader>>> ShaderCompiler::CompileBatchAsync(
@@ -805,35 +2893,52 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
         VX_CORE_INFO("Starting batch shader compilation: {0} shaders (max concurrency: {1})", 
                     compilationTasks.size(), maxConcurrency);
 
+        const size_t total = compilationTasks.size();
+        // Honor the runtime throttle; the window offset below is fixed for
+        // the whole batch, so the cap is sampled once at entry
+        const uint32_t cap = m_Impl->m_MaxCompileConcurrency.load(std::memory_order_relaxed);
+        if (cap != 0)
+            maxConcurrency = std::min<size_t>(maxConcurrency, cap);
+        if (maxConcurrency == 0)
+            maxConcurrency = 1;
+
         std::vector<Result<CompiledShader>> results;
-        results.reserve(compilationTasks.size());
+        results.reserve(total);
+
+        // Sliding-window fan-out: tasks are eager and hop onto scheduler
+        // workers at their first yield, so everything launched here runs
+        // concurrently. Awaiting in launch order and topping the window up
+        // by one task per completion keeps at most maxConcurrency compiles
+        // in flight, without the barrier the old fixed windows had where
+        // one slow shader idled the rest of its window.
+        std::vector<Task<Result<CompiledShader>>> inFlight;
+        inFlight.reserve(total);
+
+        const size_t initial = std::min(maxConcurrency, total);
+        for (size_t i = 0; i < initial; ++i)
+        {
+            const auto& [source, stage, options] = compilationTasks[i];
+            inFlight.push_back(
+                CompileFromSourceAsync(source, stage, options, CoroutinePriority::Normal,
+                                       MakeIndexedName("batch_", i))
+            );
+        }
 
-        // Process tasks in batches to respect concurrency limit
-        for (size_t startIdx = 0; startIdx < compilationTasks.size(); startIdx += maxConcurrency)
+        for (size_t i = 0; i < total; ++i)
         {
-            size_t endIdx = std::min(startIdx + maxConcurrency, compilationTasks.size());
-            std::vector<Task<Result<CompiledShader>>> currentBatch;
-            
-            // Start coroutines for current batch
-            for (size_t i = startIdx; i < endIdx; ++i)
+            results.push_back(co_await inFlight[i]);
+
+            // Task i is done, so launching task i + maxConcurrency keeps
+            // exactly maxConcurrency compiles in flight
+            const size_t next = i + maxConcurrency;
+            if (next < total)
             {
-                const auto& [source, stage, options] = compilationTasks[i];
-                currentBatch.push_back(
-                    CompileFromSourceAsync(source, stage, options, CoroutinePriority::Normal, 
-                                         "batch_" + std::to_string(i))
+                const auto& [source, stage, options] = compilationTasks[next];
+                inFlight.push_back(
+                    CompileFromSourceAsync(source, stage, options, CoroutinePriority::Normal,
+                                           MakeIndexedName("batch_", next))
                 );
             }
-            
-            // Wait for all tasks in current batch to complete
-            // For now, process each task sequentially since WhenAll doesn't support iterators yet
-            for (auto& task : currentBatch)
-            {
-                auto result = co_await task;
-                results.push_back(std::move(result));
-            }
-            
-            // Yield between batches to allow other work
-            co_await YieldExecution();
         }
 
         VX_CORE_INFO("Completed batch shader compilation: {0} shaders processed", results.size());
@@ -845,63 +2950,169 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
     // Static utility methods (stub implementations)
     // ============================================================================
 
-    bool ShaderCompiler::ValidateSpirV(const std::vector<uint32_t>& spirv)
+    bool ShaderCompiler::ValidateSpirV(const uint32_t* words, size_t wordCount)
     {
-        // TODO: Implement SPIR-V validation using spirv-tools
-        return !spirv.empty();
+        // Structural validation in one linear pass: header magic plus a
+        // walk of the instruction stream checking that every instruction's
+        // declared word count stays in bounds. Catches truncation and
+        // corruption without a spirv-tools dependency; semantic validation
+        // stays with the driver.
+        static constexpr uint32_t kSpirVMagic = 0x07230203;
+        static constexpr size_t kSpirVHeaderWords = 5;
+
+        if (!words || wordCount < kSpirVHeaderWords || words[0] != kSpirVMagic)
+            return false;
+
+        for (size_t i = kSpirVHeaderWords; i < wordCount;)
+        {
+            const size_t instructionWords = words[i] >> 16;
+            if (instructionWords == 0 || i + instructionWords > wordCount)
+                return false;
+            i += instructionWords;
+        }
+        return true;
     }
 
-    uint64_t ShaderCompiler::GenerateShaderHash(const std::string& source, const ShaderCompileOptions& options)
+    bool ShaderCompiler::ValidateSpirV(const std::vector<uint32_t>& spirv)
     {
-        std::stringstream ss;
-        ss << source;
-        ss << static_cast<int>(options.OptimizationLevel);
-        ss << options.TargetProfile;
-        ss << options.GenerateDebugInfo;
-        ss << options.TreatWarningsAsErrors;
-        
-        for (const auto& [name, value] : options.Macros)
-        {
-            ss << name << "=" << value << ";";
-        }
+        return ValidateSpirV(spirv.data(), spirv.size());
+    }
 
-        return HashString(ss.str());
+    uint64_t ShaderCompiler::GenerateShaderHash(std::string_view source, const ShaderCompileOptions& options)
+    {
+        StreamingHash hash;
+        hash.Update(source);
+        hash.UpdateValue(static_cast<int32_t>(options.OptimizationLevel));
+        hash.Update(options.TargetProfile);
+        hash.UpdateByte(static_cast<uint8_t>((options.GenerateDebugInfo ? 1u : 0u) |
+                                             (options.TreatWarningsAsErrors ? 2u : 0u)));
+        HashMacros(hash, options.Macros);
+        return hash.Finish();
     }
 
     // ============================================================================
     // Stub methods for missing functionality
     // ============================================================================
 
+    void ShaderCompiler::SetMaxCompileThreads(uint32_t count)
+    {
+        m_Impl->m_MaxCompileConcurrency.store(count, std::memory_order_relaxed);
+    }
+
+    uint32_t ShaderCompiler::GetPendingCompileJobs() const
+    {
+        std::lock_guard<std::mutex> lock(m_Impl->m_InFlightMutex);
+        return static_cast<uint32_t>(m_Impl->m_InFlight.size());
+    }
+
     void ShaderCompiler::SetShaderReloadCallback(ShaderLoadedCallback callback)
     {
-        // TODO: Store callback for hot-reload
+        std::lock_guard<std::mutex> lock(m_Impl->m_CallbackMutex);
+        m_Impl->m_ReloadCallback = std::move(callback);
     }
 
     void ShaderCompiler::SetShaderErrorCallback(ShaderErrorCallback callback)
     {
-        // TODO: Store callback for errors
+        std::lock_guard<std::mutex> lock(m_Impl->m_CallbackMutex);
+        m_Impl->m_ErrorCallback = std::move(callback);
     }
 
     void ShaderCompiler::RecompileShader(const std::string& filePath)
     {
-        // TODO: Implement hot-reload recompilation
+        m_Impl->RecompileOne(filePath);
     }
 
     void ShaderCompiler::AddIncludeDirectory(const std::string& directory)
     {
-        // TODO: Store include directories
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_IncludeMutex);
+        auto& dirs = m_Impl->m_IncludeDirectories;
+        if (std::find(dirs.begin(), dirs.end(), directory) == dirs.end())
+            dirs.push_back(directory);
     }
 
     void ShaderCompiler::ClearIncludeDirectories()
     {
-        // TODO: Clear include directories
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_IncludeMutex);
+        m_Impl->m_IncludeDirectories.clear();
     }
 
     Result<uint32_t> ShaderCompiler::PrecompileShaders(const std::string& inputDirectory,
                                                        const std::string& outputDirectory,
                                                        const ShaderCompileOptions& options)
     {
-        return Result<uint32_t>(ErrorCode::NotImplemented, "PrecompileShaders not yet implemented");
+        namespace fs = std::filesystem;
+
+        std::error_code ec;
+        if (!fs::exists(inputDirectory, ec))
+        {
+            return Result<uint32_t>(ErrorCode::FileNotFound, "Shader input directory not found: " + inputDirectory);
+        }
+        if (!fs::create_directories(outputDirectory, ec) && ec)
+        {
+            return Result<uint32_t>(ErrorCode::FileAccessDenied, "Could not create shader output directory: " + outputDirectory);
+        }
+
+        // Gather every shader source under the input tree first, reading the
+        // bytes up front so the compile fan-out below is pure CPU work
+        std::vector<fs::path> files;
+        std::vector<std::tuple<std::string, ShaderStage, ShaderCompileOptions>> batch;
+        for (const auto& entry : fs::recursive_directory_iterator(inputDirectory, ec))
+        {
+            if (!entry.is_regular_file(ec))
+                continue;
+
+            ShaderStage stage;
+            if (!ShaderStageFromExtension(entry.path().extension().string(), stage))
+                continue;
+
+            std::string source = ReadFileToString(entry.path().string());
+            if (source.empty())
+            {
+                VX_CORE_WARN("Skipping empty or unreadable shader: {0}", entry.path().string());
+                continue;
+            }
+
+            files.push_back(entry.path());
+            batch.emplace_back(std::move(source), stage, options);
+        }
+
+        if (batch.empty())
+        {
+            return Result<uint32_t>(0u);
+        }
+
+        // CompileBatchAsync already runs a bounded sliding window over the
+        // scheduler workers, so precompilation scales to core count without
+        // a dedicated queue; blocking on the join is fine for a build step
+        const size_t concurrency = std::max<size_t>(4, std::thread::hardware_concurrency());
+        std::vector<Result<CompiledShader>> results = RunSync(CompileBatchAsync(std::move(batch), concurrency));
+
+        // Single-threaded sink: one .spv per source file, written with the
+        // same direct span writes the disk cache uses
+        uint32_t compiled = 0;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            if (!results[i].IsSuccess())
+            {
+                VX_CORE_ERROR("Precompile failed for {0}: {1}", files[i].string(), results[i].GetErrorMessage());
+                continue;
+            }
+
+            const CompiledShader& shader = results[i].GetValue();
+            fs::path outputPath = fs::path(outputDirectory) / files[i].filename();
+            outputPath += ".spv";
+
+            FileWriteSpan span{ shader.SpirV.data(), shader.SpirV.size() * sizeof(uint32_t) };
+            if (!WriteFileSpans(outputPath.string(), &span, 1))
+            {
+                VX_CORE_ERROR("Failed to write precompiled shader: {0}", outputPath.string());
+                continue;
+            }
+            ++compiled;
+        }
+
+        VX_CORE_INFO("Precompiled {0}/{1} shaders from {2}", compiled, results.size(), inputDirectory);
+        return Result<uint32_t>(compiled);
     }
 
     // ============================================================================
@@ -911,38 +3122,144 @@ return Result<CompiledShader>(ErrorCode::InvalidParameter, "Could not determine
     std::vector<ShaderMacros> ShaderVariantManager::GenerateVariants(
         const std::vector<std::vector<ShaderMacro>>& macroGroups)
     {
-        // TODO: Implement variant generation logic
         std::vector<ShaderMacros> variants;
+        if (macroGroups.empty())
+            return variants;
+
+        // Cartesian product: one macro from each group per variant. Reserve
+        // the product size up front so the thousands of combinations a big
+        // permutation table produces never trigger a reallocation; empty
+        // groups contribute nothing and are skipped rather than zeroing the
+        // product.
+        size_t count = 1;
+        size_t groupCount = 0;
+        for (const auto& group : macroGroups)
+        {
+            if (group.empty())
+                continue;
+            count *= group.size();
+            ++groupCount;
+        }
+        if (groupCount == 0)
+            return variants;
+
+        // Pack the non-empty groups once so the walk below indexes a dense
+        // array instead of re-skipping empties every step
+        std::vector<const std::vector<ShaderMacro>*> groups;
+        groups.reserve(groupCount);
+        for (const auto& group : macroGroups)
+        {
+            if (!group.empty())
+                groups.push_back(&group);
+        }
+
+        // Iterative mixed-radix counter over the groups: `current` holds one
+        // macro per group and each increment rewrites only the digits that
+        // carried (exactly one slot per step for boolean-style groups), so a
+        // new combination costs O(carries) updates plus the unavoidable copy
+        // into the output, instead of rebuilding the whole variant each time
+        variants.reserve(count);
+        std::vector<size_t> indices(groupCount, 0);
+        ShaderMacros current;
+        current.reserve(groupCount);
+        for (size_t g = 0; g < groupCount; ++g)
+            current.push_back((*groups[g])[0]);
+
+        for (;;)
+        {
+            variants.push_back(current);
+
+            size_t digit = 0;
+            while (digit < groupCount)
+            {
+                if (++indices[digit] < groups[digit]->size())
+                {
+                    current[digit] = (*groups[digit])[indices[digit]];
+                    break;
+                }
+                indices[digit] = 0;
+                current[digit] = (*groups[digit])[0];
+                ++digit;
+            }
+            if (digit == groupCount)
+                break;
+        }
         return variants;
     }
 
     uint64_t ShaderVariantManager::GenerateVariantHash(const ShaderMacros& macros)
     {
-        std::stringstream ss;
-        for (const auto& macro : macros)
+        // Canonicalize by name first so permutation tables that list the
+        // same macros in different orders map to the same variant, matching
+        // how ShaderMacroSet keeps the compile-hash input sorted. Sorting a
+        // handful of indices is cheaper than copying the macros themselves.
+        std::vector<uint32_t> order(macros.size());
+        for (uint32_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return macros[a].Name < macros[b].Name;
+        });
+
+        StreamingHash hash;
+        for (uint32_t index : order)
         {
-            ss << macro.Name << "=" << macro.Value << ";";
+            const ShaderMacro& macro = macros[index];
+            hash.Update(macro.Name);
+            hash.UpdateByte('=');
+            hash.Update(macro.Value);
+            hash.UpdateByte(';');
         }
-        return HashString(ss.str());
+        return hash.Finish();
     }
 
-    ShaderMacros ShaderVariantManager::ParseVariantString(const std::string& variantString)
+    ShaderMacros ShaderVariantManager::ParseVariantString(std::string_view variantString)
     {
+        // Format: "MACRO1=value1;MACRO2=value2;..." - a bare name with no
+        // '=' takes the conventional value "1"
         ShaderMacros macros;
-        // TODO: Implement string parsing logic
-        // Format: "MACRO1=value1;MACRO2=value2;..."
+        std::string_view remaining = variantString;
+        while (!remaining.empty())
+        {
+            const size_t semi = remaining.find(';');
+            std::string_view entry = remaining.substr(0, semi);
+            remaining = semi == std::string_view::npos ? std::string_view{} : remaining.substr(semi + 1);
+            if (entry.empty())
+                continue;
+
+            const size_t eq = entry.find('=');
+            if (eq == std::string_view::npos)
+                macros.emplace_back(std::string(entry));
+            else
+                macros.emplace_back(std::string(entry.substr(0, eq)), std::string(entry.substr(eq + 1)));
+        }
         return macros;
     }
 
     std::string ShaderVariantManager::MacrosToString(const ShaderMacros& macros)
     {
-        std::stringstream ss;
-        for (size_t i = 0; i < macros.size(); ++i)
+        // Emit in the same name-sorted order GenerateVariantHash hashes in,
+        // so equivalent variants also stringify identically
+        std::vector<uint32_t> order(macros.size());
+        for (uint32_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return macros[a].Name < macros[b].Name;
+        });
+
+        size_t length = 0;
+        for (const auto& macro : macros)
+            length += macro.Name.size() + macro.Value.size() + 2; // '=' and ';'
+
+        std::string result;
+        result.reserve(length);
+        for (size_t i = 0; i < order.size(); ++i)
         {
-            if (i > 0) ss << ";";
-            ss << macros[i].Name << "=" << macros[i].Value;
+            if (i > 0) result += ';';
+            result += macros[order[i]].Name;
+            result += '=';
+            result += macros[order[i]].Value;
         }
-        return ss.str();
+        return result;
     }
 
 } // namespace Vortex
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <functional>
+#include <string_view>
 #include <unordered_map>
 #include <thread>
 #include <mutex>
@@ -48,7 +49,7 @@ namespace Vortex
          * @param filename Optional filename for error reporting
          * @return Compiled shader result
          */
-        Result<CompiledShader> CompileFromSource(const std::string& source, 
+        Result<CompiledShader> CompileFromSource(std::string_view source,
                                                ShaderStage stage,
                                                const ShaderCompileOptions& options,
                                                const std::string& filename = "");
@@ -59,9 +60,31 @@ namespace Vortex
          * @param options Compilation options
          * @return Compiled shader result
          */
-        Result<CompiledShader> CompileFromFile(const std::string& filePath, 
+        Result<CompiledShader> CompileFromFile(const std::string& filePath,
                                              const ShaderCompileOptions& options);
 
+        /**
+         * @brief Compile shader from source, returning the shared cache entry
+         *
+         * Identical to CompileFromSource, but a cache hit is a refcount bump
+         * on the immutable cached entry instead of a deep copy of the SPIR-V
+         * and reflection data. Prefer this on hot paths that only read the
+         * result.
+         */
+        Result<std::shared_ptr<const CompiledShader>> CompileFromSourceShared(std::string_view source,
+                                                                             ShaderStage stage,
+                                                                             const ShaderCompileOptions& options,
+                                                                             const std::string& filename = "");
+
+        /**
+         * @brief Compile shader from file, returning the shared cache entry
+         *
+         * File-path counterpart of CompileFromSourceShared; see there for
+         * when to prefer the shared form.
+         */
+        Result<std::shared_ptr<const CompiledShader>> CompileFromFileShared(const std::string& filePath,
+                                                                           const ShaderCompileOptions& options);
+
         /**
          * @brief Compile shader with variants (permutations)
          * @param source Shader source code
@@ -70,19 +93,21 @@ namespace Vortex
          * @param options Base compilation options
          * @return Map of variant hash to compiled shader
          */
-        Result<std::unordered_map<uint64_t, CompiledShader>> CompileVariants(
-            const std::string& source,
+        Result<ShaderVariantMap> CompileVariants(
+            std::string_view source,
             ShaderStage stage, 
             const std::vector<ShaderMacros>& variants,
             const ShaderCompileOptions& options);
 
         /**
          * @brief Compile complete shader program from multiple files
-         * @param shaderFiles Map of shader stage to file path
+         * @param shaderFiles Stage/path pairs, at most one per stage; a flat
+         *                    list since a program never has more than a
+         *                    handful of stages
          * @param options Compilation options
          * @return Compiled shader program
          */
-        Result<ShaderProgram> CompileProgram(const std::unordered_map<ShaderStage, std::string>& shaderFiles,
+        Result<ShaderProgram> CompileProgram(const std::vector<std::pair<ShaderStage, std::string>>& shaderFiles,
                                            const ShaderCompileOptions& options);
 
         // ============================================================================
@@ -126,7 +151,7 @@ namespace Vortex
          * @param priority Compilation priority
          * @return Task that yields map of variant hash to compiled shader
          */
-        Task<Result<std::unordered_map<uint64_t, CompiledShader>>> CompileVariantsAsync(
+        Task<Result<ShaderVariantMap>> CompileVariantsAsync(
             std::string source,
             ShaderStage stage, 
             std::vector<ShaderMacros> variants,
@@ -178,6 +203,20 @@ namespace Vortex
          */
         void ResetStats();
 
+        /**
+         * @brief Cap the number of concurrent compiles on the batch paths
+         *
+         * Gameplay can lower the cap so background compilation stops
+         * starving frame work, then raise it again at load screens.
+         * @param count Maximum concurrent compiles; 0 removes the cap
+         */
+        void SetMaxCompileThreads(uint32_t count);
+
+        /**
+         * @brief Number of compilations currently in flight
+         */
+        uint32_t GetPendingCompileJobs() const;
+
         // ============================================================================
         // HOT-RELOAD SUPPORT
         // ============================================================================
@@ -242,16 +281,34 @@ namespace Vortex
          */
         static bool ValidateSpirV(const std::vector<uint32_t>& spirv);
 
+        /**
+         * @brief Validate SPIR-V words in place, without requiring a vector
+         * @param words Pointer to the SPIR-V word stream
+         * @param wordCount Number of 32-bit words
+         * @return True if valid, false otherwise
+         */
+        static bool ValidateSpirV(const uint32_t* words, size_t wordCount);
+
         /**
          * @brief Generate shader hash for caching
          * @param source Shader source code
          * @param options Compilation options
          * @return Hash value
          */
-        static uint64_t GenerateShaderHash(const std::string& source, 
+        static uint64_t GenerateShaderHash(std::string_view source,
                                          const ShaderCompileOptions& options);
 
     private:
+        /**
+         * @brief Child task for one variant compile; the source view borrows
+         *        the parent coroutine's copy, which outlives every child
+         */
+        Task<Result<CompiledShader>> CompileVariantTask(std::string_view source,
+                                                        ShaderStage stage,
+                                                        ShaderCompileOptions options,
+                                                        CoroutinePriority priority,
+                                                        std::string name);
+
         class Impl;
         std::unique_ptr<Impl> m_Impl;
     };
@@ -282,7 +339,7 @@ namespace Vortex
          * @param variantString String representation of variant
          * @return Parsed macros
          */
-        static ShaderMacros ParseVariantString(const std::string& variantString);
+        static ShaderMacros ParseVariantString(std::string_view variantString);
 
         /**
          * @brief Convert macros to string representation
@@ -13,10 +13,36 @@
 #include "Engine/Assets/ShaderAsset.h"
 
 #include <unordered_map>
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 
 namespace Vortex
 {
+    // Transparent string hasher/equality so name lookups accept literals and
+    // string_views without materializing a std::string per probe (FNV-1a,
+    // matching the engine's other string hashes)
+    struct TransparentStringHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const noexcept
+        {
+            uint64_t hash = 1469598103934665603ull;
+            for (unsigned char c : s)
+            {
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    struct TransparentStringEqual
+    {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const noexcept { return a == b; }
+    };
+
     // ============================================================================
     // ShaderManager::Impl
     // ============================================================================
@@ -32,12 +58,27 @@ namespace Vortex
         };
 
         // Core data
-        std::unordered_map<uint64_t, ShaderEntry> m_Shaders; // key: UUID value (uint64)
-        std::unordered_map<std::string, uint64_t> m_NameToId;
+        // Keys are already-random UUID values, so the identity hasher skips
+        // MSVC's redundant byte-mixing pass on every lookup
+        std::unordered_map<uint64_t, ShaderEntry, IdentityU64Hash> m_Shaders; // key: UUID value (uint64)
+        std::unordered_map<std::string, uint64_t, TransparentStringHash, TransparentStringEqual> m_NameToId;
         AssetSystem* m_AssetSystem = nullptr; // non-owning
         
         // State
         uint64_t m_CurrentlyBound = 0; // UUID value
+        // Resolved once at Bind time. The ShaderRef is the lifetime anchor
+        // (it keeps the GPU shader alive even if the asset is swapped out
+        // mid-frame) and is only mutated under the exclusive lock; the
+        // atomic mirrors its raw pointer so the per-draw uniform setters
+        // can call through with a single acquire load and no lock at all.
+        // Contract: Bind/Unbind/Clear are not called concurrently with
+        // uniform sets on the same shader - the same assumption the GL
+        // bind-state model underneath already makes.
+        ShaderRef m_BoundShader;
+        // Own cache line: the render thread rewrites this pointer on every
+        // bind, and overlay threads polling the stats block below must not
+        // ping-pong the line it lives on
+        alignas(64) std::atomic<GPUShader*> m_BoundShaderAtomic{ nullptr };
         bool m_Initialized = false;
         
         // Settings (kept for compatibility/logging)
@@ -49,11 +90,56 @@ namespace Vortex
         ShaderReloadCallback m_ReloadCallback;
         ShaderErrorCallback m_ErrorCallback;
         
-        // Statistics
-        mutable std::mutex m_Mutex;
-        Stats m_Stats;
+        // Registry lock: the per-frame paths (uniform setters, FindShader,
+        // GetCurrentShader) only read the maps, so they take shared locks
+        // and run concurrently; loads, binds and clears take it exclusive
+        mutable std::shared_mutex m_Mutex;
+
+        // Stats are plain counter bumps, so they live outside the registry
+        // lock as relaxed atomics; GetStats() snapshots them without ever
+        // touching m_Mutex (debug overlays poll it per frame). Aligned off
+        // the bound-shader line so those polls never contend with binds.
+        struct alignas(64) AtomicStats
+        {
+            std::atomic<uint32_t> LoadedShaders{ 0 };
+            std::atomic<uint32_t> LoadedPrograms{ 0 };
+            std::atomic<uint32_t> CacheHits{ 0 };
+            std::atomic<uint32_t> CacheMisses{ 0 };
+            std::atomic<uint64_t> MemoryUsage{ 0 };
+            std::atomic<uint32_t> HotReloads{ 0 };
+
+            void Reset()
+            {
+                LoadedShaders.store(0, std::memory_order_relaxed);
+                LoadedPrograms.store(0, std::memory_order_relaxed);
+                CacheHits.store(0, std::memory_order_relaxed);
+                CacheMisses.store(0, std::memory_order_relaxed);
+                MemoryUsage.store(0, std::memory_order_relaxed);
+                HotReloads.store(0, std::memory_order_relaxed);
+            }
+        };
+        AtomicStats m_Stats;
 
         Impl() = default;
+
+        // Single resolver for every per-draw entry point: one acquire load
+        // of the bound-shader pointer, shared so the whole uniform-dispatch
+        // cluster stays one small branch instead of a copy per overload
+        GPUShader* ResolveBoundShader() const noexcept
+        {
+            return m_BoundShaderAtomic.load(std::memory_order_acquire);
+        }
+
+        // Shared body of the typed SetUniform overloads. Key is either the
+        // uniform name or a pre-resolved UniformHandle.
+        template<typename K, typename T>
+        Result<void> SetBoundUniform(const K& key, const T& value)
+        {
+            GPUShader* shader = ResolveBoundShader();
+            if (!shader) [[unlikely]]
+                return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
+            return shader->SetUniform(key, value);
+        }
     };
 
     // ============================================================================
@@ -74,7 +160,7 @@ namespace Vortex
 
     Result<void> ShaderManager::Initialize(const std::string& shaderDirectory, const std::string& cacheDirectory, bool enableHotReload)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
 
         if (m_Impl->m_Initialized)
         {
@@ -96,7 +182,11 @@ namespace Vortex
         }
         if (!m_Impl->m_AssetSystem)
         {
-            VX_CORE_ERROR("ShaderManager: AssetSystem not available. Initialization will proceed but most operations will fail.");
+            // Refuse to come up half-working: every load path depends on the
+            // AssetSystem, and gating it here lets those paths trust the
+            // pointer instead of re-checking it per call
+            VX_CORE_ERROR("ShaderManager: AssetSystem not available; initialization refused.");
+            return Result<void>(ErrorCode::InvalidState, "AssetSystem not available");
         }
 
         m_Impl->m_Initialized = true;
@@ -113,7 +203,7 @@ namespace Vortex
     {
         // First mark as not initialized under lock to block new operations
         {
-            std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+            std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
             if (!m_Impl->m_Initialized)
             {
                 return;
@@ -129,16 +219,15 @@ namespace Vortex
 
     Result<AssetHandle<ShaderAsset>> ShaderManager::LoadShader(const std::string& name, const std::string& filePath, const ShaderCompileOptions& options)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
 
         if (!m_Impl->m_Initialized)
         {
             return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "ShaderManager not initialized");
         }
-        if (!m_Impl->m_AssetSystem)
-        {
-            return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "AssetSystem not available");
-        }
+        // Initialize() refuses to succeed without an AssetSystem, so a
+        // non-null pointer is an invariant here
+        VX_CORE_ASSERT(m_Impl->m_AssetSystem, "AssetSystem must exist after initialization");
 
         // If a shader with this name already exists, return its handle
         auto nameIt = m_Impl->m_NameToId.find(name);
@@ -152,8 +241,9 @@ namespace Vortex
             return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "Shader mapping inconsistent");
         }
 
-        // Interpret filePath as a manifest when it ends with .json
-        if (filePath.size() >= 5 && filePath.substr(filePath.size() - 5) == ".json")
+        // Interpret filePath as a manifest when it ends with .json;
+        // ends_with compares in place instead of allocating a substr copy
+        if (std::string_view(filePath).ends_with(".json"))
         {
             auto handle = m_Impl->m_AssetSystem->LoadAsset<ShaderAsset>(name, [](float){});
             if (!handle.IsValid())
@@ -161,32 +251,32 @@ namespace Vortex
                 return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidParameter, "Failed to request shader manifest: " + filePath);
             }
             uint64_t id = static_cast<uint64_t>(handle.GetId());
-            Impl::ShaderEntry entry;
-            entry.Name = name;
-            entry.Handle = std::move(handle);
-            m_Impl->m_Shaders[id] = std::move(entry);
+            // try_emplace constructs the entry in place instead of
+            // default-constructing a slot and move-assigning into it
+            auto [entryIt, inserted] = m_Impl->m_Shaders.try_emplace(id);
+            entryIt->second.Name = name;
+            entryIt->second.Handle = std::move(handle);
             m_Impl->m_NameToId[name] = id;
-            m_Impl->m_Stats.LoadedShaders++;
+            m_Impl->m_Stats.LoadedShaders.fetch_add(1, std::memory_order_relaxed);
             VX_CORE_INFO("ShaderManager: Requested shader '{}' from manifest {} (AssetSystem)", name, filePath);
-            return Result<AssetHandle<ShaderAsset>>(m_Impl->m_Shaders[id].Handle);
+            return Result<AssetHandle<ShaderAsset>>(entryIt->second.Handle);
         }
 
         // Otherwise, this API is ambiguous (single file). Encourage using LoadShaderProgram.
         return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidParameter, "Use LoadShaderProgram() with stage files or provide a manifest (.json)");
     }
 
-    Result<AssetHandle<ShaderAsset>> ShaderManager::LoadShaderProgram(const std::string& name, const std::unordered_map<ShaderStage, std::string>& shaderFiles, const ShaderCompileOptions& options)
+    Result<AssetHandle<ShaderAsset>> ShaderManager::LoadShaderProgram(const std::string& name, const std::vector<std::pair<ShaderStage, std::string>>& shaderFiles, const ShaderCompileOptions& options)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
 
         if (!m_Impl->m_Initialized)
         {
             return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "ShaderManager not initialized");
         }
-        if (!m_Impl->m_AssetSystem)
-        {
-            return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "AssetSystem not available");
-        }
+        // Initialize() refuses to succeed without an AssetSystem, so a
+        // non-null pointer is an invariant here
+        VX_CORE_ASSERT(m_Impl->m_AssetSystem, "AssetSystem must exist after initialization");
 
         auto nameIt = m_Impl->m_NameToId.find(name);
         if (nameIt != m_Impl->m_NameToId.end())
@@ -199,9 +289,18 @@ namespace Vortex
             return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidState, "Shader mapping inconsistent");
         }
 
-        auto vsIt = shaderFiles.find(ShaderStage::Vertex);
-        auto fsIt = shaderFiles.find(ShaderStage::Fragment);
-        if (vsIt == shaderFiles.end() || fsIt == shaderFiles.end())
+        // A program has a handful of stages at most, so a linear scan of
+        // the flat list beats a hash lookup
+        const std::string* vsPath = nullptr;
+        const std::string* fsPath = nullptr;
+        for (const auto& [stage, path] : shaderFiles)
+        {
+            if (stage == ShaderStage::Vertex)
+                vsPath = &path;
+            else if (stage == ShaderStage::Fragment)
+                fsPath = &path;
+        }
+        if (!vsPath || !fsPath)
         {
             return Result<AssetHandle<ShaderAsset>>(ErrorCode::InvalidParameter, "Vertex and Fragment paths required");
         }
@@ -213,13 +312,14 @@ namespace Vortex
         }
 
         uint64_t id = static_cast<uint64_t>(handle.GetId());
-        Impl::ShaderEntry entry; entry.Name = name; entry.Handle = std::move(handle);
-        m_Impl->m_Shaders[id] = std::move(entry);
+        auto [entryIt, inserted] = m_Impl->m_Shaders.try_emplace(id);
+        entryIt->second.Name = name;
+        entryIt->second.Handle = std::move(handle);
         m_Impl->m_NameToId[name] = id;
-        m_Impl->m_Stats.LoadedPrograms++;
+        m_Impl->m_Stats.LoadedPrograms.fetch_add(1, std::memory_order_relaxed);
 
-        VX_CORE_INFO("ShaderManager: Requested program '{}' (VS='{}', FS='{}') via AssetSystem", name, vsIt->second, fsIt->second);
-        return Result<AssetHandle<ShaderAsset>>(m_Impl->m_Shaders[id].Handle);
+        VX_CORE_INFO("ShaderManager: Requested program '{}' (VS='{}', FS='{}') via AssetSystem", name, *vsPath, *fsPath);
+        return Result<AssetHandle<ShaderAsset>>(entryIt->second.Handle);
     }
 
     Result<std::unordered_map<uint64_t, AssetHandle<ShaderAsset>>> ShaderManager::LoadShaderVariants(const std::string& name, const std::string& filePath, const std::vector<ShaderMacros>& variants, const ShaderCompileOptions& options)
@@ -227,15 +327,15 @@ namespace Vortex
         return Result<std::unordered_map<uint64_t, AssetHandle<ShaderAsset>>>(ErrorCode::NotImplemented, "LoadShaderVariants not yet implemented (consider extending AssetSystem)");
     }
 
-    AssetHandle<ShaderAsset> ShaderManager::FindShader(const std::string& name) const
+    AssetHandle<ShaderAsset> ShaderManager::FindShader(std::string_view name) const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::shared_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
         
         auto it = m_Impl->m_NameToId.find(name);
-        if (it != m_Impl->m_NameToId.end())
+        if (it != m_Impl->m_NameToId.end()) [[likely]]
         {
             auto sit = m_Impl->m_Shaders.find(it->second);
-            if (sit != m_Impl->m_Shaders.end())
+            if (sit != m_Impl->m_Shaders.end()) [[likely]]
             {
                 return sit->second.Handle;
             }
@@ -246,47 +346,48 @@ namespace Vortex
 
     Result<void> ShaderManager::BindShader(const AssetHandle<ShaderAsset>& handle)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
 
-        if (!m_Impl->m_Initialized)
+        if (!m_Impl->m_Initialized) [[unlikely]]
         {
             return Result<void>(ErrorCode::InvalidState, "ShaderManager not initialized");
         }
-        if (!handle.IsValid() || !handle.IsLoaded())
+        if (!handle.IsValid() || !handle.IsLoaded()) [[unlikely]]
         {
             return Result<void>(ErrorCode::InvalidParameter, "Invalid or not yet loaded shader handle");
         }
 
         const ShaderAsset* asset = handle.TryGet();
-        if (!asset || !asset->IsReady() || !asset->GetShader())
+        if (!asset || !asset->IsReady() || !asset->GetShader()) [[unlikely]]
         {
             return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
         }
 
         // Ensure this handle exists in our registry so SetUniform/Unbind work with m_CurrentlyBound.
         const uint64_t id = static_cast<uint64_t>(handle.GetId());
-        auto it = m_Impl->m_Shaders.find(id);
-        if (it == m_Impl->m_Shaders.end())
+        auto [entryIt, inserted] = m_Impl->m_Shaders.try_emplace(id);
+        if (inserted)
         {
-            Impl::ShaderEntry entry;
-            entry.Name = asset->GetName();
-            entry.Handle = handle;
-            m_Impl->m_Shaders[id] = entry;
+            entryIt->second.Name = asset->GetName();
+            entryIt->second.Handle = handle;
             // Only add name mapping if not present to avoid clobbering existing names.
-            if (!entry.Name.empty() && m_Impl->m_NameToId.find(entry.Name) == m_Impl->m_NameToId.end())
+            // try_emplace leaves an existing mapping untouched.
+            if (!entryIt->second.Name.empty())
             {
-                m_Impl->m_NameToId[entry.Name] = id;
+                m_Impl->m_NameToId.try_emplace(entryIt->second.Name, id);
             }
         }
 
         asset->GetShader()->Bind();
         m_Impl->m_CurrentlyBound = id;
+        m_Impl->m_BoundShader = asset->GetShader();
+        m_Impl->m_BoundShaderAtomic.store(m_Impl->m_BoundShader.get(), std::memory_order_release);
         return Result<void>();
     }
 
     void ShaderManager::UnbindShader()
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
         
         if (m_Impl->m_CurrentlyBound != 0)
         {
@@ -299,12 +400,15 @@ namespace Vortex
                 }
             }
             m_Impl->m_CurrentlyBound = 0;
+            // Publish the unbind before dropping the keep-alive ref
+            m_Impl->m_BoundShaderAtomic.store(nullptr, std::memory_order_release);
+            m_Impl->m_BoundShader.reset();
         }
     }
 
     AssetHandle<ShaderAsset> ShaderManager::GetCurrentShader() const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::shared_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
         if (m_Impl->m_CurrentlyBound == 0) return AssetHandle<ShaderAsset>();
         auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
         if (it != m_Impl->m_Shaders.end())
@@ -314,29 +418,44 @@ namespace Vortex
 
     ShaderManager::Stats ShaderManager::GetStats() const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        return m_Impl->m_Stats;
+        Stats stats;
+        stats.LoadedShaders = m_Impl->m_Stats.LoadedShaders.load(std::memory_order_relaxed);
+        stats.LoadedPrograms = m_Impl->m_Stats.LoadedPrograms.load(std::memory_order_relaxed);
+        stats.CacheHits = m_Impl->m_Stats.CacheHits.load(std::memory_order_relaxed);
+        stats.CacheMisses = m_Impl->m_Stats.CacheMisses.load(std::memory_order_relaxed);
+        stats.MemoryUsage = m_Impl->m_Stats.MemoryUsage.load(std::memory_order_relaxed);
+        stats.HotReloads = m_Impl->m_Stats.HotReloads.load(std::memory_order_relaxed);
+        return stats;
     }
 
     std::string ShaderManager::GetDebugInfo() const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        
-        std::stringstream ss;
-        ss << "=== Shader Manager Debug Info ===\n";
-        ss << "Loaded Shaders: " << m_Impl->m_Stats.LoadedShaders << "\n";
-        ss << "Currently Bound: " << m_Impl->m_CurrentlyBound << "\n";
-        ss << "Hot Reload: " << (m_Impl->m_HotReloadEnabled ? "Enabled" : "Disabled") << "\n\n";
+        std::shared_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
         
-        ss << "Loaded Shaders:\n";
+        // fmt into a pre-sized buffer instead of a stringstream: one
+        // allocation for the whole report rather than a growing stream
+        // buffer plus locale-aware formatting per <<
+        fmt::memory_buffer out;
+        out.reserve(256 + m_Impl->m_Shaders.size() * 96);
+        fmt::format_to(std::back_inserter(out),
+                       "=== Shader Manager Debug Info ===\n"
+                       "Loaded Shaders: {}\n"
+                       "Currently Bound: {}\n"
+                       "Hot Reload: {}\n\n"
+                       "Loaded Shaders:\n",
+                       m_Impl->m_Stats.LoadedShaders.load(std::memory_order_relaxed),
+                       m_Impl->m_CurrentlyBound,
+                       m_Impl->m_HotReloadEnabled ? "Enabled" : "Disabled");
+
         for (const auto& [id, entry] : m_Impl->m_Shaders)
         {
             float progress = entry.Handle.GetProgress();
             bool ready = entry.Handle.IsLoaded();
-            ss << "  ID: " << id << ", Name: " << entry.Name << ", Ready: " << (ready ? "Yes" : "No") << ", Progress: " << static_cast<int>(progress * 100.0f) << "%\n";
+            fmt::format_to(std::back_inserter(out), "  ID: {}, Name: {}, Ready: {}, Progress: {}%\n",
+                           id, entry.Name, ready ? "Yes" : "No", static_cast<int>(progress * 100.0f));
         }
-        
-        return ss.str();
+
+        return fmt::to_string(out);
     }
 
     const ShaderProgram* ShaderManager::GetShaderProgram(const AssetHandle<ShaderAsset>& handle) const
@@ -346,7 +465,7 @@ namespace Vortex
 
     const ShaderReflectionData* ShaderManager::GetReflectionData(const AssetHandle<ShaderAsset>& handle) const
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::shared_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
         
         auto it = m_Impl->m_Shaders.find(static_cast<uint64_t>(handle.GetId()));
         if (it != m_Impl->m_Shaders.end())
@@ -363,7 +482,7 @@ namespace Vortex
     void ShaderManager::ClearAllShaders()
     {
         // Take the lock here and avoid re-entrant locking by inlining the unbind logic
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
+        std::unique_lock<std::shared_mutex> lock(m_Impl->m_Mutex);
 
         // Unbind current shader if any (inline to avoid locking twice)
         if (m_Impl->m_CurrentlyBound != 0)
@@ -379,11 +498,13 @@ namespace Vortex
             }
             m_Impl->m_CurrentlyBound = 0;
         }
+        m_Impl->m_BoundShaderAtomic.store(nullptr, std::memory_order_release);
+        m_Impl->m_BoundShader.reset();
 
         // Clear all data
         m_Impl->m_Shaders.clear();
         m_Impl->m_NameToId.clear();
-        m_Impl->m_Stats = {};
+        m_Impl->m_Stats.Reset();
 
         VX_CORE_INFO("Cleared all shaders (AssetSystem-backed)");
     }
@@ -391,26 +512,10 @@ namespace Vortex
     // Uniform management - delegate to currently bound shader
     Result<void> ShaderManager::SetUniform(const std::string& name, const void* data, uint32_t size)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        
-        if (m_Impl->m_CurrentlyBound == 0)
-        {
+        GPUShader* shader = m_Impl->ResolveBoundShader();
+        if (!shader) [[unlikely]]
             return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        }
-
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-        {
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        }
-
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-        {
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        }
-
-        return asset->GetShader()->SetUniform(name, data, size);
+        return shader->SetUniform(name, data, size);
     }
 
     Result<void> ShaderManager::SetUniformBuffer(uint32_t binding, uint32_t bufferId, uint32_t offset, uint32_t size)
@@ -421,117 +526,71 @@ namespace Vortex
     // Convenient uniform setters - call the underlying GPUShader typed setters to avoid generic path warnings
     Result<void> ShaderManager::SetUniform(const std::string& name, int value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, float value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, const glm::vec2& value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, const glm::vec3& value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, const glm::vec4& value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, const glm::mat3& value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
-            return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return m_Impl->SetBoundUniform(name, value);
     }
 
     Result<void> ShaderManager::SetUniform(const std::string& name, const glm::mat4& value)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
+        return m_Impl->SetBoundUniform(name, value);
+    }
+
+    UniformHandle ShaderManager::GetUniformHandle(const std::string& name) const
+    {
+        GPUShader* shader = m_Impl->ResolveBoundShader();
+        if (!shader) [[unlikely]]
+            return UniformHandle{};
+        return shader->GetUniformHandle(name);
+    }
+
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, int value)              { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, float value)            { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, const glm::vec2& value) { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, const glm::vec3& value) { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, const glm::vec4& value) { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, const glm::mat3& value) { return m_Impl->SetBoundUniform(handle, value); }
+    Result<void> ShaderManager::SetUniform(UniformHandle handle, const glm::mat4& value) { return m_Impl->SetBoundUniform(handle, value); }
+
+    Result<void> ShaderManager::SetUniforms(const UniformUpdate* updates, size_t count)
+    {
+        GPUShader* shader = m_Impl->ResolveBoundShader();
+        if (!shader) [[unlikely]]
             return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
-        return asset->GetShader()->SetUniform(name, value);
+        return shader->SetUniforms(updates, count);
     }
 
     Result<void> ShaderManager::SetTexture(const std::string& name, uint32_t textureId, uint32_t slot)
     {
-        std::lock_guard<std::mutex> lock(m_Impl->m_Mutex);
-        if (m_Impl->m_CurrentlyBound == 0)
+        GPUShader* shader = m_Impl->ResolveBoundShader();
+        if (!shader) [[unlikely]]
             return Result<void>(ErrorCode::InvalidState, "No shader currently bound");
-        auto it = m_Impl->m_Shaders.find(m_Impl->m_CurrentlyBound);
-        if (it == m_Impl->m_Shaders.end())
-            return Result<void>(ErrorCode::InvalidState, "Invalid bound shader");
-        const ShaderAsset* asset = it->second.Handle.TryGet();
-        if (!asset || !asset->GetShader())
-            return Result<void>(ErrorCode::InvalidState, "Shader asset not ready");
 
         // Set the sampler uniform and bind texture via render command queue helper
-        auto res = asset->GetShader()->SetTexture(name, textureId, slot);
-        return res;
+        return shader->SetTexture(name, textureId, slot);
     }
 
     // Stubs for other methods
@@ -70,11 +70,13 @@ namespace Vortex
         /**
          * @brief Load a shader program from multiple stage files
          * @param name Program identifier  
-         * @param shaderFiles Map of stage to file path
+         * @param shaderFiles Stage/path pairs, at most one per stage; a flat
+         *                    list since a program never has more than a
+         *                    handful of stages
          * @param options Compilation options
          * @return Shader handle or error
          */
-        Result<AssetHandle<ShaderAsset>> LoadShaderProgram(const std::string& name, const std::unordered_map<ShaderStage, std::string>& shaderFiles, const ShaderCompileOptions& options = {});
+        Result<AssetHandle<ShaderAsset>> LoadShaderProgram(const std::string& name, const std::vector<std::pair<ShaderStage, std::string>>& shaderFiles, const ShaderCompileOptions& options = {});
 
         /**
          * @brief Load shader with variants
@@ -102,7 +104,7 @@ namespace Vortex
          * @param name Shader identifier
          * @return Shader handle, invalid if not found
          */
-        AssetHandle<ShaderAsset> FindShader(const std::string& name) const;
+        AssetHandle<ShaderAsset> FindShader(std::string_view name) const;
 
         /**
          * @brief Get shader reflection data
@@ -167,6 +169,39 @@ namespace Vortex
         Result<void> SetUniform(const std::string& name, const glm::mat3& value);
         Result<void> SetUniform(const std::string& name, const glm::mat4& value);
 
+        /**
+         * @brief Resolve a uniform name on the currently bound shader
+         *
+         * Resolve once when a material or pass is built, then replay the
+         * handle per frame through the handle-based setters below to skip
+         * the per-call name hash and probe. Returns an invalid handle when
+         * no shader is bound or the uniform does not exist.
+         */
+        UniformHandle GetUniformHandle(const std::string& name) const;
+
+        /**
+         * @brief Handle-based setters for pre-resolved uniforms
+         */
+        Result<void> SetUniform(UniformHandle handle, int value);
+        Result<void> SetUniform(UniformHandle handle, float value);
+        Result<void> SetUniform(UniformHandle handle, const glm::vec2& value);
+        Result<void> SetUniform(UniformHandle handle, const glm::vec3& value);
+        Result<void> SetUniform(UniformHandle handle, const glm::vec4& value);
+        Result<void> SetUniform(UniformHandle handle, const glm::mat3& value);
+        Result<void> SetUniform(UniformHandle handle, const glm::mat4& value);
+
+        /**
+         * @brief Apply a batch of pre-resolved uniform updates
+         *
+         * Resolves the bound shader once and hands the whole batch to
+         * GPUShader::SetUniforms in a single virtual call; see there for
+         * per-entry semantics.
+         * @param updates Pointer to the first update
+         * @param count Number of updates
+         * @return Success/failure result
+         */
+        Result<void> SetUniforms(const UniformUpdate* updates, size_t count);
+
         /**
          * @brief Bind a texture uniform by name (sets sampler to slot and binds texture)
          */
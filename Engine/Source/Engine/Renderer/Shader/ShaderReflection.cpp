@@ -3,16 +3,6 @@
 #include "Core/Debug/Log.h"
 #include "Core/Debug/ErrorCodes.h"
 
-// Helper for unordered_map with pair keys
-struct PairHash {
-    template <class T1, class T2>
-    std::size_t operator()(const std::pair<T1, T2>& p) const {
-        auto hash1 = std::hash<T1>{}(p.first);
-        auto hash2 = std::hash<T2>{}(p.second);
-        return hash1 ^ (hash2 << 1); // Simple hash combination
-    }
-};
-
 #ifdef VX_SPIRV_CROSS_AVAILABLE
     #include <spirv_cross.hpp>
     #include <spirv_glsl.hpp>
@@ -34,18 +24,22 @@ namespace Vortex
             
             // Create SPIRV-Cross compiler
             spirv_cross::Compiler compiler(spirv);
-            
+
+            // Gather the resource lists once; get_shader_resources walks
+            // the IR and allocates descriptor vectors on every call
+            const spirv_cross::ShaderResources resources = compiler.get_shader_resources();
+
             // Extract all reflection data
-            ExtractUniforms(compiler, reflection);
-            ExtractResources(compiler, reflection);
-            ExtractVertexInputs(compiler, reflection);
+            ExtractUniforms(compiler, resources, reflection);
+            ExtractResources(compiler, resources, reflection);
+            ExtractVertexInputs(compiler, resources, reflection);
             
             if (stage == ShaderStage::Compute)
             {
                 ExtractComputeInfo(compiler, reflection);
             }
             
-            ExtractStatistics(compiler, reflection);
+            ExtractStatistics(resources, reflection);
             
             return Result<ShaderReflectionData>(std::move(reflection));
         }
@@ -60,10 +54,46 @@ namespace Vortex
             return Result<ShaderReflectionData>(ErrorCode::Unknown, e.what());
         }
 #else
-        // Fallback: minimal reflection without SPIRV-Cross
+        // Fallback: minimal reflection without SPIRV-Cross. One linear pass
+        // over the word stream recovers what does not need full type
+        // resolution - the actual instruction count (the old stub reported
+        // the word count) and the compute workgroup size. Each instruction
+        // word packs its opcode in the low half and its word count in the
+        // high half, so the scan just hops from header to header; uniform
+        // and resource extraction still requires SPIRV-Cross.
         VX_CORE_WARN("SPIRV-Cross not available, using minimal reflection");
+
+        constexpr uint32_t kSpirVMagic = 0x07230203u;
+        constexpr size_t kHeaderWords = 5;
+        constexpr uint16_t kOpExecutionMode = 16;
+        constexpr uint32_t kExecutionModeLocalSize = 17;
+
+        if (spirv.size() < kHeaderWords || spirv[0] != kSpirVMagic)
+        {
+            return Result<ShaderReflectionData>(ErrorCode::InvalidParameter, "Invalid SPIR-V module header");
+        }
+
         ShaderReflectionData reflection;
-        reflection.InstructionCount = static_cast<uint32_t>(spirv.size());
+        uint32_t instructionCount = 0;
+        size_t i = kHeaderWords;
+        while (i < spirv.size())
+        {
+            const uint32_t word = spirv[i];
+            const uint16_t opcode = static_cast<uint16_t>(word & 0xFFFFu);
+            const uint16_t wordCount = static_cast<uint16_t>(word >> 16);
+            if (wordCount == 0 || i + wordCount > spirv.size()) [[unlikely]]
+            {
+                return Result<ShaderReflectionData>(ErrorCode::InvalidParameter, "Malformed SPIR-V instruction stream");
+            }
+            ++instructionCount;
+
+            if (opcode == kOpExecutionMode && wordCount >= 6 && spirv[i + 2] == kExecutionModeLocalSize)
+            {
+                reflection.LocalSize = glm::uvec3(spirv[i + 3], spirv[i + 4], spirv[i + 5]);
+            }
+            i += wordCount;
+        }
+        reflection.InstructionCount = instructionCount;
         return Result<ShaderReflectionData>(std::move(reflection));
 #endif
     }
@@ -72,11 +102,29 @@ namespace Vortex
     {
         ShaderReflectionData combined;
 
-        // Maps to track merged resources by name for conflict resolution
-        std::unordered_map<std::string, ShaderUniform> uniformMap;
-        std::unordered_map<std::string, ShaderResource> resourceMap;
-        std::unordered_map<std::string, ShaderVertexInput> vertexInputMap;
-        std::unordered_map<uint32_t, std::vector<ShaderUniform>> uniformBufferMap;
+        // Maps to track merged resources by name for conflict resolution.
+        // Keys are views into the source reflections' name strings, which
+        // outlive the merge - saves a key string copy per entry; the mapped
+        // values still own their names for the copy-out at the end
+        std::unordered_map<std::string_view, ShaderUniform> uniformMap;
+        std::unordered_map<std::string_view, ShaderResource> resourceMap;
+        std::unordered_map<std::string_view, ShaderVertexInput> vertexInputMap;
+        ShaderUniformBufferMap uniformBufferMap;
+
+        // Size the merge maps up front so the merge loops never rehash;
+        // the totals over-count shared names, which just leaves slack
+        size_t uniformTotal = 0, resourceTotal = 0, vertexInputTotal = 0, bufferTotal = 0;
+        for (const auto& reflection : reflections)
+        {
+            uniformTotal += reflection.Uniforms.size();
+            resourceTotal += reflection.Resources.size();
+            vertexInputTotal += reflection.VertexInputs.size();
+            bufferTotal += reflection.UniformBuffers.size();
+        }
+        uniformMap.reserve(uniformTotal);
+        resourceMap.reserve(resourceTotal);
+        vertexInputMap.reserve(vertexInputTotal);
+        uniformBufferMap.reserve(bufferTotal);
 
         // Track which stages contributed to this reflection
         ShaderStageFlags contributingStages = 0;
@@ -230,27 +278,44 @@ namespace Vortex
             }
         }
 
-        // Check for resource conflicts (same binding different types)
-        std::unordered_map<std::pair<uint32_t, uint32_t>, ShaderResource, PairHash> vertexResources;
-        std::unordered_map<std::pair<uint32_t, uint32_t>, ShaderResource, PairHash> fragmentResources;
+        // Check for resource conflicts (same binding different types).
+        // Shaders declare a handful of resources at most, so instead of
+        // hashing (set, binding) pairs into a map we sort both sides by a
+        // packed 64-bit key and merge-join them - two small vectors that
+        // fit in L1 and no per-entry allocations
+        const auto packKey = [](const ShaderResource& resource) {
+            return (static_cast<uint64_t>(resource.Set) << 32) | resource.Binding;
+        };
+        const auto gatherSorted = [&packKey](const std::vector<ShaderResource>& resources) {
+            std::vector<std::pair<uint64_t, const ShaderResource*>> sorted;
+            sorted.reserve(resources.size());
+            for (const auto& resource : resources)
+            {
+                sorted.emplace_back(packKey(resource), &resource);
+            }
+            std::sort(sorted.begin(), sorted.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+            return sorted;
+        };
 
-        for (const auto& resource : vertexReflection.Resources)
-        {
-            vertexResources[{resource.Set, resource.Binding}] = resource;
-        }
-
-        for (const auto& resource : fragmentReflection.Resources)
-        {
-            fragmentResources[{resource.Set, resource.Binding}] = resource;
-        }
+        const auto vertexResources = gatherSorted(vertexReflection.Resources);
+        const auto fragmentResources = gatherSorted(fragmentReflection.Resources);
 
         // Check for binding conflicts
-        for (const auto& [key, vertexResource] : vertexResources)
+        for (size_t v = 0, f = 0; v < vertexResources.size() && f < fragmentResources.size();)
         {
-            auto it = fragmentResources.find(key);
-            if (it != fragmentResources.end())
+            if (vertexResources[v].first < fragmentResources[f].first)
+            {
+                ++v;
+            }
+            else if (fragmentResources[f].first < vertexResources[v].first)
             {
-                const auto& fragmentResource = it->second;
+                ++f;
+            }
+            else
+            {
+                const auto& vertexResource = *vertexResources[v].second;
+                const auto& fragmentResource = *fragmentResources[f].second;
                 if (vertexResource.Type != fragmentResource.Type)
                 {
                     VX_CORE_ERROR("Resource binding conflict at set {}, binding {}: vertex uses {}, fragment uses {}",
@@ -258,6 +323,8 @@ namespace Vortex
                         static_cast<int>(vertexResource.Type), static_cast<int>(fragmentResource.Type));
                     isCompatible = false;
                 }
+                ++v;
+                ++f;
             }
         }
 
@@ -369,105 +436,93 @@ namespace Vortex
 
     #ifdef VX_SPIRV_CROSS_AVAILABLE
     
-    ShaderDataType ShaderReflection::SPIRTypeToShaderDataType(const spirv_cross::SPIRType& type)
+    ShaderDataType ShaderReflection::SPIRTypeToShaderDataType(const spirv_cross::SPIRType& type) noexcept
     {
         using namespace spirv_cross;
-        
-        if (type.basetype == SPIRType::Boolean && type.vecsize == 1)
-            return ShaderDataType::Bool;
-        
-        if (type.basetype == SPIRType::Int)
-        {
-            switch (type.vecsize)
-            {
-                case 1: return ShaderDataType::Int;
-                case 2: return ShaderDataType::IVec2;
-                case 3: return ShaderDataType::IVec3;
-                case 4: return ShaderDataType::IVec4;
-            }
-        }
-        
-        if (type.basetype == SPIRType::UInt)
-        {
-            switch (type.vecsize)
-            {
-                case 1: return ShaderDataType::UInt;
-                case 2: return ShaderDataType::UVec2;
-                case 3: return ShaderDataType::UVec3;
-                case 4: return ShaderDataType::UVec4;
-            }
-        }
-        
-        if (type.basetype == SPIRType::Float)
+
+        // Shape-carrying base types fold into one table lookup keyed by
+        // (kind, columns, vecsize), replacing the old branch cascade - the
+        // same flat-table shape as the stage/type helpers in the compiler.
+        // Base types that ignore the shape fields resolve in the switch.
+        static constexpr ShaderDataType kShapeTable[3][4][4] = {
+            { // Int
+                { ShaderDataType::Int, ShaderDataType::IVec2, ShaderDataType::IVec3, ShaderDataType::IVec4 },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+            },
+            { // UInt
+                { ShaderDataType::UInt, ShaderDataType::UVec2, ShaderDataType::UVec3, ShaderDataType::UVec4 },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown },
+            },
+            { // Float: column 1 is the vector row, square shapes are matrices
+                { ShaderDataType::Float, ShaderDataType::Vec2, ShaderDataType::Vec3, ShaderDataType::Vec4 },
+                { ShaderDataType::Unknown, ShaderDataType::Mat2, ShaderDataType::Unknown, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Mat3, ShaderDataType::Unknown },
+                { ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Unknown, ShaderDataType::Mat4 },
+            },
+        };
+
+        uint32_t kind;
+        switch (type.basetype)
         {
-            if (type.columns == 1)
-            {
-                switch (type.vecsize)
-                {
-                    case 1: return ShaderDataType::Float;
-                    case 2: return ShaderDataType::Vec2;
-                    case 3: return ShaderDataType::Vec3;
-                    case 4: return ShaderDataType::Vec4;
-                }
-            }
-            else if (type.columns > 1)  // Matrix types
-            {
-                if (type.columns == 2 && type.vecsize == 2)
-                    return ShaderDataType::Mat2;
-                if (type.columns == 3 && type.vecsize == 3)
-                    return ShaderDataType::Mat3;
-                if (type.columns == 4 && type.vecsize == 4)
-                    return ShaderDataType::Mat4;
-            }
+            case SPIRType::Boolean: return type.vecsize == 1 ? ShaderDataType::Bool : ShaderDataType::Unknown;
+            case SPIRType::Double:  return ShaderDataType::Double;
+            case SPIRType::Struct:  return ShaderDataType::Struct;
+            case SPIRType::Int:     kind = 0; break;
+            case SPIRType::UInt:    kind = 1; break;
+            case SPIRType::Float:   kind = 2; break;
+            default:                return ShaderDataType::Unknown;
         }
-        
-        if (type.basetype == SPIRType::Double)
-            return ShaderDataType::Double;
-        
-        if (type.basetype == SPIRType::Struct)
-            return ShaderDataType::Struct;
-        
-        return ShaderDataType::Unknown;
+
+        if (type.columns - 1 >= 4 || type.vecsize - 1 >= 4)
+            return ShaderDataType::Unknown;
+        return kShapeTable[kind][type.columns - 1][type.vecsize - 1];
     }
     
-    ShaderResourceType ShaderReflection::DeduceResourceType(const spirv_cross::SPIRType& type)
+    ShaderResourceType ShaderReflection::DeduceResourceType(const spirv_cross::SPIRType& type) noexcept
     {
         using namespace spirv_cross;
-        
+
+        // Image dimensionality maps straight off spv::Dim (1D=0, 2D=1,
+        // 3D=2, Cube=3); Rect/Buffer/SubpassData fall past the table and
+        // classify as 2D, matching the old default branch
+        static constexpr ShaderResourceType kDimToResourceType[] = {
+            ShaderResourceType::Texture1D,
+            ShaderResourceType::Texture2D,
+            ShaderResourceType::Texture3D,
+            ShaderResourceType::TextureCube,
+        };
+
         switch (type.basetype)
         {
             case SPIRType::Image:
-                switch (type.image.dim)
-                {
-                    case spv::Dim1D: return ShaderResourceType::Texture1D;
-                    case spv::Dim2D: return ShaderResourceType::Texture2D;
-                    case spv::Dim3D: return ShaderResourceType::Texture3D;
-                    case spv::DimCube: return ShaderResourceType::TextureCube;
-                    default: return ShaderResourceType::Texture2D;
-                }
             case SPIRType::SampledImage:
-                switch (type.image.dim)
-                {
-                    case spv::Dim1D: return ShaderResourceType::Texture1D;
-                    case spv::Dim2D: return ShaderResourceType::Texture2D;
-                    case spv::Dim3D: return ShaderResourceType::Texture3D;
-                    case spv::DimCube: return ShaderResourceType::TextureCube;
-                    default: return ShaderResourceType::Texture2D;
-                }
+                return static_cast<size_t>(type.image.dim) < std::size(kDimToResourceType)
+                    ? kDimToResourceType[type.image.dim]
+                    : ShaderResourceType::Texture2D;
             case SPIRType::Sampler:
                 return ShaderResourceType::Sampler;
             case SPIRType::Struct:
-                return ShaderResourceType::UniformBuffer;
             default:
                 return ShaderResourceType::UniformBuffer;
         }
     }
     
-    void ShaderReflection::ExtractUniforms(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection)
+    void ShaderReflection::ExtractUniforms(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection)
     {
-        // Get all shader resources
-        spirv_cross::ShaderResources resources = compiler.get_shader_resources();
-        
+        // Member counts are known up front from the struct types, so size
+        // the flat uniform list once instead of growing it per push_back
+        size_t uniformTotal = 0;
+        for (const auto& resource : resources.uniform_buffers)
+            uniformTotal += compiler.get_type(resource.type_id).member_types.size();
+        for (const auto& resource : resources.push_constant_buffers)
+            uniformTotal += compiler.get_type(resource.type_id).member_types.size();
+        reflection.Uniforms.reserve(uniformTotal);
+        reflection.UniformBuffers.reserve(resources.uniform_buffers.size());
+
         // Extract uniform buffers
         for (const auto& resource : resources.uniform_buffers)
         {
@@ -476,26 +531,51 @@ namespace Vortex
             uint32_t binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
             
             std::vector<ShaderUniform> bufferUniforms;
+            bufferUniforms.reserve(type.member_types.size());
+
+            // Only members the shader actually reads get entries; declared-
+            // but-unused fields of big shared constant blocks keep their
+            // space in the std140 layout but need no name strings or lookup
+            // slots. An empty range list means SPIRV-Cross could not narrow
+            // the usage (or the buffer is wholly unused), so keep everything
+            // rather than guess
+            std::vector<bool> memberActive;
+            const auto activeRanges = compiler.get_active_buffer_ranges(resource.id);
+            if (!activeRanges.empty())
+            {
+                memberActive.assign(type.member_types.size(), false);
+                for (const auto& range : activeRanges)
+                {
+                    if (range.index < memberActive.size())
+                        memberActive[range.index] = true;
+                }
+            }
             
             // Process struct members
             for (uint32_t i = 0; i < type.member_types.size(); ++i)
             {
+                if (!memberActive.empty() && !memberActive[i])
+                    continue;
+
                 const auto& memberType = compiler.get_type(type.member_types[i]);
-                std::string memberName = compiler.get_member_name(resource.type_id, i);
                 
                 ShaderUniform uniform;
-                uniform.Name = memberName;
+                uniform.Name = compiler.get_member_name(resource.type_id, i);
                 uniform.Type = SPIRTypeToShaderDataType(memberType);
                 uniform.Size = static_cast<uint32_t>(compiler.get_declared_struct_member_size(type, i));
                 uniform.Offset = compiler.type_struct_member_offset(type, i);
                 uniform.ArraySize = memberType.array.empty() ? 0 : memberType.array[0];
                 uniform.Location = binding;
                 
-                bufferUniforms.push_back(uniform);
+                reflection.MemoryUsage += uniform.Size;
+
+                // The flat list takes the copy, the block layout takes the
+                // original - one name allocation instead of three
                 reflection.Uniforms.push_back(uniform);
+                bufferUniforms.push_back(std::move(uniform));
             }
             
-            reflection.UniformBuffers[binding] = bufferUniforms;
+            reflection.UniformBuffers[binding] = std::move(bufferUniforms);
         }
         
         // Extract push constants
@@ -506,94 +586,61 @@ namespace Vortex
             for (uint32_t i = 0; i < type.member_types.size(); ++i)
             {
                 const auto& memberType = compiler.get_type(type.member_types[i]);
-                std::string memberName = compiler.get_member_name(resource.type_id, i);
                 
                 ShaderUniform uniform;
-                uniform.Name = memberName;
+                uniform.Name = compiler.get_member_name(resource.type_id, i);
                 uniform.Type = SPIRTypeToShaderDataType(memberType);
                 uniform.Size = static_cast<uint32_t>(compiler.get_declared_struct_member_size(type, i));
                 uniform.Offset = compiler.type_struct_member_offset(type, i);
                 uniform.ArraySize = memberType.array.empty() ? 0 : memberType.array[0];
                 uniform.Location = 0;  // Push constants don't have bindings
                 
-                reflection.Uniforms.push_back(uniform);
+                reflection.MemoryUsage += uniform.Size;
+                reflection.Uniforms.push_back(std::move(uniform));
             }
         }
     }
     
-    void ShaderReflection::ExtractResources(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection)
+    void ShaderReflection::ExtractResources(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection)
     {
-        spirv_cross::ShaderResources resources = compiler.get_shader_resources();
-        
-        // Extract sampled images (textures)
-        for (const auto& resource : resources.sampled_images)
-        {
-            const auto& type = compiler.get_type(resource.type_id);
-            
-            ShaderResource shaderResource;
-            shaderResource.Name = resource.name;
-            shaderResource.Type = DeduceResourceType(type);
-            shaderResource.Set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            shaderResource.Binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
-            shaderResource.ArraySize = type.array.empty() ? 1 : type.array[0];
-            shaderResource.Stages = 0;  // Will be set when combining reflections
-            
-            reflection.Resources.push_back(shaderResource);
-        }
-        
-        // Extract separate images
-        for (const auto& resource : resources.separate_images)
-        {
-            const auto& type = compiler.get_type(resource.type_id);
-            
-            ShaderResource shaderResource;
-            shaderResource.Name = resource.name;
-            shaderResource.Type = DeduceResourceType(type);
-            shaderResource.Set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            shaderResource.Binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
-            shaderResource.ArraySize = type.array.empty() ? 1 : type.array[0];
-            shaderResource.Stages = 0;
-            
-            reflection.Resources.push_back(shaderResource);
-        }
-        
-        // Extract separate samplers
-        for (const auto& resource : resources.separate_samplers)
-        {
-            const auto& type = compiler.get_type(resource.type_id);
-            
-            ShaderResource shaderResource;
-            shaderResource.Name = resource.name;
-            shaderResource.Type = ShaderResourceType::Sampler;
-            shaderResource.Set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            shaderResource.Binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
-            shaderResource.ArraySize = type.array.empty() ? 1 : type.array[0];
-            shaderResource.Stages = 0;
-            
-            reflection.Resources.push_back(shaderResource);
-        }
-        
-        // Extract storage buffers
-        for (const auto& resource : resources.storage_buffers)
-        {
-            const auto& type = compiler.get_type(resource.type_id);
-            
-            ShaderResource shaderResource;
-            shaderResource.Name = resource.name;
-            shaderResource.Type = ShaderResourceType::StorageBuffer;
-            shaderResource.Set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            shaderResource.Binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
-            shaderResource.ArraySize = type.array.empty() ? 1 : type.array[0];
-            shaderResource.Stages = 0;
-            
-            reflection.Resources.push_back(shaderResource);
-        }
+        reflection.Resources.reserve(reflection.Resources.size()
+            + resources.sampled_images.size()
+            + resources.separate_images.size()
+            + resources.separate_samplers.size()
+            + resources.storage_buffers.size());
+
+        // One loop body serves all four resource lists; only the type
+        // classification differs per list, so it comes in as a lambda. The
+        // get_type call stays in the shared body because every list needs
+        // the array dimensions
+        auto emitResources = [&compiler, &reflection](const auto& list, auto&& classify)
+        {
+            for (const auto& resource : list)
+            {
+                const auto& type = compiler.get_type(resource.type_id);
+
+                ShaderResource shaderResource;
+                shaderResource.Name = resource.name;
+                shaderResource.Type = classify(type);
+                shaderResource.Set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+                shaderResource.Binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+                shaderResource.ArraySize = type.array.empty() ? 1 : type.array[0];
+                shaderResource.Stages = 0;  // Will be set when combining reflections
+
+                reflection.Resources.push_back(std::move(shaderResource));
+            }
+        };
+
+        auto deduce = [this](const spirv_cross::SPIRType& type) { return DeduceResourceType(type); };
+        emitResources(resources.sampled_images, deduce);
+        emitResources(resources.separate_images, deduce);
+        emitResources(resources.separate_samplers, [](const spirv_cross::SPIRType&) { return ShaderResourceType::Sampler; });
+        emitResources(resources.storage_buffers, [](const spirv_cross::SPIRType&) { return ShaderResourceType::StorageBuffer; });
     }
     
-    void ShaderReflection::ExtractVertexInputs(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection)
+    void ShaderReflection::ExtractVertexInputs(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection)
     {
-        spirv_cross::ShaderResources resources = compiler.get_shader_resources();
-        
+        reflection.VertexInputs.reserve(resources.stage_inputs.size());
         for (const auto& input : resources.stage_inputs)
         {
             const auto& type = compiler.get_type(input.type_id);
@@ -604,7 +651,7 @@ namespace Vortex
             vertexInput.Type = SPIRTypeToShaderDataType(type);
             vertexInput.Size = GetShaderDataTypeSize(vertexInput.Type);
             
-            reflection.VertexInputs.push_back(vertexInput);
+            reflection.VertexInputs.push_back(std::move(vertexInput));
         }
     }
     
@@ -614,47 +661,34 @@ namespace Vortex
         const auto& execution = compiler.get_execution_model();
         if (execution == spv::ExecutionModelGLCompute)
         {
-            // Use default workgroup size from entry points
-            try {
-                const auto& entryPoints = compiler.get_entry_points_and_stages();
-                if (!entryPoints.empty())
-                {
-                    auto localSize = compiler.get_entry_point(entryPoints[0].name, entryPoints[0].execution_model).workgroup_size;
-                    reflection.LocalSize = glm::uvec3(localSize.x, localSize.y, localSize.z);
-                }
-            } catch (...) {
-                // Default to 1x1x1 workgroup if we can't extract the info
-                reflection.LocalSize = glm::uvec3(1, 1, 1);
-                VX_CORE_WARN("Failed to extract compute workgroup size, defaulting to (1,1,1)");
+            // Use default workgroup size from entry points. No local catch:
+            // SPIRV-Cross only throws CompilerError, and Reflect's boundary
+            // already turns that into a proper error result - better than
+            // the old silent (1,1,1) fallback for a module whose entry
+            // point cannot be read
+            const auto& entryPoints = compiler.get_entry_points_and_stages();
+            if (!entryPoints.empty())
+            {
+                auto localSize = compiler.get_entry_point(entryPoints[0].name, entryPoints[0].execution_model).workgroup_size;
+                reflection.LocalSize = glm::uvec3(localSize.x, localSize.y, localSize.z);
             }
         }
     }
     
-    void ShaderReflection::ExtractStatistics(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection)
+    void ShaderReflection::ExtractStatistics(const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection) noexcept
     {
-        // Get basic statistics - use a simple estimation since get_ir() API has changed
-        try {
-            // Estimate instruction count based on available data
-            reflection.InstructionCount = 0;
-            
-            // Count resources as a rough measure of complexity
-            spirv_cross::ShaderResources resources = compiler.get_shader_resources();
-            reflection.InstructionCount += static_cast<uint32_t>(
-                resources.uniform_buffers.size() + 
-                resources.sampled_images.size() + 
-                resources.storage_buffers.size() + 
-                resources.stage_inputs.size() + 
-                resources.stage_outputs.size());
-        } catch (...) {
-            reflection.InstructionCount = 0;
-        }
-        
-        // Estimate memory usage based on resources
-        reflection.MemoryUsage = 0;
-        for (const auto& uniform : reflection.Uniforms)
-        {
-            reflection.MemoryUsage += uniform.Size;
-        }
+        // Estimate instruction count from the gathered resource counts as a
+        // rough complexity measure; nothing here can throw, so the old
+        // catch-all was pure exception-table weight
+        reflection.InstructionCount = static_cast<uint32_t>(
+            resources.uniform_buffers.size() + 
+            resources.sampled_images.size() + 
+            resources.storage_buffers.size() + 
+            resources.stage_inputs.size() + 
+            resources.stage_outputs.size());
+
+        // MemoryUsage was accumulated as ExtractUniforms built each entry;
+        // re-walking the uniform list here would touch it all a second time
     }
     
     uint32_t ShaderReflection::CalculateStructSize(spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& type)
@@ -662,7 +696,7 @@ namespace Vortex
         return static_cast<uint32_t>(compiler.get_declared_struct_size(type));
     }
     
-    uint32_t ShaderReflection::CalculateAlignment(const spirv_cross::SPIRType& type)
+    uint32_t ShaderReflection::CalculateAlignment(const spirv_cross::SPIRType& type) noexcept
     {
         // Basic alignment calculation - can be enhanced
         switch (type.basetype)
@@ -806,65 +840,91 @@ namespace Vortex
     
     std::vector<ReflectionUtils::DescriptorSetLayout> ReflectionUtils::GenerateDescriptorSetLayouts(const ShaderReflectionData& reflection)
     {
-        std::unordered_map<uint32_t, std::vector<ShaderResource>> setMap;
-        
-        // Group resources by descriptor set
+        // Bucket by set index directly: sets run 0..3 in practice (Vulkan
+        // guarantees at least 4), so a fixed array replaces the hash map
+        // this used to build, and moving each bucket into its layout skips
+        // the per-resource copy the map round-trip cost
+        constexpr uint32_t kMaxDescriptorSets = 8;
+        std::array<std::vector<ShaderResource>, kMaxDescriptorSets> buckets;
+
+        std::vector<DescriptorSetLayout> layouts;
         for (const auto& resource : reflection.Resources)
         {
-            setMap[resource.Set].push_back(resource);
+            if (resource.Set < kMaxDescriptorSets) [[likely]]
+            {
+                buckets[resource.Set].push_back(resource);
+            }
+            else
+            {
+                // Out-of-range sets are legal SPIR-V; keep them via a slow
+                // path so the layout list stays complete
+                auto it = std::find_if(layouts.begin(), layouts.end(),
+                    [&](const DescriptorSetLayout& layout) { return layout.Set == resource.Set; });
+                if (it == layouts.end())
+                {
+                    layouts.push_back({ resource.Set, {} });
+                    it = std::prev(layouts.end());
+                }
+                it->Bindings.push_back(resource);
+            }
         }
-        
-        std::vector<DescriptorSetLayout> layouts;
-        for (const auto& [set, resources] : setMap)
+
+        for (uint32_t set = 0; set < kMaxDescriptorSets; ++set)
         {
-            DescriptorSetLayout layout;
-            layout.Set = set;
-            layout.Bindings = resources;
-            layouts.push_back(layout);
+            if (!buckets[set].empty())
+            {
+                layouts.push_back({ set, std::move(buckets[set]) });
+            }
         }
-        
+
         return layouts;
     }
     
     std::string ReflectionUtils::PrintReflectionInfo(const ShaderReflectionData& reflection)
     {
-        std::ostringstream oss;
-        
-        oss << "Shader Reflection Information:\n";
-        oss << "============================\n";
-        oss << "Instructions: " << reflection.InstructionCount << "\n";
-        oss << "Memory Usage: " << reflection.MemoryUsage << " bytes\n";
-        
+        // One fmt buffer instead of ostringstream: no locale machinery, and
+        // one up-front reservation instead of an allocation per chunk
+        fmt::memory_buffer out;
+        out.reserve(128 + reflection.Uniforms.size() * 80
+            + reflection.Resources.size() * 64
+            + reflection.VertexInputs.size() * 64);
+
+        fmt::format_to(std::back_inserter(out),
+            "Shader Reflection Information:\n"
+            "============================\n"
+            "Instructions: {}\n"
+            "Memory Usage: {} bytes\n",
+            reflection.InstructionCount, reflection.MemoryUsage);
+
         if (reflection.LocalSize.x > 0 || reflection.LocalSize.y > 0 || reflection.LocalSize.z > 0)
         {
-            oss << "Compute Workgroup Size: (" << reflection.LocalSize.x << ", " 
-                << reflection.LocalSize.y << ", " << reflection.LocalSize.z << ")\n";
+            fmt::format_to(std::back_inserter(out), "Compute Workgroup Size: ({}, {}, {})\n",
+                reflection.LocalSize.x, reflection.LocalSize.y, reflection.LocalSize.z);
         }
-        
-        oss << "\nUniforms (" << reflection.Uniforms.size() << "):\n";
+
+        fmt::format_to(std::back_inserter(out), "\nUniforms ({}):\n", reflection.Uniforms.size());
         for (const auto& uniform : reflection.Uniforms)
         {
-            oss << "  - " << uniform.Name << " (" << ShaderDataTypeToString(uniform.Type) 
-                << ", Size: " << uniform.Size << ", Offset: " << uniform.Offset 
-                << ", Location: " << uniform.Location << ")\n";
+            fmt::format_to(std::back_inserter(out), "  - {} ({}, Size: {}, Offset: {}, Location: {})\n",
+                uniform.Name, ShaderDataTypeToString(uniform.Type),
+                uniform.Size, uniform.Offset, uniform.Location);
         }
-        
-        oss << "\nResources (" << reflection.Resources.size() << "):\n";
+
+        fmt::format_to(std::back_inserter(out), "\nResources ({}):\n", reflection.Resources.size());
         for (const auto& resource : reflection.Resources)
         {
-            oss << "  - " << resource.Name << " (Set: " << resource.Set 
-                << ", Binding: " << resource.Binding << ", Array: " << resource.ArraySize << ")\n";
+            fmt::format_to(std::back_inserter(out), "  - {} (Set: {}, Binding: {}, Array: {})\n",
+                resource.Name, resource.Set, resource.Binding, resource.ArraySize);
         }
-        
-        oss << "\nVertex Inputs (" << reflection.VertexInputs.size() << "):\n";
+
+        fmt::format_to(std::back_inserter(out), "\nVertex Inputs ({}):\n", reflection.VertexInputs.size());
         for (const auto& input : reflection.VertexInputs)
         {
-            oss << "  - " << input.Name << " (Location: " << input.Location 
-                << ", Type: " << ShaderDataTypeToString(input.Type) 
-                << ", Size: " << input.Size << ")\n";
+            fmt::format_to(std::back_inserter(out), "  - {} (Location: {}, Type: {}, Size: {})\n",
+                input.Name, input.Location, ShaderDataTypeToString(input.Type), input.Size);
         }
-        
-        return oss.str();
+
+        return fmt::to_string(out);
     }
 
 } // namespace Vortex
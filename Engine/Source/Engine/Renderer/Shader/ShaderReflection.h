@@ -9,6 +9,7 @@ namespace spirv_cross
     class Compiler;
     struct SPIRType;
     struct Resource;
+    struct ShaderResources;
 }
 
 namespace Vortex
@@ -63,15 +64,18 @@ namespace Vortex
 
     private:
         // SPIRV-Cross helper methods
-        ShaderDataType SPIRTypeToShaderDataType(const spirv_cross::SPIRType& type);
-        ShaderResourceType DeduceResourceType(const spirv_cross::SPIRType& type);
+        ShaderDataType SPIRTypeToShaderDataType(const spirv_cross::SPIRType& type) noexcept;
+        ShaderResourceType DeduceResourceType(const spirv_cross::SPIRType& type) noexcept;
 
-        // Reflection extraction methods
-        void ExtractUniforms(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection);
-        void ExtractResources(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection);
-        void ExtractVertexInputs(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection);
+        // Reflection extraction methods. Each walk of
+        // compiler.get_shader_resources() re-traverses the IR and
+        // materializes fresh descriptor vectors, so Reflect gathers the
+        // resource lists once and threads them through every helper.
+        void ExtractUniforms(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection);
+        void ExtractResources(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection);
+        void ExtractVertexInputs(spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection);
         void ExtractComputeInfo(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection);
-        void ExtractStatistics(spirv_cross::Compiler& compiler, ShaderReflectionData& reflection);
+        void ExtractStatistics(const spirv_cross::ShaderResources& resources, ShaderReflectionData& reflection) noexcept;
 
         // Merge validation helper methods
         static bool AreUniformsCompatible(const ShaderUniform& a, const ShaderUniform& b);
@@ -81,7 +85,7 @@ namespace Vortex
 
         // Utility methods
         uint32_t CalculateStructSize(spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& type);
-        uint32_t CalculateAlignment(const spirv_cross::SPIRType& type);
+        uint32_t CalculateAlignment(const spirv_cross::SPIRType& type) noexcept;
     };
 
     /**
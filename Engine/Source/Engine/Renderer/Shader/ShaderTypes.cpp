@@ -3,25 +3,150 @@
 
 namespace Vortex
 {
-    const char* ShaderStageToString(ShaderStage stage)
+    // ============================================================================
+    // SHADER MACRO SET
+    // ============================================================================
+
+    void ShaderMacroSet::Set(std::string_view name, std::string_view value)
+    {
+        // Binary search for the insert slot; macro sets are small (a handful
+        // of feature switches), so the vector shuffle on insert is cheap and
+        // every later walk gets the sorted order for free
+        auto it = std::lower_bound(m_Names.begin(), m_Names.end(), name);
+        const size_t index = static_cast<size_t>(it - m_Names.begin());
+        if (it != m_Names.end() && *it == name)
+        {
+            m_Values[index].assign(value);
+            return;
+        }
+
+        m_Names.emplace(it, name);
+        m_Values.emplace(m_Values.begin() + index, value);
+    }
+
+    std::optional<std::string_view> ShaderMacroSet::Find(std::string_view name) const
+    {
+        auto it = std::lower_bound(m_Names.begin(), m_Names.end(), name);
+        if (it == m_Names.end() || *it != name)
+            return std::nullopt;
+        return std::string_view(m_Values[static_cast<size_t>(it - m_Names.begin())]);
+    }
+
+    // ============================================================================
+    // SHADER UNIFORM LOOKUP
+    // ============================================================================
+
+    uint64_t ShaderUniformLookup::HashName(std::string_view name)
+    {
+        // FNV-1a 64-bit; 0 is reserved for empty slots
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : name)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash != 0 ? hash : 1;
+    }
+
+    void ShaderUniformLookup::Rehash(size_t slotCount)
     {
-        switch (stage)
+        std::vector<uint64_t> oldHashes = std::move(m_SlotHashes);
+        std::vector<uint32_t> oldIndices = std::move(m_SlotIndices);
+
+        m_SlotHashes.assign(slotCount, 0);
+        m_SlotIndices.assign(slotCount, 0);
+
+        const size_t mask = slotCount - 1;
+        for (size_t i = 0; i < oldHashes.size(); ++i)
         {
-            case ShaderStage::Vertex:                return "Vertex";
-            case ShaderStage::TessellationControl:  return "TessellationControl";
-            case ShaderStage::TessellationEvaluation: return "TessellationEvaluation";
-            case ShaderStage::Geometry:             return "Geometry";
-            case ShaderStage::Fragment:             return "Fragment";
-            case ShaderStage::Compute:              return "Compute";
-            case ShaderStage::RayGeneration:        return "RayGeneration";
-            case ShaderStage::AnyHit:               return "AnyHit";
-            case ShaderStage::ClosestHit:           return "ClosestHit";
-            case ShaderStage::Miss:                 return "Miss";
-            case ShaderStage::Intersection:         return "Intersection";
-            case ShaderStage::Callable:             return "Callable";
-            default:                                return "Unknown";
+            if (oldHashes[i] == 0)
+                continue;
+
+            size_t slot = oldHashes[i] & mask;
+            while (m_SlotHashes[slot] != 0)
+                slot = (slot + 1) & mask;
+
+            m_SlotHashes[slot] = oldHashes[i];
+            m_SlotIndices[slot] = oldIndices[i];
         }
     }
+
+    uint32_t ShaderUniformLookup::Add(std::string_view name)
+    {
+        const uint32_t existing = Find(name);
+        if (existing != kNotFound)
+            return existing;
+
+        // Grow at 2/3 load so probe chains stay short
+        if (m_SlotHashes.empty())
+            Rehash(16);
+        else if ((m_NameOffsets.size() + 1) * 3 > m_SlotHashes.size() * 2)
+            Rehash(m_SlotHashes.size() * 2);
+
+        const uint32_t index = static_cast<uint32_t>(m_NameOffsets.size());
+        m_NameOffsets.push_back(static_cast<uint32_t>(m_NamePool.size()));
+        m_NameLengths.push_back(static_cast<uint32_t>(name.size()));
+        m_NamePool.append(name);
+
+        const uint64_t hash = HashName(name);
+        const size_t mask = m_SlotHashes.size() - 1;
+        size_t slot = hash & mask;
+        while (m_SlotHashes[slot] != 0)
+            slot = (slot + 1) & mask;
+
+        m_SlotHashes[slot] = hash;
+        m_SlotIndices[slot] = index;
+        return index;
+    }
+
+    uint32_t ShaderUniformLookup::Find(std::string_view name) const
+    {
+        if (m_SlotHashes.empty())
+            return kNotFound;
+
+        const uint64_t hash = HashName(name);
+        const size_t mask = m_SlotHashes.size() - 1;
+        for (size_t slot = hash & mask; m_SlotHashes[slot] != 0; slot = (slot + 1) & mask)
+        {
+            // Compare name bytes only on a hash match
+            if (m_SlotHashes[slot] == hash && GetName(m_SlotIndices[slot]) == name)
+                return m_SlotIndices[slot];
+        }
+        return kNotFound;
+    }
+
+    void ShaderUniformLookup::Clear()
+    {
+        m_SlotHashes.clear();
+        m_SlotIndices.clear();
+        m_NamePool.clear();
+        m_NameOffsets.clear();
+        m_NameLengths.clear();
+    }
+
+    // The stage and data-type enums are contiguous from zero, so the
+    // conversions below are flat tables indexed by the enum value instead
+    // of switch trees. Order must match the enum declarations.
+    static constexpr const char* kStageNames[] = {
+        "Vertex", "TessellationControl", "TessellationEvaluation", "Geometry",
+        "Fragment", "Compute", "RayGeneration", "AnyHit", "ClosestHit",
+        "Miss", "Intersection", "Callable",
+    };
+    static_assert(sizeof(kStageNames) / sizeof(kStageNames[0]) == MaxShaderStages,
+                  "kStageNames must cover every ShaderStage");
+
+    static constexpr const char* kStageExtensions[] = {
+        ".vert", ".tesc", ".tese", ".geom", ".frag", ".comp",
+        ".rgen", ".rahit", ".rchit", ".rmiss", ".rint", ".rcall",
+    };
+    static_assert(sizeof(kStageExtensions) / sizeof(kStageExtensions[0]) == MaxShaderStages,
+                  "kStageExtensions must cover every ShaderStage");
+
+    const char* ShaderStageToString(ShaderStage stage)
+    {
+        const size_t index = static_cast<size_t>(stage);
+        return index < MaxShaderStages ? kStageNames[index] : "Unknown";
+    }
     
     const char* ShaderLanguageToString(ShaderLanguage language)
     {
@@ -34,76 +159,46 @@ namespace Vortex
         }
     }
     
+    // Indexed by ShaderDataType, Unknown through Struct
+    static constexpr const char* kDataTypeNames[] = {
+        "unknown", "bool", "int", "uint", "float", "double",
+        "vec2", "vec3", "vec4",
+        "ivec2", "ivec3", "ivec4",
+        "uvec2", "uvec3", "uvec4",
+        "mat2", "mat3", "mat4",
+        "struct",
+    };
+    static constexpr size_t kDataTypeCount = sizeof(kDataTypeNames) / sizeof(kDataTypeNames[0]);
+    static_assert(kDataTypeCount == static_cast<size_t>(ShaderDataType::Struct) + 1,
+                  "kDataTypeNames must cover every ShaderDataType");
+
+    static constexpr uint32_t kDataTypeSizes[] = {
+        0, 1, 4, 4, 4, 8,
+        4 * 2, 4 * 3, 4 * 4,
+        4 * 2, 4 * 3, 4 * 4,
+        4 * 2, 4 * 3, 4 * 4,
+        4 * 2 * 2, 4 * 3 * 3, 4 * 4 * 4,
+        0, // Struct: variable size
+    };
+    static_assert(sizeof(kDataTypeSizes) / sizeof(kDataTypeSizes[0]) == kDataTypeCount,
+                  "kDataTypeSizes must cover every ShaderDataType");
+
     const char* ShaderDataTypeToString(ShaderDataType type)
     {
-        switch (type)
-        {
-            case ShaderDataType::Bool:    return "bool";
-            case ShaderDataType::Int:     return "int";
-            case ShaderDataType::UInt:    return "uint";
-            case ShaderDataType::Float:   return "float";
-            case ShaderDataType::Double:  return "double";
-            case ShaderDataType::Vec2:    return "vec2";
-            case ShaderDataType::Vec3:    return "vec3";
-            case ShaderDataType::Vec4:    return "vec4";
-            case ShaderDataType::IVec2:   return "ivec2";
-            case ShaderDataType::IVec3:   return "ivec3";
-            case ShaderDataType::IVec4:   return "ivec4";
-            case ShaderDataType::UVec2:   return "uvec2";
-            case ShaderDataType::UVec3:   return "uvec3";
-            case ShaderDataType::UVec4:   return "uvec4";
-            case ShaderDataType::Mat2:    return "mat2";
-            case ShaderDataType::Mat3:    return "mat3";
-            case ShaderDataType::Mat4:    return "mat4";
-            case ShaderDataType::Struct:  return "struct";
-            default:                      return "unknown";
-        }
+        const size_t index = static_cast<size_t>(type);
+        return index < kDataTypeCount ? kDataTypeNames[index] : "unknown";
     }
-    
+
     uint32_t GetShaderDataTypeSize(ShaderDataType type)
     {
-        switch (type)
-        {
-            case ShaderDataType::Bool:    return 1;
-            case ShaderDataType::Int:     return 4;
-            case ShaderDataType::UInt:    return 4;
-            case ShaderDataType::Float:   return 4;
-            case ShaderDataType::Double:  return 8;
-            case ShaderDataType::Vec2:    return 4 * 2;
-            case ShaderDataType::Vec3:    return 4 * 3;
-            case ShaderDataType::Vec4:    return 4 * 4;
-            case ShaderDataType::IVec2:   return 4 * 2;
-            case ShaderDataType::IVec3:   return 4 * 3;
-            case ShaderDataType::IVec4:   return 4 * 4;
-            case ShaderDataType::UVec2:   return 4 * 2;
-            case ShaderDataType::UVec3:   return 4 * 3;
-            case ShaderDataType::UVec4:   return 4 * 4;
-            case ShaderDataType::Mat2:    return 4 * 2 * 2;
-            case ShaderDataType::Mat3:    return 4 * 3 * 3;
-            case ShaderDataType::Mat4:    return 4 * 4 * 4;
-            case ShaderDataType::Struct:  return 0; // Variable size
-            default:                      return 0;
-        }
+        const size_t index = static_cast<size_t>(type);
+        return index < kDataTypeCount ? kDataTypeSizes[index] : 0;
     }
-    
+
     std::string ShaderStageToFileExtension(ShaderStage stage)
     {
-        switch (stage)
-        {
-            case ShaderStage::Vertex:                return ".vert";
-            case ShaderStage::TessellationControl:  return ".tesc";
-            case ShaderStage::TessellationEvaluation: return ".tese";
-            case ShaderStage::Geometry:             return ".geom";
-            case ShaderStage::Fragment:             return ".frag";
-            case ShaderStage::Compute:              return ".comp";
-            case ShaderStage::RayGeneration:        return ".rgen";
-            case ShaderStage::AnyHit:               return ".rahit";
-            case ShaderStage::ClosestHit:           return ".rchit";
-            case ShaderStage::Miss:                 return ".rmiss";
-            case ShaderStage::Intersection:         return ".rint";
-            case ShaderStage::Callable:             return ".rcall";
-            default:                                return ".unknown";
-        }
+        const size_t index = static_cast<size_t>(stage);
+        return index < MaxShaderStages ? kStageExtensions[index] : ".unknown";
     }
     
     ShaderStage FileExtensionToShaderStage(const std::string& extension)
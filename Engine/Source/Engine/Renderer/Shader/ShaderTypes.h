@@ -1,10 +1,15 @@
 #pragma once
 
+#include "Engine/Renderer/RenderTypes.h"
+
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <optional>
+#include <utility>
 
 #include <glm/glm.hpp>
 
@@ -40,7 +45,7 @@ namespace Vortex
     constexpr ShaderStageFlags ShaderStageFlag_Fragment = 1u << static_cast<uint32_t>(ShaderStage::Fragment);
     constexpr ShaderStageFlags ShaderStageFlag_Compute = 1u << static_cast<uint32_t>(ShaderStage::Compute);
     constexpr ShaderStageFlags ShaderStageFlag_AllGraphics = ShaderStageFlag_Vertex | ShaderStageFlag_Fragment;
-    
+
     // ============================================================================
     // SHADER LANGUAGES AND COMPILATION
     // ============================================================================
@@ -128,13 +133,71 @@ namespace Vortex
         ShaderDataType Type;
         uint32_t Size;
     };
-    
+
+    /**
+     * @brief Flat binding-to-members table for reflected uniform blocks
+     *
+     * Shaders expose a handful of uniform block bindings (rarely more than
+     * eight), so the former unordered_map paid a node allocation and a
+     * pointer chase per binding for nothing. Entries live sorted by binding
+     * in one contiguous vector; lookup is a lower_bound over that vector and
+     * iteration is a linear walk in binding order. The interface mirrors the
+     * map operations the reflection code already used, so call sites are
+     * unchanged.
+     */
+    class ShaderUniformBufferMap
+    {
+    public:
+        using Entry = std::pair<uint32_t, std::vector<ShaderUniform>>;
+        using iterator = std::vector<Entry>::iterator;
+        using const_iterator = std::vector<Entry>::const_iterator;
+
+        iterator begin() { return m_Entries.begin(); }
+        iterator end() { return m_Entries.end(); }
+        const_iterator begin() const { return m_Entries.begin(); }
+        const_iterator end() const { return m_Entries.end(); }
+
+        size_t size() const { return m_Entries.size(); }
+        bool empty() const { return m_Entries.empty(); }
+        void reserve(size_t count) { m_Entries.reserve(count); }
+        void clear() { m_Entries.clear(); }
+
+        iterator find(uint32_t binding)
+        {
+            auto it = LowerBound(binding);
+            return (it != m_Entries.end() && it->first == binding) ? it : m_Entries.end();
+        }
+
+        const_iterator find(uint32_t binding) const
+        {
+            return const_cast<ShaderUniformBufferMap*>(this)->find(binding);
+        }
+
+        /** Get the member list for a binding, inserting an empty one in sorted position if absent */
+        std::vector<ShaderUniform>& operator[](uint32_t binding)
+        {
+            auto it = LowerBound(binding);
+            if (it == m_Entries.end() || it->first != binding)
+                it = m_Entries.emplace(it, binding, std::vector<ShaderUniform>{});
+            return it->second;
+        }
+
+    private:
+        iterator LowerBound(uint32_t binding)
+        {
+            return std::lower_bound(m_Entries.begin(), m_Entries.end(), binding,
+                [](const Entry& entry, uint32_t key) { return entry.first < key; });
+        }
+
+        std::vector<Entry> m_Entries;
+    };
+
     struct ShaderReflectionData
     {
         std::vector<ShaderUniform> Uniforms;
         std::vector<ShaderResource> Resources;
         std::vector<ShaderVertexInput> VertexInputs;
-        std::unordered_map<uint32_t, std::vector<ShaderUniform>> UniformBuffers;
+        ShaderUniformBufferMap UniformBuffers;
         
         // Compute shader specific
         glm::uvec3 LocalSize{0, 0, 0};  // Local workgroup size
@@ -143,7 +206,57 @@ namespace Vortex
         uint32_t InstructionCount = 0;
         uint32_t MemoryUsage = 0;
     };
-    
+
+    /**
+     * @brief Open-addressed name-to-index table for reflected uniform names
+     *
+     * The per-frame SetUniform(name) path used to probe a
+     * std::unordered_map<std::string, ...>, touching a node allocation and a
+     * full std::string per probe. This table keeps the slot metadata as
+     * parallel arrays so a lookup walks only the 8-byte hash lane (FNV-1a,
+     * linear probing) and touches the interned name bytes just once to
+     * confirm the final match. Names live contiguously in a single pool; the
+     * table hands out dense indices that callers use to subscript their own
+     * parallel per-uniform arrays (locations, block members, ...).
+     */
+    class ShaderUniformLookup
+    {
+    public:
+        static constexpr uint32_t kNotFound = 0xFFFFFFFFu;
+
+        /** Intern a name and return its dense index (existing index if already present) */
+        uint32_t Add(std::string_view name);
+
+        /** Look up a name; returns kNotFound if it was never added */
+        uint32_t Find(std::string_view name) const;
+
+        /** Get an interned name back by its dense index */
+        std::string_view GetName(uint32_t index) const
+        {
+            if (index >= m_NameOffsets.size())
+                return {};
+            return std::string_view(m_NamePool).substr(m_NameOffsets[index], m_NameLengths[index]);
+        }
+
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_NameOffsets.size()); }
+
+        void Clear();
+
+    private:
+        static uint64_t HashName(std::string_view name);
+        void Rehash(size_t slotCount);
+
+        // Slot metadata as SoA: probing reads m_SlotHashes only (hash 0
+        // marks an empty slot; HashName never returns 0)
+        std::vector<uint64_t> m_SlotHashes;
+        std::vector<uint32_t> m_SlotIndices;
+
+        // Interned names: one contiguous pool plus per-index offset/length
+        std::string m_NamePool;
+        std::vector<uint32_t> m_NameOffsets;
+        std::vector<uint32_t> m_NameLengths;
+    };
+
     // ============================================================================
     // COMPILATION RESULTS
     // ============================================================================
@@ -183,7 +296,13 @@ namespace Vortex
         
         bool IsValid() const { return Status == ShaderCompileStatus::Success && !SpirV.empty(); }
     };
-    
+
+    // Variant-hash keyed result map for CompileVariants. The keys come out
+    // of GenerateVariantHash already well mixed, so the map hashes by
+    // identity like the other renderer caches; callers should reserve() to
+    // the variant count before filling it.
+    using ShaderVariantMap = std::unordered_map<uint64_t, CompiledShader, IdentityU64Hash>;
+
     struct ShaderProgram
     {
         std::unordered_map<ShaderStage, CompiledShader> Shaders;
@@ -208,10 +327,41 @@ namespace Vortex
     // SHADER COMPILATION OPTIONS
     // ============================================================================
     
+    /**
+     * @brief Compile macro set stored as sorted parallel name/value arrays
+     *
+     * Macros used to live in a std::unordered_map, which the hashing and
+     * option-build loops then had to copy out and sort on every compile to
+     * get a deterministic order, chasing a node allocation per entry along
+     * the way. This keeps names and values in two flat vectors, sorted by
+     * name at insert time, so hashing is one linear walk over contiguous
+     * strings and equivalent macro sets always hash identically no matter
+     * what order they were added in.
+     */
+    class ShaderMacroSet
+    {
+    public:
+        /** Insert or overwrite a macro, keeping the arrays sorted by name */
+        void Set(std::string_view name, std::string_view value = "1");
+
+        /** Look up a macro's value; returns nullopt if it was never set */
+        std::optional<std::string_view> Find(std::string_view name) const;
+
+        const std::vector<std::string>& GetNames() const { return m_Names; }
+        const std::vector<std::string>& GetValues() const { return m_Values; }
+        size_t GetCount() const { return m_Names.size(); }
+        bool IsEmpty() const { return m_Names.empty(); }
+        void Clear() { m_Names.clear(); m_Values.clear(); }
+
+    private:
+        std::vector<std::string> m_Names;
+        std::vector<std::string> m_Values;
+    };
+
     struct ShaderCompileOptions
     {
         ShaderOptimizationLevel OptimizationLevel = ShaderOptimizationLevel::None;
-        std::unordered_map<std::string, std::string> Macros;
+        ShaderMacroSet Macros;
         std::vector<std::string> IncludePaths;
         
         bool GenerateDebugInfo = false;
@@ -222,8 +372,14 @@ namespace Vortex
         // Target environment
         std::string TargetProfile = "vulkan1.1";  // vulkan1.0, vulkan1.1, opengl4.5, etc.
         
-        // Validation
+        // Validation re-walks the whole SPIR-V module after compilation, a
+        // noticeable share of compile time on small shaders, so it defaults
+        // on only in debug builds; release callers opt in per compile
+#ifdef VX_DEBUG
         bool EnableValidation = true;
+#else
+        bool EnableValidation = false;
+#endif
         bool ValidateAfterOptimization = false;
         
         // Caching
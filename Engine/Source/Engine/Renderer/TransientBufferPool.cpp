@@ -0,0 +1,113 @@
+#include "vxpch.h"
+#include "TransientBufferPool.h"
+#include "RenderCommandQueue.h"
+#include "Core/Debug/Log.h"
+
+namespace Vortex
+{
+    TransientBufferPool::~TransientBufferPool()
+    {
+        Shutdown();
+    }
+
+    uint32_t TransientBufferPool::BucketIndexFor(uint64_t size)
+    {
+        uint32_t index = 0;
+        uint64_t bucketSize = kMinBucketSize;
+        while (bucketSize < size && index + 1 < kBucketCount)
+        {
+            bucketSize <<= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    uint64_t TransientBufferPool::BucketSize(uint32_t bucketIndex)
+    {
+        return kMinBucketSize << bucketIndex;
+    }
+
+    TransientBufferPool::Allocation TransientBufferPool::Acquire(uint64_t size)
+    {
+        const uint32_t bucketIndex = BucketIndexFor(size);
+
+        Allocation alloc;
+        alloc.Size = BucketSize(bucketIndex);
+
+        auto& freeList = m_FreeLists[bucketIndex];
+        if (!freeList.empty())
+        {
+            alloc.Buffer = freeList.back();
+            freeList.pop_back();
+            return alloc;
+        }
+
+        // Miss: allocate a fresh name with immutable storage sized to the
+        // bucket so later reuses never reallocate
+        GetRenderCommandQueue().GenBuffers(1, &alloc.Buffer, true);
+        GetRenderCommandQueue().BindBuffer(static_cast<uint32_t>(BufferTarget::CopyWriteBuffer), alloc.Buffer);
+        GetRenderCommandQueue().BufferStorage(static_cast<uint32_t>(BufferTarget::CopyWriteBuffer), alloc.Size,
+            ToFlags(BufferStorageFlags::DynamicStorageBit));
+        return alloc;
+    }
+
+    void TransientBufferPool::Release(const Allocation& alloc)
+    {
+        if (alloc.Buffer == 0)
+        {
+            return;
+        }
+
+        PendingRelease pending;
+        pending.Buffer = alloc.Buffer;
+        pending.BucketIndex = BucketIndexFor(alloc.Size);
+        GetRenderCommandQueue().FenceSync(&pending.Fence);
+        m_Pending.push_back(pending);
+    }
+
+    void TransientBufferPool::Sweep()
+    {
+        auto signaled = [](uint32_t status)
+        {
+            return status == static_cast<uint32_t>(SyncWaitStatus::AlreadySignaled) ||
+                   status == static_cast<uint32_t>(SyncWaitStatus::ConditionSatisfied);
+        };
+
+        for (size_t i = 0; i < m_Pending.size(); )
+        {
+            uint32_t status = 0;
+            GetRenderCommandQueue().ClientWaitSync(m_Pending[i].Fence, 0ull, 0ull, &status);
+            if (!signaled(status))
+            {
+                ++i;
+                continue;
+            }
+
+            GetRenderCommandQueue().DeleteSync(m_Pending[i].Fence);
+            m_FreeLists[m_Pending[i].BucketIndex].push_back(m_Pending[i].Buffer);
+
+            // Order within the pending list does not matter; swap-erase
+            m_Pending[i] = m_Pending.back();
+            m_Pending.pop_back();
+        }
+    }
+
+    void TransientBufferPool::Shutdown()
+    {
+        for (auto& pending : m_Pending)
+        {
+            GetRenderCommandQueue().DeleteSync(pending.Fence);
+            GetRenderCommandQueue().DeleteBuffers(1, &pending.Buffer, true);
+        }
+        m_Pending.clear();
+
+        for (auto& freeList : m_FreeLists)
+        {
+            if (!freeList.empty())
+            {
+                GetRenderCommandQueue().DeleteBuffers(static_cast<uint32_t>(freeList.size()), freeList.data(), true);
+                freeList.clear();
+            }
+        }
+    }
+}
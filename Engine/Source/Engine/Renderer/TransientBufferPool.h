@@ -0,0 +1,83 @@
+#pragma once
+
+#include "RenderTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Vortex
+{
+    /**
+     * @brief Fence-guarded free-list pool for short-lived GPU buffers
+     *
+     * Frames that stream transient data (particles, UI geometry, upload
+     * staging) tend to allocate and free buffers constantly, and a
+     * delete-then-regen sequence is a driver sync point: the delete cannot
+     * retire until the GPU is done with the buffer. The pool keeps names
+     * alive instead — Release fences the buffer and a once-per-frame Sweep
+     * moves it back to a free list only after the fence signals, so Acquire
+     * almost always reuses an idle name without touching the driver.
+     *
+     * Buffers are bucketed by power-of-two size class and allocated with
+     * immutable storage sized to the bucket, so reuse never reallocates.
+     * GL buffer names are target-agnostic, so one pool serves every bind
+     * point. All methods must be called from the render thread, like the
+     * rest of the renderer's resource lifetime code.
+     */
+    class TransientBufferPool
+    {
+    public:
+        struct Allocation
+        {
+            uint32_t Buffer = 0;
+            uint64_t Size = 0;   // bucket size; >= the requested size
+        };
+
+        TransientBufferPool() = default;
+        ~TransientBufferPool();
+
+        TransientBufferPool(const TransientBufferPool&) = delete;
+        TransientBufferPool& operator=(const TransientBufferPool&) = delete;
+
+        /**
+         * @brief Get a buffer of at least size bytes, reusing an idle one when possible
+         * @param size Requested size in bytes
+         * @return Allocation with the buffer name and its actual (bucket) size
+         */
+        Allocation Acquire(uint64_t size);
+
+        /**
+         * @brief Return a buffer to the pool once the GPU no longer needs it
+         *
+         * Inserts a fence; the buffer becomes reusable after a later Sweep
+         * sees the fence signaled. The caller must not touch the buffer again.
+         */
+        void Release(const Allocation& alloc);
+
+        /**
+         * @brief Promote released buffers whose fences have signaled (call once per frame)
+         */
+        void Sweep();
+
+        /**
+         * @brief Delete every pooled buffer and outstanding fence
+         */
+        void Shutdown();
+
+    private:
+        static constexpr uint64_t kMinBucketSize = 256;
+        static constexpr uint32_t kBucketCount = 24;   // kMinBucketSize << 23 = 2 GiB cap
+
+        struct PendingRelease
+        {
+            uint32_t Buffer = 0;
+            uint32_t BucketIndex = 0;
+            uint64_t Fence = 0;
+        };
+
+        static uint32_t BucketIndexFor(uint64_t size);
+        static uint64_t BucketSize(uint32_t bucketIndex);
+
+        std::vector<uint32_t> m_FreeLists[kBucketCount];
+        std::vector<PendingRelease> m_Pending;
+    };
+}
@@ -51,6 +51,68 @@ namespace Vortex
         {
             VX_CORE_INFO("VSync mode set to {}", VSyncModeToString(m_Settings.VSync));
         }
+
+        // Apply the buffering policy on top of the base VSync mode. With
+        // VSync off there is no refresh interval to pace against, so the
+        // policy stays dormant until VSync is re-enabled
+        m_LastPresentTime = {};
+        m_OnTimeStreak = 0;
+        m_DynamicTripleActive = false;
+        if (m_Settings.VSync != VSyncMode::Disabled)
+        {
+            auto policy = m_GraphicsContext->SetSwapchainBufferPolicy(m_Settings.BufferPolicy);
+            if (policy.IsError())
+            {
+                VX_CORE_WARN("Failed to apply swapchain policy {}: {}",
+                    SwapchainPolicyToString(m_Settings.BufferPolicy), policy.GetErrorMessage());
+            }
+            else
+            {
+                VX_CORE_INFO("Swapchain policy set to {}", SwapchainPolicyToString(m_Settings.BufferPolicy));
+            }
+        }
+    }
+
+    void RenderSystem::UpdatePresentPolicy()
+    {
+        if (m_Settings.BufferPolicy != SwapchainPolicy::Dynamic || m_Settings.VSync == VSyncMode::Disabled)
+            return;
+
+        // No display refresh query in the platform layer yet, so assume the
+        // common 60 Hz and leave a 25% margin before calling a frame late;
+        // a compositor-scheduled swap lands slightly past the interval even
+        // when healthy
+        constexpr auto kRefreshInterval = std::chrono::microseconds(16667);
+        constexpr auto kLateThreshold = kRefreshInterval + kRefreshInterval / 4;
+
+        // Frames to stay on time before dropping back to double buffering;
+        // switching up is immediate (one stall is one too many), switching
+        // down is conservative so a borderline load doesn't ping-pong modes
+        constexpr uint32_t kRecoveryStreak = 120;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (m_LastPresentTime.time_since_epoch().count() != 0)
+        {
+            const auto frameTime = now - m_LastPresentTime;
+            if (frameTime > kLateThreshold)
+            {
+                m_OnTimeStreak = 0;
+                if (!m_DynamicTripleActive)
+                {
+                    m_DynamicTripleActive = true;
+                    auto r = m_GraphicsContext->SetVSyncMode(m_GraphicsContext->PickTripleBufferedMode());
+                    VX_LOG_ERROR(r);
+                }
+            }
+            else if (m_DynamicTripleActive && ++m_OnTimeStreak >= kRecoveryStreak)
+            {
+                m_DynamicTripleActive = false;
+                m_OnTimeStreak = 0;
+                auto r = m_GraphicsContext->SetVSyncMode(VSyncMode::Enabled);
+                VX_LOG_ERROR(r);
+            }
+        }
+        m_LastPresentTime = now;
     }
 
     void RenderSystem::LoadRenderSettingsFromConfig()
@@ -307,6 +369,15 @@ namespace Vortex
         auto proc = GetRenderCommandQueue().ProcessCommands();
         VX_LOG_ERROR(proc);
 
+        // Processed commands no longer reference their transient strings;
+        // reclaim the frame arena in one bump. Commands submitted later in
+        // the frame allocate into the fresh arena and are covered by the
+        // next frame's reset.
+        if (auto* renderer = GetRenderer())
+        {
+            renderer->GetFrameArena().Reset();
+        }
+
         // Render ImGui dockspace after main rendering
         if (auto* imgui = Vortex::Sys<ImGuiSystem>())
         {
@@ -349,6 +420,9 @@ namespace Vortex
             return presentResult;
         }
 
+        // Let the dynamic buffering policy react to this frame's timing
+        UpdatePresentPolicy();
+
         return Result<void>();
     }
 
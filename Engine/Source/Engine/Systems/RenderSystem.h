@@ -10,6 +10,8 @@
 #include "Core/Window.h"
 #include "Core/Debug/ErrorCodes.h"
 
+#include <chrono>
+
 namespace Vortex
 {
     struct RenderSettings
@@ -21,6 +23,10 @@ namespace Vortex
         int32_t ClearStencil = 0;
         
         VSyncMode VSync = VSyncMode::Enabled;
+
+        // Presentation buffering policy; only meaningful when VSync is on.
+        // Dynamic toggles double/triple per-frame from Present timing
+        SwapchainPolicy BufferPolicy = SwapchainPolicy::AlwaysDouble;
     };
 
     class RenderSystem : public EngineSystem
@@ -85,6 +91,7 @@ namespace Vortex
         Result<void> HandleResize(uint32_t width, uint32_t height);
         void ApplySettings();
         void LoadRenderSettingsFromConfig();
+        void UpdatePresentPolicy();
 
     private:
         Window* m_Window = nullptr; // Non-owning
@@ -93,6 +100,11 @@ namespace Vortex
 
         RenderSettings m_Settings;
 
+        // Dynamic swapchain policy state (see UpdatePresentPolicy)
+        std::chrono::steady_clock::time_point m_LastPresentTime{};
+        uint32_t m_OnTimeStreak = 0;
+        bool m_DynamicTripleActive = false;
+
         // Optional external framebuffer for scene rendering (editor viewport)
         FrameBufferRef m_SceneTarget;
 
@@ -60,6 +60,7 @@
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/UniformBuffer.h"
 #include "Engine/Renderer/FrameBuffer.h"
+#include "Engine/Renderer/TransientBufferPool.h"
 #include "Engine/Systems/ImGuiInterop.h"
 #include "Engine/Renderer/Renderer2D.h"
 
@@ -227,6 +227,7 @@ project "Engine"
         defines { "VX_DIST", "VX_SPIRV_CROSS_AVAILABLE" }
         runtime "Release"
         optimize "on"
+        flags { "LinkTimeOptimization" }
 
         externalincludedirs
         {
@@ -8,11 +8,13 @@ layout(location = 5) in uint iTexIndex;   // texture index
 layout(location = 6) in vec2 iRotSinCos;  // (cos(z), sin(z))
 layout(location = 7) in float iZ;         // depth (world Z)
 
-// Explicit uniform locations are required by our compiler settings
-layout(location = 0) uniform mat4 u_ViewProjection; // occupies locations 0..3
-// Engine-level pixel snapping controls (set by Renderer2D)
-layout(location = 4) uniform vec2 u_ViewportSize;
-layout(location = 5) uniform int  u_PixelSnap; // 0 = off, 1 = on
+// Per-frame constants, uploaded once per BeginScene (see Renderer2DStorage::FrameConstants)
+layout(std140, binding = 0) uniform FrameConstants
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;  // pixel snapping viewport (engine-level)
+    int  u_PixelSnap;     // 0 = off, 1 = on
+};
 
 layout(location = 0) out vec4 vColor;
 layout(location = 1) out vec2 vTexCoord;
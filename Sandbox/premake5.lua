@@ -221,6 +221,7 @@ project "Sandbox"
         defines "VX_DIST"
         runtime "Release"
         optimize "on"
+        flags { "LinkTimeOptimization" }
 
         externalincludedirs
         {
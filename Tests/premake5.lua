@@ -138,6 +138,7 @@ project "Tests"
 		defines "VX_DIST"
 		runtime "Release"
 		optimize "on"
+		flags { "LinkTimeOptimization" }
 		externalincludedirs
 		{
 			"%{wks.location}/Engine/Vendor/SDL3/install/Release/include",